@@ -0,0 +1,144 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchAreaExtractor.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Minimal cycle extraction on large street graphs.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <list>
+#include <map>
+#include <sstream>
+
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/areaextractor.h"
+#include "../src/area/zone.h"
+#include "../src/area/block.h"
+
+namespace
+{
+  template <typename AreaType>
+  void freeAreas(std::list<AreaType*>* areas)
+  {
+    while (!areas->empty())
+    {
+      delete areas->back();
+      areas->pop_back();
+    }
+  }
+}
+
+BENCHMARK(AreaExtraction)
+{
+  AreaExtractor::Algorithm algorithms[] = {AreaExtractor::MINIMAL_CYCLE_BASIS,
+                                           AreaExtractor::HALF_EDGE_FACES};
+  const char* names[] = {"minimal cycle basis", "half-edge faces"};
+
+  /* Roughly 10k, 50k, 200k and 500k intersections. */
+  int sizes[] = {5000, 25000, 100000, 265000};
+  for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+  {
+    StreetGraph graph;
+    Fixtures::latticeNetwork(&graph, sizes[size]);
+    int intersections = graph.numberOfIntersections();
+
+    for (unsigned int algorithm = 0; algorithm < sizeof(algorithms)/sizeof(algorithms[0]); algorithm++)
+    {
+      AreaExtractor extractor;
+      extractor.setAlgorithm(algorithms[algorithm]);
+      extractor.setRoadWidth(Road::PRIMARY_ROAD, 8);
+      extractor.setRoadWidth(Road::SECONDARY_ROAD, 4);
+
+      Benchmark::Timer timer;
+      std::list<Zone*> zones = extractor.extractZones(&graph);
+      std::stringstream label;
+      label << names[algorithm] << ", zones, " << intersections << " intersections -> "
+            << zones.size() << " zones";
+      Benchmark::report(label.str(), intersections, timer.elapsed());
+      freeAreas(&zones);
+
+      timer.restart();
+      std::list<Block*> blocks = extractor.extractBlocks(&graph);
+      label.str("");
+      label << names[algorithm] << ", blocks, " << intersections << " intersections -> "
+            << blocks.size() << " blocks";
+      Benchmark::report(label.str(), intersections, timer.elapsed());
+      freeAreas(&blocks);
+    }
+  }
+}
+
+BENCHMARK(BlockExtraction)
+{
+  /* Block extraction substracts road widths from every cycle,
+     the widths of the boundary roads are needed for each of them. */
+  AreaExtractor::Algorithm algorithms[] = {AreaExtractor::MINIMAL_CYCLE_BASIS,
+                                           AreaExtractor::HALF_EDGE_FACES};
+  const char* names[] = {"minimal cycle basis", "half-edge faces"};
+
+  StreetGraph graph;
+  Fixtures::latticeNetwork(&graph, 25000);
+  int intersections = graph.numberOfIntersections();
+
+  for (unsigned int algorithm = 0; algorithm < sizeof(algorithms)/sizeof(algorithms[0]); algorithm++)
+  {
+    AreaExtractor extractor;
+    extractor.setAlgorithm(algorithms[algorithm]);
+    extractor.setRoadWidth(Road::PRIMARY_ROAD, 8);
+    extractor.setRoadWidth(Road::SECONDARY_ROAD, 4);
+
+    const int RUNS = 5;
+    int numberOfBlocks = 0;
+    Benchmark::Timer timer;
+    for (int run = 0; run < RUNS; run++)
+    {
+      std::list<Block*> blocks = extractor.extractBlocks(&graph);
+      numberOfBlocks = blocks.size();
+      freeAreas(&blocks);
+    }
+
+    std::stringstream label;
+    label << names[algorithm] << ", " << intersections << " intersections -> "
+          << numberOfBlocks << " blocks";
+    Benchmark::report(label.str(), RUNS * numberOfBlocks, timer.elapsed());
+  }
+}
+
+BENCHMARK(ExtractionAllocations)
+{
+  /* Zones first, then blocks inside each zone the way City does it.
+     Every zone reads the intersections of the whole graph. */
+  StreetGraph graph;
+  Fixtures::latticeNetwork(&graph, 5000);
+
+  std::map<Road::Type, double> roadWidths;
+  roadWidths[Road::PRIMARY_ROAD]   = 8;
+  roadWidths[Road::SECONDARY_ROAD] = 4;
+
+  long allocations = Benchmark::allocations();
+  Benchmark::Timer timer;
+
+  AreaExtractor extractor;
+  std::list<Zone*> zones = extractor.extractZones(&graph);
+  int numberOfBlocks = 0;
+  for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+  {
+    (*zone)->createBlocks(roadWidths);
+    numberOfBlocks += (*zone)->blockRange().size();
+  }
+
+  double seconds = timer.elapsed();
+  allocations = Benchmark::allocations() - allocations;
+
+  std::stringstream label;
+  label << graph.numberOfIntersections() << " intersections -> " << zones.size()
+        << " zones, " << numberOfBlocks << " blocks, heap allocations";
+  Benchmark::report(label.str(), allocations, seconds);
+  freeAreas(&zones);
+}
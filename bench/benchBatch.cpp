@@ -0,0 +1,129 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchBatch.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Batch point-in-polygon and segment tests, one by one,
+ *        scalar and vectorized.
+ *
+ */
+
+#include "benchmark.h"
+
+#include <vector>
+#include <cmath>
+#include <sstream>
+
+#include "../src/geometry/batch.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/units.h"
+#include "../src/random.h"
+
+namespace
+{
+  const int POINTS = 1000000;
+
+  /** Polygon shaped like a star with the given number of vertices. */
+  Polygon star(int vertices)
+  {
+    Polygon polygon;
+    for (int i = 0; i < vertices; i++)
+    {
+      double angle = i * 2 * libcity::PI / vertices,
+             radius = i % 2 ? 300 : 500;
+      polygon.addVertex(Point(500 + radius * std::cos(angle), 500 + radius * std::sin(angle)));
+    }
+    return polygon;
+  }
+
+  std::string label(std::string const& name, std::string const& kernel, int count)
+  {
+    std::stringstream text;
+    text << name << ", " << kernel << " (" << count << " hits)";
+    return text.str();
+  }
+
+  int hits(std::vector<bool> const& flags)
+  {
+    int count = 0;
+    for (unsigned int i = 0; i < flags.size(); i++)
+    {
+      count += flags[i];
+    }
+    return count;
+  }
+}
+
+BENCHMARK(BatchEncloses)
+{
+  Random generator(libcity::RANDOM_SEED);
+  Batch::PointArray points;
+  points.reserve(POINTS);
+  for (int i = 0; i < POINTS; i++)
+  {
+    points.push_back(Point(generator.generateDouble(0, 1000), generator.generateDouble(0, 1000)));
+  }
+
+  int sizes[] = {4, 16, 64};
+  for (int size = 0; size < 3; size++)
+  {
+    Polygon polygon = star(sizes[size]);
+    std::stringstream name;
+    name << "Points in a polygon with " << sizes[size] << " vertices";
+
+    std::vector<bool> inside(POINTS);
+    Benchmark::Timer timer;
+    for (int i = 0; i < POINTS; i++)
+    {
+      inside[i] = polygon.encloses2D(Point(points.x[i], points.y[i]));
+    }
+    Benchmark::report(label(name.str(), "Polygon::encloses2D()", hits(inside)), POINTS, timer.elapsed());
+
+    timer.restart();
+    Batch::encloses2D(polygon, points, &inside, Batch::SCALAR);
+    Benchmark::report(label(name.str(), "scalar", hits(inside)), POINTS, timer.elapsed());
+
+    timer.restart();
+    Batch::encloses2D(polygon, points, &inside, Batch::VECTOR);
+    Benchmark::report(label(name.str(), Batch::instructionSet(), hits(inside)), POINTS, timer.elapsed());
+  }
+}
+
+BENCHMARK(BatchIntersects)
+{
+  Random generator(libcity::RANDOM_SEED);
+  Batch::SegmentArray segments;
+  segments.reserve(POINTS);
+  for (int i = 0; i < POINTS; i++)
+  {
+    Point begining(generator.generateDouble(0, 1000), generator.generateDouble(0, 1000));
+    double angle = generator.generateDouble(0, 2 * libcity::PI);
+    segments.push_back(LineSegment(begining, Point(begining.x() + 100 * std::cos(angle),
+                                                   begining.y() + 100 * std::sin(angle))));
+  }
+  LineSegment segment(Point(100, 150), Point(900, 850));
+  std::string name = "Segments crossing a segment";
+
+  std::vector<bool> intersecting(POINTS);
+  Point intersection;
+  Benchmark::Timer timer;
+  for (int i = 0; i < POINTS; i++)
+  {
+    LineSegment another(Point(segments.beginingX[i], segments.beginingY[i]),
+                        Point(segments.endX[i], segments.endY[i]));
+    intersecting[i] = segment.intersection2D(another, &intersection) != LineSegment::NONINTERSECTING;
+  }
+  Benchmark::report(label(name, "LineSegment::intersection2D()", hits(intersecting)), POINTS, timer.elapsed());
+
+  timer.restart();
+  Batch::intersects2D(segment, segments, &intersecting, Batch::SCALAR);
+  Benchmark::report(label(name, "scalar", hits(intersecting)), POINTS, timer.elapsed());
+
+  timer.restart();
+  Batch::intersects2D(segment, segments, &intersecting, Batch::VECTOR);
+  Benchmark::report(label(name, Batch::instructionSet(), hits(intersecting)), POINTS, timer.elapsed());
+}
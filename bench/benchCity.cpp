@@ -0,0 +1,110 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchCity.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Whole city generation.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <vector>
+#include <sstream>
+
+#include "../src/random.h"
+#include "../src/threadpool.h"
+
+namespace
+{
+  struct CitySummary
+  {
+    int roads;
+    int zones;
+    int blocks;
+    int lots;
+    double checksum;
+
+    bool operator==(CitySummary const& another) const
+    {
+      return roads == another.roads && zones == another.zones &&
+             blocks == another.blocks && lots == another.lots &&
+             checksum == another.checksum;
+    }
+  };
+
+  /** @param masterSeed Zero means the shared Random seed. */
+  CitySummary generateCity(unsigned long long masterSeed, int sharedSeed, double* seconds,
+                           double size = 10000, int primaryRoads = 150, int threads = 1)
+  {
+    Random::setSeed(sharedSeed);
+    Fixtures::SampleCity city(size, primaryRoads, 60);
+    city.setNumberOfThreads(threads);
+    if (masterSeed != 0)
+    {
+      city.setSeed(masterSeed);
+    }
+
+    Benchmark::Timer timer;
+    city.generate();
+    *seconds = timer.elapsed();
+    Random::setSeed(libcity::RANDOM_SEED);
+
+    CitySummary summary = {city.numberOfRoads(), city.numberOfZones(),
+                           city.numberOfBlocks(), city.numberOfLots(), city.lotsChecksum()};
+    return summary;
+  }
+
+  std::string describe(CitySummary const& city)
+  {
+    std::stringstream description;
+    description << city.roads << " roads, " << city.zones << " zones, "
+                << city.blocks << " blocks, " << city.lots << " lots";
+    return description.str();
+  }
+}
+
+BENCHMARK(CitySeeding)
+{
+  double seconds;
+  CitySummary shared = generateCity(0, libcity::RANDOM_SEED, &seconds);
+  Benchmark::report("shared seed, " + describe(shared), shared.lots, seconds);
+
+  /* The master seed alone determines the city */
+  CitySummary seeded = generateCity(42, libcity::RANDOM_SEED, &seconds);
+  Benchmark::report("master seed, " + describe(seeded), seeded.lots, seconds);
+
+  CitySummary reshuffled = generateCity(42, 1234, &seconds);
+  Benchmark::report(std::string("master seed, other shared seed, ") +
+                    (reshuffled == seeded ? "identical" : "MISMATCH"), reshuffled.lots, seconds);
+}
+
+BENCHMARK(CityScaling)
+{
+  std::vector<int> threads;
+  for (int count = 1; count < ThreadPool::hardwareThreads(); count *= 2)
+  {
+    threads.push_back(count);
+  }
+  threads.push_back(ThreadPool::hardwareThreads());
+
+  CitySummary first;
+  for (unsigned int count = 0; count < threads.size(); count++)
+  {
+    double seconds;
+    CitySummary city = generateCity(42, libcity::RANDOM_SEED, &seconds, 30000, 1200, threads[count]);
+    if (count == 0)
+    {
+      first = city;
+    }
+
+    std::stringstream label;
+    label << describe(city) << ", " << threads[count]
+          << (threads[count] == 1 ? " thread" : " threads")
+          << (city == first ? "" : " MISMATCH");
+    Benchmark::report(label.str(), city.lots, seconds);
+  }
+}
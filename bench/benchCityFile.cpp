@@ -0,0 +1,131 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchCityFile.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Saving and loading cities compared to generating them again.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <sstream>
+#include <cstdio>
+
+#include "../src/io/cityfile.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/area/zone.h"
+#include "../src/random.h"
+
+namespace
+{
+  const char* FILE_NAME = "benchCityFile.city";
+
+  /** Read every coordinate of the file, the pages get mapped. */
+  double touchGeometry(CityFile const& file)
+  {
+    double sum = 0;
+    for (int intersection = 0; intersection < file.numberOfIntersections(); intersection++)
+    {
+      sum += file.intersectionsX()[intersection] + file.intersectionsY()[intersection];
+    }
+    for (int road = 0; road < file.numberOfRoads(); road++)
+    {
+      sum += file.roadsBeginings()[road] + file.roadsEnds()[road];
+    }
+    for (int lot = 0; lot < file.numberOfLots(); lot++)
+    {
+      CityFile::AreaRecord const& record = file.lotRecords()[lot];
+      for (unsigned int vertex = record.firstVertex; vertex < record.firstVertex + record.numberOfVertices; vertex++)
+      {
+        sum += file.verticesX()[vertex] + file.verticesY()[vertex];
+      }
+    }
+    return sum;
+  }
+
+  /** Open the file and go through it the ways it can be used. */
+  void load(std::string const& name, int roads, int lots)
+  {
+    std::stringstream label;
+
+    CityFile file;
+    Benchmark::Timer timer;
+    bool opened = file.open(FILE_NAME);
+    Benchmark::report("CityFile::open, " + name + (opened ? "" : " FAILED"), 1, timer.elapsed());
+
+    timer.restart();
+    double checksum = touchGeometry(file);
+    label << "reading all geometry, " << name << (checksum != 0 ? "" : " (empty)");
+    Benchmark::report(label.str(), file.numberOfIntersections() + file.numberOfLots(), timer.elapsed());
+
+    if (file.numberOfZones() > 0)
+    {
+      timer.restart();
+      for (int zone = 0; zone < file.numberOfZones(); zone++)
+      {
+        file.zone(zone);
+      }
+      label.str("");
+      label << "CityFile::zone, all zones, " << name << (file.numberOfLots() == lots ? "" : " MISMATCH");
+      Benchmark::report(label.str(), file.numberOfLots(), timer.elapsed());
+    }
+
+    StreetGraph graph;
+    timer.restart();
+    file.loadStreetGraph(&graph);
+    label.str("");
+    label << "CityFile::loadStreetGraph, " << name << (graph.numberOfRoads() == roads ? "" : " MISMATCH");
+    Benchmark::report(label.str(), graph.numberOfRoads(), timer.elapsed());
+  }
+}
+
+BENCHMARK(CityFileRoundTrip)
+{
+  struct { double size; int primaryRoads; } cities[] = {{10000, 150}, {20000, 600}};
+  for (unsigned int city = 0; city < sizeof(cities)/sizeof(cities[0]); city++)
+  {
+    std::stringstream name;
+    name << cities[city].size << " m city";
+
+    Random::setSeed(libcity::RANDOM_SEED);
+    Fixtures::SampleCity generated(cities[city].size, cities[city].primaryRoads, 60);
+    generated.setSeed(libcity::RANDOM_SEED);
+
+    Benchmark::Timer timer;
+    generated.generate();
+    Benchmark::report("City::generate, " + name.str(), generated.numberOfLots(), timer.elapsed());
+
+    timer.restart();
+    bool saved = generated.save(FILE_NAME);
+    Benchmark::report("City::save, " + name.str() + (saved ? "" : " FAILED"),
+                      generated.numberOfLots(), timer.elapsed());
+
+    load(name.str(), generated.numberOfRoads(), generated.numberOfLots());
+  }
+  std::remove(FILE_NAME);
+}
+
+BENCHMARK(CityFileLargeGraph)
+{
+  int sizes[] = {100000, 1000000};
+  for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+  {
+    StreetGraph graph;
+    Fixtures::latticeNetwork(&graph, sizes[size]);
+
+    std::stringstream name;
+    name << graph.numberOfRoads() << " roads";
+
+    Benchmark::Timer timer;
+    bool saved = CityFile::save(FILE_NAME, &graph, std::list<Zone*>());
+    Benchmark::report("CityFile::save, " + name.str() + (saved ? "" : " FAILED"),
+                      graph.numberOfRoads(), timer.elapsed());
+
+    load(name.str(), graph.numberOfRoads(), 0);
+  }
+  std::remove(FILE_NAME);
+}
@@ -0,0 +1,168 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchCompactStreetGraph.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Memory and traversal of pointer and compact graph storage.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <list>
+#include <set>
+
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/compactstreetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/road.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/vector.h"
+
+namespace
+{
+  const int TRAVERSALS = 5;
+
+  /** Breadth first search over the pointer graph. */
+  int visitAll(StreetGraph* graph)
+  {
+    std::set<Intersection*> visited;
+    std::list<Intersection*> open;
+    StreetGraph::Intersections intersections = graph->getIntersections();
+    for (StreetGraph::Intersections::iterator start = intersections.begin();
+         start != intersections.end();
+         start++)
+    {
+      if (!visited.insert(*start).second)
+      {
+        continue;
+      }
+      open.push_back(*start);
+      while (!open.empty())
+      {
+        Intersection* current = open.front();
+        open.pop_front();
+        std::list<Road*> ways = current->getRoads();
+        for (std::list<Road*>::iterator way = ways.begin();
+             way != ways.end();
+             way++)
+        {
+          Intersection* next = (*way)->begining() == current ? (*way)->end() : (*way)->begining();
+          if (visited.insert(next).second)
+          {
+            open.push_back(next);
+          }
+        }
+      }
+    }
+    return visited.size();
+  }
+
+  /** Breadth first search over the compact graph. */
+  int visitAll(CompactStreetGraph const& graph)
+  {
+    std::vector<bool> visited(graph.numberOfIntersections(), false);
+    std::vector<CompactStreetGraph::Handle> open;
+    int numberOfVisited = 0;
+    for (CompactStreetGraph::Handle start = 0; start < graph.numberOfIntersections(); start++)
+    {
+      if (visited[start])
+      {
+        continue;
+      }
+      visited[start] = true;
+      open.push_back(start);
+      while (!open.empty())
+      {
+        CompactStreetGraph::Handle current = open.back();
+        open.pop_back();
+        numberOfVisited++;
+        for (CompactStreetGraph::Handle way = graph.firstWay(current);
+             way != graph.lastWay(current);
+             way++)
+        {
+          CompactStreetGraph::Handle next = graph.wayTarget(way);
+          if (!visited[next])
+          {
+            visited[next] = true;
+            open.push_back(next);
+          }
+        }
+      }
+    }
+    return numberOfVisited;
+  }
+}
+
+BENCHMARK(GraphStorage)
+{
+  long bytesBefore = Benchmark::allocatedBytes();
+  StreetGraph* graph = new StreetGraph();
+  Fixtures::latticeNetwork(graph, 100000);
+  long graphBytes = Benchmark::allocatedBytes() - bytesBefore;
+  int roads = graph->numberOfRoads();
+
+  bytesBefore = Benchmark::allocatedBytes();
+  CompactStreetGraph compact(graph);
+  long compactBytes = Benchmark::allocatedBytes() - bytesBefore;
+
+  std::cout << "  " << roads << " roads, " << compact.numberOfIntersections() << " intersections" << std::endl
+            << "  StreetGraph (with spatial indices): " << graphBytes / roads << " B/road" << std::endl
+            << "  CompactStreetGraph arrays:          " << compact.memoryUsage() / roads << " B/road" << std::endl
+            << "  CompactStreetGraph with handle maps: " << compactBytes / roads << " B/road" << std::endl;
+
+  /* Sum of road lengths */
+  Benchmark::Timer timer;
+  double length = 0;
+  for (int pass = 0; pass < TRAVERSALS; pass++)
+  {
+    for (StreetGraph::iterator road = graph->begin(); road != graph->end(); road++)
+    {
+      length += Vector((*road)->begining()->position(), (*road)->end()->position()).length();
+    }
+  }
+  std::stringstream label;
+  label << "road lengths, StreetGraph (" << static_cast<long>(length / TRAVERSALS) << ")";
+  Benchmark::report(label.str(), static_cast<long>(roads) * TRAVERSALS, timer.elapsed());
+
+  timer.restart();
+  length = 0;
+  for (int pass = 0; pass < TRAVERSALS; pass++)
+  {
+    for (CompactStreetGraph::Handle road = 0; road < compact.numberOfRoads(); road++)
+    {
+      length += compact.road(road).length();
+    }
+  }
+  label.str("");
+  label << "road lengths, CompactStreetGraph (" << static_cast<long>(length / TRAVERSALS) << ")";
+  Benchmark::report(label.str(), static_cast<long>(roads) * TRAVERSALS, timer.elapsed());
+
+  /* Breadth first search */
+  timer.restart();
+  int visited = 0;
+  for (int pass = 0; pass < TRAVERSALS; pass++)
+  {
+    visited = visitAll(graph);
+  }
+  label.str("");
+  label << "graph search, StreetGraph (" << visited << " visited)";
+  Benchmark::report(label.str(), static_cast<long>(visited) * TRAVERSALS, timer.elapsed());
+
+  timer.restart();
+  for (int pass = 0; pass < TRAVERSALS; pass++)
+  {
+    visited = visitAll(compact);
+  }
+  label.str("");
+  label << "graph search, CompactStreetGraph (" << visited << " visited)";
+  Benchmark::report(label.str(), static_cast<long>(visited) * TRAVERSALS, timer.elapsed());
+
+  delete graph;
+}
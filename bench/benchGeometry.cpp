@@ -0,0 +1,66 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchGeometry.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Heap traffic of geometry primitives.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <iostream>
+#include <sstream>
+
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/linesegment.h"
+
+BENCHMARK(GeometryAllocations)
+{
+  const int REPETITIONS = 100000;
+
+  long allocations = Benchmark::allocations();
+  Benchmark::Timer timer;
+  for (int i = 0; i < REPETITIONS; i++)
+  {
+    Path proposedPath(LineSegment(Point(i, 0), Point(i, 100)));
+    proposedPath.setEnd(Point(i, 50));
+    Path copy(proposedPath);
+  }
+  std::stringstream label;
+  label << "Path copies (" << (Benchmark::allocations() - allocations) / REPETITIONS << " allocations each)";
+  Benchmark::report(label.str(), REPETITIONS, timer.elapsed());
+
+  Polygon square(Point(0, 0), Point(100, 0), Point(100, 100), Point(0, 100));
+  allocations = Benchmark::allocations();
+  timer.restart();
+  for (int i = 0; i < REPETITIONS; i++)
+  {
+    Polygon copy(square);
+    copy.updateVertex(0, Point(i, 0));
+  }
+  label.str("");
+  label << "Polygon copies (" << (Benchmark::allocations() - allocations) / REPETITIONS << " allocations each)";
+  Benchmark::report(label.str(), REPETITIONS, timer.elapsed());
+}
+
+BENCHMARK(CityAllocations)
+{
+  long allocations = Benchmark::allocations();
+  Benchmark::Timer timer;
+
+  Fixtures::SampleCity city(10000, 150, 60);
+  city.generate();
+
+  double seconds = timer.elapsed();
+  long cityAllocations = Benchmark::allocations() - allocations;
+
+  std::cout << "  " << city.numberOfRoads() << " roads, " << city.numberOfZones() << " zones, "
+            << city.numberOfBlocks() << " blocks, " << city.numberOfLots() << " lots" << std::endl;
+  Benchmark::report("City::generate() heap allocations", cityAllocations, seconds);
+}
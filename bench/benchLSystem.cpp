@@ -0,0 +1,135 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchLSystem.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Rewriting speed of the LSystem storages.
+ *
+ */
+
+#include "benchmark.h"
+
+#include <vector>
+#include <sstream>
+
+#include "../src/lsystem/lsystem.h"
+#include "../src/threadpool.h"
+#include "../src/random.h"
+
+namespace
+{
+  const int ITERATIONS = 11;
+
+  /** Stochastic plant, grows about 3.3 times per iteration. */
+  void setUpPlant(LSystem* lsystem)
+  {
+    lsystem->setAlphabet("FX+-[]");
+    lsystem->setAxiom("X");
+
+    lsystem->addRule('X', "F[+X]F[-X]+X");
+    lsystem->addRule('X', "F[-X]F[+X]-X");
+    lsystem->addRule('X', "F-[[X]+X]+F[+FX]-X");
+    lsystem->addRule('F', "FF");
+  }
+
+  /** Road grammars, as set up by the patterns. */
+  struct RoadGrammar
+  {
+    const char* name;
+    const char* axiom;
+    int iterations;
+  };
+
+  /** The pattern rule plus the alternatives left commented out in the patterns. */
+  void setUpRoadGrammar(LSystem* lsystem, RoadGrammar const& grammar)
+  {
+    lsystem->setAlphabet("[]._-+E");
+    lsystem->setAxiom(grammar.axiom);
+
+    lsystem->addRule('E', "[[-_E]+_E]_E");
+    lsystem->addRule('E', "[[-_E]+_E]");
+    lsystem->addRule('E', "_E");
+  }
+
+  void measure(std::string const& name, LSystem::StorageMode mode, int threads,
+               std::string* produced)
+  {
+    LSystem lsystem;
+    lsystem.setStorageMode(mode);
+    lsystem.setRewritingThreads(threads);
+    setUpPlant(&lsystem);
+
+    Random::setSeed(libcity::RANDOM_SEED);
+    long allocations = Benchmark::allocations();
+    Benchmark::Timer timer;
+    int rewrites = lsystem.doIterations(ITERATIONS);
+    double seconds = timer.elapsed();
+    allocations = Benchmark::allocations() - allocations;
+
+    std::string result = lsystem.getProducedString();
+    std::stringstream label;
+    label << name << ", " << result.size() << " symbols, "
+          << allocations << " allocations"
+          << (produced->empty() || *produced == result ? "" : " MISMATCH");
+    Benchmark::report(label.str(), rewrites, seconds);
+
+    *produced = result;
+  }
+}
+
+BENCHMARK(LSystemRewriting)
+{
+  std::string produced;
+  measure("linked symbols", LSystem::LINKED_SYMBOLS, 1, &produced);
+  measure("contiguous, 1 thread", LSystem::CONTIGUOUS_SYMBOLS, 1, &produced);
+
+  int cores = ThreadPool::hardwareThreads();
+  if (cores > 1)
+  {
+    std::stringstream name;
+    name << "contiguous, " << cores << " threads";
+    measure(name.str(), LSystem::CONTIGUOUS_SYMBOLS, cores, &produced);
+  }
+  Random::setSeed(libcity::RANDOM_SEED);
+}
+
+BENCHMARK(LSystemDerivationScaling)
+{
+  RoadGrammar grammars[] = {{"RasterRoadPattern", "E", 20},
+                            {"OrganicRoadPattern", "[[[-_E]+_E]_E]++_E", 18}};
+
+  std::vector<int> threads;
+  for (int count = 1; count < ThreadPool::hardwareThreads(); count *= 2)
+  {
+    threads.push_back(count);
+  }
+  threads.push_back(ThreadPool::hardwareThreads());
+
+  for (unsigned int grammar = 0; grammar < sizeof(grammars)/sizeof(grammars[0]); grammar++)
+  {
+    std::string produced;
+    for (unsigned int count = 0; count < threads.size(); count++)
+    {
+      LSystem lsystem;
+      setUpRoadGrammar(&lsystem, grammars[grammar]);
+      lsystem.setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+      lsystem.setRewritingThreads(threads[count]);
+      lsystem.setDerivationSeed(libcity::RANDOM_SEED);
+
+      Benchmark::Timer timer;
+      int rewrites = lsystem.doIterations(grammars[grammar].iterations);
+      double seconds = timer.elapsed();
+
+      std::string result = lsystem.getProducedString();
+      std::stringstream label;
+      label << grammars[grammar].name << ", " << result.size() << " symbols, "
+            << threads[count] << (threads[count] == 1 ? " thread" : " threads")
+            << (produced.empty() || produced == result ? "" : " MISMATCH");
+      Benchmark::report(label.str(), rewrites, seconds);
+
+      produced = result;
+    }
+  }
+}
@@ -0,0 +1,111 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchMapWriter.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Throughput of the GeoJSON and OSM XML exports.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../src/io/outputstream.h"
+#include "../src/io/geojsonwriter.h"
+#include "../src/io/osmwriter.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/random.h"
+
+namespace
+{
+  const char* FILE_NAME = "benchMapWriter.out";
+
+  const double MEGABYTE = 1 << 20;
+
+  enum Format
+  {
+    GEOJSON,
+    OSM
+  };
+
+  /** Export the city and report bytes per second. */
+  void exportCity(Fixtures::SampleCity* city, Format format, bool inBackground)
+  {
+    int descriptor = open(FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    OutputStream stream(descriptor, OutputStream::DEFAULT_BUFFER_SIZE, inBackground);
+
+    Benchmark::Timer timer;
+    bool written;
+    if (format == GEOJSON)
+    {
+      GeoJsonWriter writer(&stream);
+      writer.setOrigin(50.08, 14.42);
+      written = city->write(&writer);
+    }
+    else
+    {
+      OsmWriter writer(&stream);
+      written = city->write(&writer);
+    }
+    double seconds = timer.elapsed();
+    close(descriptor);
+
+    std::stringstream label;
+    label << (format == GEOJSON ? "GeoJsonWriter" : "OsmWriter")
+          << (inBackground ? ", background" : ", synchronous")
+          << ", bytes (" << stream.bytesWritten() / MEGABYTE << " MB)"
+          << (written ? "" : " FAILED");
+    Benchmark::report(label.str(), stream.bytesWritten(), seconds);
+  }
+}
+
+BENCHMARK(MapWriterExport)
+{
+  Random::setSeed(libcity::RANDOM_SEED);
+  Fixtures::SampleCity city(20000, 600, 60);
+  city.setSeed(libcity::RANDOM_SEED);
+  city.generate();
+
+  exportCity(&city, GEOJSON, false);
+  exportCity(&city, GEOJSON, true);
+  exportCity(&city, OSM, false);
+  exportCity(&city, OSM, true);
+  std::remove(FILE_NAME);
+}
+
+BENCHMARK(MapWriterLargeGraph)
+{
+  StreetGraph graph;
+  Fixtures::latticeNetwork(&graph, 300000);
+
+  std::stringstream name;
+  name << graph.numberOfRoads() << " roads";
+
+  /* The graph formatted into memory by iostreams for comparison */
+  Benchmark::Timer timer;
+  std::string text = graph.toString();
+  Benchmark::report("StreetGraph::toString, bytes, " + name.str(), text.size(), timer.elapsed());
+  text.clear();
+  text.shrink_to_fit();
+
+  int descriptor = open(FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  {
+    OutputStream stream(descriptor);
+    GeoJsonWriter writer(&stream);
+    timer.restart();
+    writer.writeStreetGraph(&graph);
+    bool written = writer.finish();
+    Benchmark::report("GeoJsonWriter::writeStreetGraph, bytes, " + name.str() + (written ? "" : " FAILED"),
+                      stream.bytesWritten(), timer.elapsed());
+  }
+  close(descriptor);
+  std::remove(FILE_NAME);
+}
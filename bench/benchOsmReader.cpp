@@ -0,0 +1,163 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchOsmReader.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Import of OSM XML files written by OsmWriter.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <sstream>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../src/io/osmreader.h"
+#include "../src/io/osmwriter.h"
+#include "../src/io/outputstream.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/random.h"
+
+namespace
+{
+  const char* FILE_NAME = "benchOsmReader.osm";
+
+  /** Nodes of a street of the extract, about 100 m apart. */
+  const int NODES_PER_WAY = 10;
+  const double SPACING = 0.001;
+
+  /**
+    Write a city-like extract: a jittered grid of side x side
+    nodes with streets along the rows and columns, a footway
+    and a duplicated node in each cell.
+   @return Number of road segments in the file.
+   */
+  int writeExtract(int side)
+  {
+    Random generator(libcity::RANDOM_SEED);
+    int descriptor = open(FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    OutputStream output(descriptor);
+
+    output.write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<osm version=\"0.6\">\n");
+    output.write(" <bounds minlat=\"50\" minlon=\"14\" maxlat=\"");
+    output.writeFixed(50 + side * SPACING, 7);
+    output.write("\" maxlon=\"");
+    output.writeFixed(14 + side * SPACING, 7);
+    output.write("\"/>\n");
+
+    long long nodes = side * side;
+    for (long long node = 0; node < nodes; node++)
+    {
+      double latitude = 50 + (node / side) * SPACING + generator.generateDouble(-5e-5, 5e-5);
+      double longitude = 14 + (node % side) * SPACING + generator.generateDouble(-5e-5, 5e-5);
+      for (int copy = 0; copy < 2; copy++)
+      /* The copy is a few centimeters away */
+      {
+        output.write(" <node id=\"");
+        output.writeInteger(1 + node + copy * nodes);
+        output.write("\" version=\"1\" lat=\"");
+        output.writeFixed(latitude + copy * 2e-7, 7);
+        output.write("\" lon=\"");
+        output.writeFixed(longitude, 7);
+        output.write("\"/>\n");
+      }
+    }
+
+    long long way = 0;
+    int segments = 0;
+    for (int line = 0; line < side; line++)
+    {
+      for (int direction = 0; direction < 2; direction++)
+      {
+        for (int first = 0; first + 1 < side; first += NODES_PER_WAY - 1)
+        {
+          output.write(" <way id=\"");
+          output.writeInteger(++way);
+          output.write("\" version=\"1\">\n");
+          for (int position = first; position < side && position < first + NODES_PER_WAY; position++)
+          {
+            long long node = direction == 0 ? line * side + position : position * side + line;
+            /* Every other street uses the copies */
+            output.write("  <nd ref=\"");
+            output.writeInteger(1 + node + (line % 2) * nodes);
+            output.write("\"/>\n");
+            segments += position > first;
+          }
+          output.write("  <tag k=\"highway\" v=\"");
+          output.write(line % 10 == 0 ? "primary" : "residential");
+          output.write("\"/>\n  <tag k=\"name\" v=\"Street &amp; Co.\"/>\n </way>\n");
+        }
+      }
+
+      /* Footways aren't roads */
+      output.write(" <way id=\"");
+      output.writeInteger(++way);
+      output.write("\" version=\"1\">\n  <nd ref=\"");
+      output.writeInteger(1 + line * side);
+      output.write("\"/>\n  <nd ref=\"");
+      output.writeInteger(1 + ((line + 1) % side) * side + 1);
+      output.write("\"/>\n  <tag k=\"highway\" v=\"footway\"/>\n </way>\n");
+    }
+    output.write("</osm>\n");
+    output.flush();
+    close(descriptor);
+
+    return segments;
+  }
+
+  /** Read the file and report ways per second. */
+  void import(std::string const& name, int roads)
+  {
+    StreetGraph graph;
+    OsmReader reader;
+    reader.setOrigin(0, 0);
+
+    Benchmark::Timer timer;
+    bool read = reader.read(FILE_NAME, &graph);
+    double seconds = timer.elapsed();
+
+    std::stringstream label;
+    label << "OsmReader::read, ways, " << name
+          << (!read ? " FAILED" : graph.numberOfRoads() == roads ? "" : " MISMATCH");
+    Benchmark::report(label.str(), reader.numberOfWays(), seconds);
+  }
+}
+
+BENCHMARK(OsmReaderCity)
+{
+  Random::setSeed(libcity::RANDOM_SEED);
+  Fixtures::SampleCity city(20000, 600, 60);
+  city.setSeed(libcity::RANDOM_SEED);
+  city.generate();
+
+  int descriptor = open(FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  {
+    OutputStream stream(descriptor);
+    OsmWriter writer(&stream);
+    city.write(&writer);
+  }
+  close(descriptor);
+
+  /* Peak memory includes the generated city here */
+  import("20000 m city written by OsmWriter", city.numberOfRoads());
+  std::remove(FILE_NAME);
+}
+
+BENCHMARK(OsmReaderExtract)
+{
+  int sides[] = {200, 600};
+  for (unsigned int side = 0; side < sizeof(sides)/sizeof(sides[0]); side++)
+  {
+    int roads = writeExtract(sides[side]);
+
+    std::stringstream name;
+    name << roads << " road segments";
+    import(name.str(), roads);
+  }
+  std::remove(FILE_NAME);
+}
@@ -0,0 +1,147 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchPipeline.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Stages of the city generation pipeline, measured
+ *        separately for cities of growing size.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <vector>
+#include <sstream>
+#include <cmath>
+
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/triangulator.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/units.h"
+#include "../src/random.h"
+
+namespace
+{
+  /** Sample city reporting each stage as it finishes. */
+  class StagedCity : public Fixtures::SampleCity
+  {
+    public:
+      StagedCity(double size, int primaryRoads, std::string const& cityName)
+        : Fixtures::SampleCity(size, primaryRoads, 60), name(cityName)
+      {}
+
+    protected:
+      virtual void createPrimaryRoadNetwork()
+      {
+        Benchmark::Timer timer;
+        Fixtures::SampleCity::createPrimaryRoadNetwork();
+        report("OrganicRoadPattern::generateRoads", numberOfRoads(), timer.elapsed());
+      }
+
+      virtual void createZones()
+      {
+        Benchmark::Timer timer;
+        Fixtures::SampleCity::createZones();
+        report("StreetGraph::findZones", numberOfZones(), timer.elapsed());
+      }
+
+      virtual void createSecondaryRoadNetwork()
+      {
+        int primaryRoads = numberOfRoads();
+        Benchmark::Timer timer;
+        Fixtures::SampleCity::createSecondaryRoadNetwork();
+        report("RasterRoadPattern::generateRoads", numberOfRoads() - primaryRoads, timer.elapsed());
+      }
+
+      virtual void createBlocks()
+      {
+        Benchmark::Timer timer;
+        Fixtures::SampleCity::createBlocks();
+        report("Zone::createBlocks", numberOfBlocks(), timer.elapsed());
+      }
+
+      virtual void createBuildings()
+      {
+        Benchmark::Timer timer;
+        Fixtures::SampleCity::createBuildings();
+        report("Block::createLots", numberOfLots(), timer.elapsed());
+      }
+
+    private:
+      std::string name;
+
+      void report(std::string const& stage, long operations, double seconds)
+      {
+        Benchmark::report(stage + ", " + name, operations, seconds);
+      }
+  };
+
+  /** Polygon shaped like a star with the given number of vertices. */
+  Polygon star(int vertices)
+  {
+    Polygon polygon;
+    for (int i = 0; i < vertices; i++)
+    {
+      double angle = i * 2 * libcity::PI / vertices,
+             radius = i % 2 ? 300 : 500;
+      polygon.addVertex(Point(500 + radius * std::cos(angle), 500 + radius * std::sin(angle)));
+    }
+    return polygon;
+  }
+}
+
+BENCHMARK(PipelineStages)
+{
+  struct { double size; int primaryRoads; } cities[] = {{5000, 40}, {10000, 150}, {20000, 600}};
+  for (unsigned int city = 0; city < sizeof(cities)/sizeof(cities[0]); city++)
+  {
+    std::stringstream name;
+    name << cities[city].size << " m city";
+
+    Random::setSeed(libcity::RANDOM_SEED);
+    StagedCity staged(cities[city].size, cities[city].primaryRoads, name.str());
+    staged.setSeed(libcity::RANDOM_SEED);
+
+    Benchmark::Timer timer;
+    staged.generate();
+    Benchmark::report("City::generate, " + name.str(), staged.numberOfLots(), timer.elapsed());
+  }
+}
+
+BENCHMARK(PolygonTriangulation)
+{
+  const int VERTICES = 1000000;
+
+  int sizes[] = {4, 16, 64, 256};
+  for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+  {
+    Polygon polygon = star(sizes[size]);
+    int repetitions = VERTICES / sizes[size];
+    long triangles = 0;
+
+    Benchmark::Timer timer;
+    for (int i = 0; i < repetitions; i++)
+    {
+      triangles += polygon.triangulate().size() / 3;
+    }
+    std::stringstream label;
+    label << "Polygon::triangulate, " << sizes[size] << " vertices";
+    Benchmark::report(label.str(), triangles, timer.elapsed());
+
+    Triangulator triangulator;
+    std::vector<int> indexes;
+    triangles = 0;
+    timer.restart();
+    for (int i = 0; i < repetitions; i++)
+    {
+      triangulator.triangulate(polygon, &indexes);
+      triangles += indexes.size() / 3;
+    }
+    label.str("");
+    label << "Triangulator::triangulate, " << sizes[size] << " vertices";
+    Benchmark::report(label.str(), triangles, timer.elapsed());
+  }
+}
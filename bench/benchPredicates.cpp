@@ -0,0 +1,123 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchPredicates.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Throughput of the exact predicates.
+ *
+ * Random points are decided by the filter alone, nearly
+ * collinear and cocircular ones need the exact fallback.
+ */
+
+#include "benchmark.h"
+
+#include <vector>
+#include <cmath>
+#include <sstream>
+
+#include "../src/geometry/predicates.h"
+#include "../src/geometry/point.h"
+#include "../src/random.h"
+#include "../src/geometry/units.h"
+
+namespace
+{
+  const int POINTS = 1000000;
+
+  /** Points on the line y = x with the last bit of y flipped randomly. */
+  std::vector<Point> nearlyCollinear(Random* generator)
+  {
+    std::vector<Point> points;
+    points.reserve(POINTS);
+    for (int i = 0; i < POINTS; i++)
+    {
+      double x = generator->generateDouble(0, 1000);
+      points.push_back(Point(x, generator->generateBool(0.5) ? std::nextafter(x, 2000.0) : x));
+    }
+    return points;
+  }
+
+  std::vector<Point> randomPoints(Random* generator)
+  {
+    std::vector<Point> points;
+    points.reserve(POINTS);
+    for (int i = 0; i < POINTS; i++)
+    {
+      points.push_back(Point(generator->generateDouble(0, 1000), generator->generateDouble(0, 1000)));
+    }
+    return points;
+  }
+
+  /** Points on a circle around (500, 500), rounded to doubles. Most
+      of them need the exact test, so there are fewer of them. */
+  std::vector<Point> nearlyCocircular(Random* generator)
+  {
+    std::vector<Point> points;
+    points.reserve(POINTS / 10);
+    for (int i = 0; i < POINTS / 10; i++)
+    {
+      double angle = generator->generateDouble(0, 2 * libcity::PI);
+      points.push_back(Point(500 + 400 * std::cos(angle), 500 + 400 * std::sin(angle)));
+    }
+    return points;
+  }
+
+  int naiveOrientation(Point const& a, Point const& b, Point const& c)
+  {
+    double determinant = (a.x() - c.x()) * (b.y() - c.y()) - (a.y() - c.y()) * (b.x() - c.x());
+    return (determinant > 0) - (determinant < 0);
+  }
+
+  void reportOrientation(std::string const& label, std::vector<Point> const& points)
+  {
+    int checksum = 0;
+    Benchmark::Timer timer;
+    for (int i = 2; i < POINTS; i++)
+    {
+      checksum += naiveOrientation(points[i - 2], points[i - 1], points[i]);
+    }
+    double naiveSeconds = timer.elapsed();
+
+    int exactChecksum = 0;
+    timer.restart();
+    for (int i = 2; i < POINTS; i++)
+    {
+      exactChecksum += Predicates::orientation(points[i - 2], points[i - 1], points[i]);
+    }
+    double exactSeconds = timer.elapsed();
+
+    std::stringstream naiveLabel, exactLabel;
+    naiveLabel << label << ", doubles (checksum " << checksum << ")";
+    exactLabel << label << ", exact (checksum " << exactChecksum << ")";
+    Benchmark::report(naiveLabel.str(), POINTS - 2, naiveSeconds);
+    Benchmark::report(exactLabel.str(), POINTS - 2, exactSeconds);
+  }
+
+  void reportInCircle(std::string const& label, std::vector<Point> const& points)
+  {
+    int checksum = 0;
+    Benchmark::Timer timer;
+    for (unsigned int i = 3; i < points.size(); i++)
+    {
+      checksum += Predicates::inCircle(points[i - 3], points[i - 2], points[i - 1], points[i]);
+    }
+    std::stringstream fullLabel;
+    fullLabel << label << " (checksum " << checksum << ")";
+    Benchmark::report(fullLabel.str(), points.size() - 3, timer.elapsed());
+  }
+}
+
+BENCHMARK(Predicates)
+{
+  Random generator(libcity::RANDOM_SEED);
+  std::vector<Point> random = randomPoints(&generator),
+                     collinear = nearlyCollinear(&generator),
+                     cocircular = nearlyCocircular(&generator);
+
+  reportOrientation("Orientation of random points", random);
+  reportOrientation("Orientation of nearly collinear points", collinear);
+  reportInCircle("In-circle test of random points", random);
+  reportInCircle("In-circle test of nearly cocircular points", cocircular);
+}
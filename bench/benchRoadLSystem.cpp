@@ -0,0 +1,106 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchRoadLSystem.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Performance of road generation constraints.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <sstream>
+#include <cmath>
+
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/organicroadpattern.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/polygon.h"
+#include "../src/random.h"
+
+namespace
+{
+  /** Exposes the local constraints of the road generator. */
+  class ConstrainedGrowth : public OrganicRoadPattern
+  {
+    public:
+      bool constrain(Path* proposedPath)
+      {
+        return localConstraints(proposedPath);
+      }
+  };
+}
+
+BENCHMARK(RoadLocalConstraints)
+{
+  int sizes[] = {1000, 10000, 100000};
+  for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+  {
+    StreetGraph graph;
+    double extent = Fixtures::latticeNetwork(&graph, sizes[size]);
+    int initialRoads = graph.numberOfRoads();
+
+    ConstrainedGrowth generator;
+    generator.setTarget(&graph);
+    generator.setSnapDistance(50);
+
+    Random random(libcity::RANDOM_SEED);
+    int proposals = 20000, accepted = 0;
+    Benchmark::Timer timer;
+    for (int i = 0; i < proposals; i++)
+    {
+      Point begining(random.generateDouble(0, extent), random.generateDouble(0, extent));
+      double angle  = random.generateDouble(0, 2 * M_PI),
+             length = random.generateDouble(200, 400);
+      Path proposedPath(LineSegment(begining, Point(begining.x() + length * std::cos(angle),
+                                                    begining.y() + length * std::sin(angle))));
+      if (generator.constrain(&proposedPath))
+      {
+        graph.addRoad(proposedPath);
+        accepted++;
+      }
+    }
+    double seconds = timer.elapsed();
+
+    std::stringstream label;
+    label << "RoadLSystem::localConstraints, " << initialRoads << " roads ("
+          << accepted << " generated)";
+    Benchmark::report(label.str(), proposals, seconds);
+
+    label.str("");
+    label << "  generated roads";
+    Benchmark::report(label.str(), accepted, seconds);
+  }
+}
+
+BENCHMARK(RoadGeneration)
+{
+  const int STEP = 1000, STEPS = 8;
+
+  StreetGraph graph;
+  OrganicRoadPattern generator;
+  generator.setTarget(&graph);
+  generator.setAreaConstraints(new Polygon(Point(-50000, -50000), Point(50000, -50000),
+                                           Point(50000, 50000), Point(-50000, 50000)));
+  generator.setRoadLength(200, 400);
+  generator.setSnapDistance(50);
+
+  /* Rate of each step, it shouldn't drop as the string grows */
+  for (int step = 0; step < STEPS; step++)
+  {
+    int roads = graph.numberOfRoads();
+    Benchmark::Timer timer;
+    generator.generateRoads(STEP);
+    double seconds = timer.elapsed();
+
+    std::stringstream label;
+    label << "RoadLSystem::generateRoads, " << roads << " -> " << graph.numberOfRoads()
+          << " roads, " << generator.getProducedString().size() << " symbols";
+    Benchmark::report(label.str(), graph.numberOfRoads() - roads, seconds);
+  }
+}
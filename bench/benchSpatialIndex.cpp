@@ -0,0 +1,297 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchSpatialIndex.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Viewport queries with SpatialIndex compared to walking the areas.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <list>
+#include <vector>
+#include <sstream>
+#include <cmath>
+
+#include "../src/area/spatialindex.h"
+#include "../src/area/zone.h"
+#include "../src/area/block.h"
+#include "../src/area/lot.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/random.h"
+
+namespace
+{
+  const int QUERIES = 10000;
+
+  /* Million lots of the synthetic city */
+  const int LOTS_PER_BLOCK = 10;   /**< Along each side of a block. */
+  const int BLOCKS_PER_ZONE = 10;  /**< Along each side of a zone. */
+  const int ZONES = 10;            /**< Along each side of the city. */
+  const double LOT_SIZE = 12;
+
+  /**
+    Zones of blocks of slightly skewed lots on a square grid.
+   @remarks
+     The blocks and lots are added to the zones, but nobody
+     owns them, they are freed with the city.
+   */
+  class LotGrid
+  {
+    public:
+      LotGrid()
+        : graph()
+      {
+        CounterRandom generator(libcity::RANDOM_SEED);
+        int lotsPerSide = LOTS_PER_BLOCK * BLOCKS_PER_ZONE * ZONES;
+        double zoneSize = LOT_SIZE * LOTS_PER_BLOCK * BLOCKS_PER_ZONE;
+        double blockSize = LOT_SIZE * LOTS_PER_BLOCK;
+
+        for (int zoneIndex = 0; zoneIndex < ZONES * ZONES; zoneIndex++)
+        {
+          double zoneX = (zoneIndex % ZONES) * zoneSize, zoneY = (zoneIndex / ZONES) * zoneSize;
+          Zone* zone = new Zone(&graph);
+          zone->setAreaConstraints(rectangle(zoneX, zoneY, zoneSize, zoneSize));
+          zones.push_back(zone);
+
+          for (int blockIndex = 0; blockIndex < BLOCKS_PER_ZONE * BLOCKS_PER_ZONE; blockIndex++)
+          {
+            double blockX = zoneX + (blockIndex % BLOCKS_PER_ZONE) * blockSize,
+                   blockY = zoneY + (blockIndex / BLOCKS_PER_ZONE) * blockSize;
+            Block* block = new Block(zone, rectangle(blockX, blockY, blockSize, blockSize));
+            zone->addBlock(block);
+            blocks.push_back(block);
+
+            for (int lotIndex = 0; lotIndex < LOTS_PER_BLOCK * LOTS_PER_BLOCK; lotIndex++)
+            {
+              double x = blockX + (lotIndex % LOTS_PER_BLOCK) * LOT_SIZE,
+                     y = blockY + (lotIndex / LOTS_PER_BLOCK) * LOT_SIZE;
+              unsigned long long cell = static_cast<unsigned long long>(y / LOT_SIZE) * lotsPerSide + x / LOT_SIZE;
+              double skew = generator.generateDouble(cell, 0, -0.2, 0.2) * LOT_SIZE;
+              Polygon area(Point(x, y), Point(x + LOT_SIZE, y),
+                           Point(x + LOT_SIZE + skew, y + LOT_SIZE), Point(x + skew, y + LOT_SIZE));
+              Lot* lot = new Lot(block, area);
+              block->addLot(lot);
+              lots.push_back(lot);
+            }
+          }
+        }
+      }
+
+      ~LotGrid()
+      {
+        for (std::vector<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          delete *lot;
+        }
+        for (std::vector<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+        {
+          delete *block;
+        }
+        for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+        {
+          delete *zone;
+        }
+      }
+
+      double size() const
+      {
+        return ZONES * BLOCKS_PER_ZONE * LOTS_PER_BLOCK * LOT_SIZE;
+      }
+
+      void index(SpatialIndex* spatialIndex)
+      {
+        spatialIndex->clear();
+        for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+        {
+          spatialIndex->insert(*zone);
+        }
+        for (std::vector<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+        {
+          spatialIndex->insert(*block);
+        }
+        for (std::vector<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          spatialIndex->insert(*lot);
+        }
+        spatialIndex->build();
+      }
+
+      StreetGraph graph;
+      std::list<Zone*> zones;
+      std::vector<Block*> blocks;
+      std::vector<Lot*> lots;
+
+    private:
+      static Polygon rectangle(double x, double y, double width, double height)
+      {
+        return Polygon(Point(x, y), Point(x + width, y), Point(x + width, y + height), Point(x, y + height));
+      }
+  };
+
+  /**
+    Ground footprint of a tilted camera, a trapezoid from the
+    near edge to the far edge of the view.
+   */
+  Polygon frustumFootprint(Point const& eye, double heading,
+                           double nearDistance, double farDistance, double halfAngle)
+  {
+    double directionX = std::cos(heading), directionY = std::sin(heading);
+    double sideX = -directionY, sideY = directionX;
+    double nearHalf = nearDistance * std::tan(halfAngle), farHalf = farDistance * std::tan(halfAngle);
+
+    Point nearCenter(eye.x() + directionX * nearDistance, eye.y() + directionY * nearDistance);
+    Point farCenter(eye.x() + directionX * farDistance, eye.y() + directionY * farDistance);
+    return Polygon(Point(nearCenter.x() - sideX * nearHalf, nearCenter.y() - sideY * nearHalf),
+                   Point(nearCenter.x() + sideX * nearHalf, nearCenter.y() + sideY * nearHalf),
+                   Point(farCenter.x() + sideX * farHalf, farCenter.y() + sideY * farHalf),
+                   Point(farCenter.x() - sideX * farHalf, farCenter.y() - sideY * farHalf));
+  }
+
+  /** Random rectangles of the given side, reports the average number of lots. */
+  void queryRectangles(SpatialIndex const& index, double minimum, double maximum,
+                       double side, std::string const& name)
+  {
+    CounterRandom generator(libcity::RANDOM_SEED);
+    SpatialIndex::Result result;
+    long found = 0;
+
+    Benchmark::Timer timer;
+    for (int query = 0; query < QUERIES; query++)
+    {
+      double x = generator.generateDouble(query, 0, minimum, maximum - side),
+             y = generator.generateDouble(query, 1, minimum, maximum - side);
+      index.query(x, y, x + side, y + side, &result);
+      found += result.lots.size();
+    }
+    double seconds = timer.elapsed();
+
+    std::stringstream label;
+    label << "rectangle " << side << " m, " << name << ", "
+          << found / QUERIES << " lots per query, " << 1e6 * seconds / QUERIES << " us per query";
+    Benchmark::report(label.str(), QUERIES, seconds);
+  }
+
+  /** Random camera positions and headings, reports the average number of lots. */
+  void queryFootprints(SpatialIndex const& index, double minimum, double maximum,
+                       double farDistance, std::string const& name)
+  {
+    CounterRandom generator(libcity::RANDOM_SEED);
+    SpatialIndex::Result result;
+    long found = 0;
+
+    std::vector<Polygon> footprints;
+    footprints.reserve(QUERIES);
+    for (int query = 0; query < QUERIES; query++)
+    {
+      Point eye(generator.generateDouble(query, 0, minimum, maximum),
+                generator.generateDouble(query, 1, minimum, maximum));
+      double heading = generator.generateDouble(query, 2, 0, 2 * M_PI);
+      footprints.push_back(frustumFootprint(eye, heading, farDistance / 20, farDistance, M_PI / 6));
+    }
+
+    Benchmark::Timer timer;
+    for (int query = 0; query < QUERIES; query++)
+    {
+      index.query(footprints[query], &result);
+      found += result.lots.size();
+    }
+    double seconds = timer.elapsed();
+
+    std::stringstream label;
+    label << "frustum footprint " << farDistance << " m, " << name << ", "
+          << found / QUERIES << " lots per query, " << 1e6 * seconds / QUERIES << " us per query";
+    Benchmark::report(label.str(), QUERIES, seconds);
+  }
+
+  /** What a renderer does without the index, every lot is tested. */
+  int walkAreas(std::list<Zone*> const& zones, double minX, double minY, double maxX, double maxY)
+  {
+    int found = 0;
+    for (std::list<Zone*>::const_iterator zone = zones.begin(); zone != zones.end(); zone++)
+    {
+      std::list<Block*> blocks = (*zone)->getBlocks();
+      for (std::list<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+      {
+        std::list<Lot*> lots = (*block)->getLots();
+        for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          Polygon area = (*lot)->areaConstraints();
+          bool left = true, right = true, below = true, above = true;
+          for (unsigned int i = 0; i < area.numberOfVertices(); i++)
+          {
+            Point vertex = area.vertex(i);
+            left = left && vertex.x() < minX;
+            right = right && vertex.x() > maxX;
+            below = below && vertex.y() < minY;
+            above = above && vertex.y() > maxY;
+          }
+          found += !(left || right || below || above);
+        }
+      }
+    }
+    return found;
+  }
+}
+
+BENCHMARK(SpatialIndexSampleCity)
+{
+  Fixtures::SampleCity city(30000, 1200, 60);
+  city.setSeed(42);
+  city.generate();
+
+  std::stringstream name;
+  name << city.numberOfLots() << " lots";
+
+  SpatialIndex index;
+  Benchmark::Timer timer;
+  city.buildSpatialIndex(&index);
+  Benchmark::report("City::buildSpatialIndex, " + name.str(), index.size(), timer.elapsed());
+
+  queryRectangles(index, -15000, 15000, 500, name.str());
+  queryFootprints(index, -15000, 15000, 2000, name.str());
+}
+
+BENCHMARK(SpatialIndexMillionLots)
+{
+  LotGrid grid;
+
+  std::stringstream name;
+  name << grid.lots.size() << " lots";
+
+  SpatialIndex index;
+  Benchmark::Timer timer;
+  grid.index(&index);
+  Benchmark::report("SpatialIndex::build, " + name.str(), index.size(), timer.elapsed());
+
+  queryRectangles(index, 0, grid.size(), 100, name.str());
+  queryRectangles(index, 0, grid.size(), 500, name.str());
+  queryRectangles(index, 0, grid.size(), 2000, name.str());
+  queryFootprints(index, 0, grid.size(), 500, name.str());
+  queryFootprints(index, 0, grid.size(), 2000, name.str());
+
+  /* The same rectangles without the index */
+  CounterRandom generator(libcity::RANDOM_SEED);
+  const int WALKS = 5;
+  double side = 500;
+  long found = 0;
+  timer.restart();
+  for (int query = 0; query < WALKS; query++)
+  {
+    double x = generator.generateDouble(query, 0, 0, grid.size() - side),
+           y = generator.generateDouble(query, 1, 0, grid.size() - side);
+    found += walkAreas(grid.zones, x, y, x + side, y + side);
+  }
+  double seconds = timer.elapsed();
+
+  std::stringstream label;
+  label << "walking zones, blocks and lots, rectangle " << side << " m, " << name.str() << ", "
+        << found / WALKS << " lots per query, " << 1e6 * seconds / WALKS << " us per query";
+  Benchmark::report(label.str(), WALKS, seconds);
+}
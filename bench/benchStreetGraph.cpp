@@ -0,0 +1,302 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchStreetGraph.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Performance of StreetGraph construction and queries.
+ *
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <list>
+#include <sstream>
+
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/intersectiongrid.h"
+#include "../src/streetgraph/path.h"
+#include "../src/streetgraph/areaextractor.h"
+#include "../src/area/zone.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/random.h"
+
+namespace
+{
+  /** Positions on a jittered lattice, every fifth one repeated. */
+  std::vector<Point> intersectionPositions(int count)
+  {
+    std::vector<Point> positions;
+    Random generator(libcity::RANDOM_SEED);
+    int side = 1;
+    while (side * side < count)
+    {
+      side++;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+      if (i % 5 == 4)
+      {
+        positions.push_back(positions[generator.generateInteger(0, positions.size() - 1)]);
+        continue;
+      }
+      positions.push_back(Point((i % side) * 150 + generator.generateDouble(-30, 30),
+                                (i / side) * 150 + generator.generateDouble(-30, 30)));
+    }
+
+    return positions;
+  }
+
+  /** The search StreetGraph used before it had the index. */
+  Intersection* linearAddIntersection(std::list<Intersection*>* intersections, Point const& position)
+  {
+    for (std::list<Intersection*>::iterator intersection = intersections->begin();
+         intersection != intersections->end();
+         intersection++)
+    {
+      if ((*intersection)->position() == position)
+      {
+        return *intersection;
+      }
+    }
+
+    Intersection* newIntersection = new Intersection(position);
+    intersections->push_back(newIntersection);
+    return newIntersection;
+  }
+
+  Intersection* gridAddIntersection(std::list<Intersection*>* intersections,
+                                    IntersectionGrid* index, Point const& position)
+  {
+    Intersection* existing = index->find(position);
+    if (existing != 0)
+    {
+      return existing;
+    }
+
+    Intersection* newIntersection = new Intersection(position);
+    intersections->push_back(newIntersection);
+    index->insert(newIntersection);
+    return newIntersection;
+  }
+
+  /** Short random segments, crossing each other now and then. */
+  std::vector<LineSegment> roadSegments(int count)
+  {
+    std::vector<LineSegment> segments;
+    Random generator(libcity::RANDOM_SEED);
+    int side = 1;
+    while (side * side < count)
+    {
+      side++;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+      Point begining((i % side) * 100 + generator.generateDouble(-40, 40),
+                     (i / side) * 100 + generator.generateDouble(-40, 40));
+      Point end(begining.x() + generator.generateDouble(-120, 120),
+                begining.y() + generator.generateDouble(-120, 120));
+      segments.push_back(LineSegment(begining, end));
+    }
+
+    return segments;
+  }
+
+  /** Streets of a square grid, each block side is a separate segment. */
+  std::vector<LineSegment> gridSegments(int count)
+  {
+    std::vector<LineSegment> segments;
+    int side = 1;
+    while (2 * side * (side + 1) < count)
+    {
+      side++;
+    }
+
+    for (int i = 0; i <= side; i++)
+    {
+      for (int j = 0; j < side && static_cast<int>(segments.size()) < count; j++)
+      {
+        segments.push_back(LineSegment(Point(i * 100, j * 100), Point(i * 100, (j + 1) * 100)));
+        segments.push_back(LineSegment(Point(j * 100, i * 100), Point((j + 1) * 100, i * 100)));
+      }
+    }
+
+    return segments;
+  }
+
+  void freeIntersections(std::list<Intersection*>* intersections)
+  {
+    while (!intersections->empty())
+    {
+      delete intersections->back();
+      intersections->pop_back();
+    }
+  }
+}
+
+BENCHMARK(IntersectionInsertion)
+{
+  int sizes[] = {1000, 5000, 20000, 50000};
+  for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+  {
+    std::vector<Point> positions = intersectionPositions(sizes[size]);
+    std::list<Intersection*> intersections;
+    std::stringstream label;
+
+    if (sizes[size] <= 20000)
+    /* Quadratic, the largest size would take minutes. */
+    {
+      Benchmark::Timer timer;
+      for (unsigned int i = 0; i < positions.size(); i++)
+      {
+        linearAddIntersection(&intersections, positions[i]);
+      }
+      label << "linear scan, " << sizes[size] << " intersections";
+      Benchmark::report(label.str(), positions.size(), timer.elapsed());
+      freeIntersections(&intersections);
+    }
+
+    IntersectionGrid index;
+    Benchmark::Timer timer;
+    for (unsigned int i = 0; i < positions.size(); i++)
+    {
+      gridAddIntersection(&intersections, &index, positions[i]);
+    }
+    label.str("");
+    label << "uniform grid, " << sizes[size] << " intersections";
+    Benchmark::report(label.str(), positions.size(), timer.elapsed());
+    freeIntersections(&intersections);
+  }
+}
+
+BENCHMARK(IntersectionLookup)
+{
+  StreetGraph graph;
+  int side = 60;
+  for (int i = 0; i < side; i++)
+  {
+    graph.addRoad(Path(LineSegment(Point(i * 100, 0), Point(i * 100, 50))));
+  }
+
+  std::vector<Point> queries = intersectionPositions(200000);
+  Benchmark::Timer timer;
+  int found = 0;
+  for (unsigned int i = 0; i < queries.size(); i++)
+  {
+    found += graph.isIntersectionAtPosition(queries[i]) ? 1 : 0;
+  }
+  std::stringstream label;
+  label << "StreetGraph::isIntersectionAtPosition, " << found << " hits";
+  Benchmark::report(label.str(), queries.size(), timer.elapsed());
+}
+
+BENCHMARK(RoadInsertion)
+{
+  int sizes[] = {1000, 5000, 20000};
+  for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+  {
+    std::vector<LineSegment> segments = roadSegments(sizes[size]);
+    StreetGraph graph;
+
+    Benchmark::Timer timer;
+    for (unsigned int i = 0; i < segments.size(); i++)
+    {
+      graph.addRoad(Path(segments[i]));
+    }
+    double seconds = timer.elapsed();
+
+    std::stringstream label;
+    label << "StreetGraph::addRoad, " << sizes[size] << " paths -> "
+          << graph.getRoads().size() << " roads";
+    Benchmark::report(label.str(), segments.size(), seconds);
+  }
+}
+
+BENCHMARK(BatchRoadInsertion)
+{
+  const int SIZE = 100000;
+  std::vector<LineSegment> inputs[] = {roadSegments(SIZE), gridSegments(SIZE)};
+  const char* names[] = {"random", "grid"};
+
+  for (unsigned int input = 0; input < sizeof(inputs)/sizeof(inputs[0]); input++)
+  {
+    std::vector<Path> paths;
+    for (unsigned int i = 0; i < inputs[input].size(); i++)
+    {
+      paths.push_back(Path(inputs[input][i]));
+    }
+
+    StreetGraph sequential;
+    Benchmark::Timer timer;
+    for (unsigned int i = 0; i < paths.size(); i++)
+    {
+      sequential.addRoad(paths[i]);
+    }
+    std::stringstream label;
+    label << "StreetGraph::addRoad, " << paths.size() << " " << names[input]
+          << " paths -> " << sequential.numberOfRoads() << " roads";
+    Benchmark::report(label.str(), paths.size(), timer.elapsed());
+
+    StreetGraph batch;
+    timer.restart();
+    batch.addRoads(paths);
+    label.str("");
+    label << "StreetGraph::addRoads, " << paths.size() << " " << names[input]
+          << " paths -> " << batch.numberOfRoads() << " roads";
+    Benchmark::report(label.str(), paths.size(), timer.elapsed());
+  }
+}
+
+BENCHMARK(FaceUpdates)
+{
+  const int EDITS = 200;
+  const int RECOMPUTED_EDITS = 10;
+
+  StreetGraph graph;
+  double side = Fixtures::latticeNetwork(&graph, 50000);
+
+  Benchmark::Timer timer;
+  graph.setFaceTracking(true);
+  std::stringstream label;
+  label << "initial faces, " << graph.numberOfRoads() << " roads -> "
+        << graph.getFaces().size() << " faces";
+  Benchmark::report(label.str(), graph.numberOfRoads(), timer.elapsed());
+
+  /* Short streets across the blocks */
+  std::vector<LineSegment> edits;
+  Random generator(libcity::RANDOM_SEED);
+  for (int i = 0; i < EDITS; i++)
+  {
+    Point begining(generator.generateDouble(0, side), generator.generateDouble(0, side));
+    edits.push_back(LineSegment(begining, Point(begining.x() + generator.generateDouble(-200, 200),
+                                                begining.y() + generator.generateDouble(-200, 200))));
+  }
+
+  timer.restart();
+  for (int i = 0; i < EDITS; i++)
+  {
+    graph.addRoad(Path(edits[i]));
+  }
+  Benchmark::report("addRoad with face tracking", EDITS, timer.elapsed());
+
+  graph.setFaceTracking(false);
+  timer.restart();
+  for (int i = 0; i < RECOMPUTED_EDITS; i++)
+  {
+    graph.addRoad(Path(LineSegment(Point(edits[i].begining().x() + 37, edits[i].begining().y()),
+                                   Point(edits[i].end().x() + 37, edits[i].end().y()))));
+    std::list<Zone*> zones = graph.findZones(AreaExtractor::HALF_EDGE_FACES);
+    while (!zones.empty())
+    {
+      delete zones.back();
+      zones.pop_back();
+    }
+  }
+  Benchmark::report("addRoad and findZones from scratch", RECOMPUTED_EDITS, timer.elapsed());
+}
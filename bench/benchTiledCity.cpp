@@ -0,0 +1,111 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchTiledCity.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Memory and time of tiled and single city generation.
+ *
+ * The peak memory of a benchmark only grows, so the cities are
+ * generated from the smallest one and the peak reported with
+ * each size is the peak of that size.
+ */
+
+#include "benchmark.h"
+#include "fixtures.h"
+
+#include <sstream>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../src/tiledcity.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/geometry/polygon.h"
+#include "../src/random.h"
+
+namespace
+{
+  const char* DIRECTORY = "benchTiledCity";
+
+  /** Tiles of the size and density of the 10 km sample city. */
+  const double TILE_SIZE = 10000;
+  const int PRIMARY_ROADS_PER_TILE = 150;
+  const int SECONDARY_ROADS_PER_ZONE = 60;
+
+  City* createTile(Polygon const& area)
+  {
+    return new Fixtures::SampleCity(area, PRIMARY_ROADS_PER_TILE, SECONDARY_ROADS_PER_ZONE);
+  }
+
+  void removeTiles(int side)
+  {
+    for (int column = 0; column < side; column++)
+    {
+      for (int row = 0; row < side; row++)
+      {
+        std::remove(TiledCity::tileFileName(DIRECTORY, column, row).c_str());
+      }
+    }
+  }
+
+  void generateTiles(int side, int threads)
+  {
+    TiledCity city(side, side, TILE_SIZE, createTile);
+    city.setHalo(300);
+    city.setNumberOfThreads(threads);
+
+    Benchmark::Timer timer;
+    bool generated = city.generate(DIRECTORY);
+
+    std::stringstream label;
+    label << "TiledCity::generate, tiles, " << side * TILE_SIZE << " m city, "
+          << threads << (threads > 1 ? " threads" : " thread") << (generated ? "" : " FAILED");
+    Benchmark::report(label.str(), side * side, timer.elapsed());
+  }
+}
+
+BENCHMARK(TiledCityMemory)
+{
+  mkdir(DIRECTORY, 0755);
+  for (int side = 1; side <= 3; side++)
+  {
+    generateTiles(side, 1);
+    removeTiles(side);
+  }
+  rmdir(DIRECTORY);
+}
+
+BENCHMARK(TiledCityThreads)
+{
+  mkdir(DIRECTORY, 0755);
+  generateTiles(3, 1);
+  generateTiles(3, 4);
+
+  TiledCity city(3, 3, TILE_SIZE, createTile);
+  StreetGraph graph;
+  Benchmark::Timer timer;
+  bool loaded = city.loadStreetGraph(DIRECTORY, &graph);
+  Benchmark::report(std::string("TiledCity::loadStreetGraph, roads, 30000 m city") + (loaded ? "" : " FAILED"),
+                    graph.numberOfRoads(), timer.elapsed());
+
+  removeTiles(3);
+  rmdir(DIRECTORY);
+}
+
+BENCHMARK(SingleCityMemory)
+{
+  for (int side = 1; side <= 3; side++)
+  {
+    Random::setSeed(libcity::RANDOM_SEED);
+    Fixtures::SampleCity city(side * TILE_SIZE, side * side * PRIMARY_ROADS_PER_TILE, SECONDARY_ROADS_PER_ZONE);
+    city.setSeed(libcity::RANDOM_SEED);
+
+    std::stringstream label;
+    label << "City::generate, roads, " << side * TILE_SIZE << " m city";
+    Benchmark::Timer timer;
+    city.generate();
+    Benchmark::report(label.str(), city.numberOfRoads(), timer.elapsed());
+  }
+}
@@ -0,0 +1,246 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchmark.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see benchmark.h
+ *
+ */
+
+#include "benchmark.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+namespace
+{
+  /* Atomic, benchmarks allocate from more threads */
+  std::atomic<long> numberOfAllocations(0);
+  std::atomic<long> liveBytes(0);
+
+  /** Allocations when the last Timer was started. */
+  std::atomic<long> allocationsAtStart(0);
+
+  std::string runningCase;
+  std::vector<Benchmark::Result> reportedResults;
+
+  /** Size of the allocation is stored in front of the block. */
+  const size_t HEADER_SIZE = 16;
+
+  void* countedAllocation(size_t size)
+  {
+    char* block = static_cast<char*>(std::malloc(size + HEADER_SIZE));
+    if (block == 0)
+    {
+      throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+    numberOfAllocations++;
+    liveBytes += size;
+    return block + HEADER_SIZE;
+  }
+
+  void countedRelease(void* pointer)
+  {
+    if (pointer == 0)
+    {
+      return;
+    }
+    char* block = static_cast<char*>(pointer) - HEADER_SIZE;
+    liveBytes -= *reinterpret_cast<size_t*>(block);
+    std::free(block);
+  }
+}
+
+void* operator new(size_t size)
+{
+  return countedAllocation(size);
+}
+
+void* operator new[](size_t size)
+{
+  return countedAllocation(size);
+}
+
+void operator delete(void* pointer) throw()
+{
+  countedRelease(pointer);
+}
+
+void operator delete[](void* pointer) throw()
+{
+  countedRelease(pointer);
+}
+
+namespace Benchmark
+{
+  static double now()
+  {
+    struct timeval time;
+    gettimeofday(&time, 0);
+    return time.tv_sec + time.tv_usec / 1000000.0;
+  }
+
+  long allocations()
+  {
+    return numberOfAllocations;
+  }
+
+  long allocatedBytes()
+  {
+    return liveBytes;
+  }
+
+  long peakMemory()
+  {
+    /* VmHWM follows resets of the peak, ru_maxrss doesn't */
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+      if (line.compare(0, 6, "VmHWM:") == 0)
+      {
+        long kilobytes = 0;
+        std::istringstream(line.substr(6)) >> kilobytes;
+        return kilobytes * 1024;
+      }
+    }
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss * 1024L;
+  }
+
+  static void resetPeakMemory()
+  {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5" << std::flush;
+  }
+
+  static std::string escape(std::string const& text)
+  {
+    std::stringstream escaped;
+    for (std::string::const_iterator character = text.begin();
+         character != text.end();
+         character++)
+    {
+      if (*character == '"' || *character == '\\')
+      {
+        escaped << '\\' << *character;
+      }
+      else if (static_cast<unsigned char>(*character) < 0x20)
+      {
+        escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                << static_cast<int>(*character) << std::dec;
+      }
+      else
+      {
+        escaped << *character;
+      }
+    }
+    return escaped.str();
+  }
+
+  Timer::Timer()
+  {
+    restart();
+  }
+
+  void Timer::restart()
+  {
+    allocationsAtStart = numberOfAllocations.load();
+    started = now();
+  }
+
+  double Timer::elapsed() const
+  {
+    return now() - started;
+  }
+
+  Case::Case(const char* caseName)
+    : name(caseName)
+  {
+    registeredCases().push_back(this);
+  }
+
+  Case::~Case()
+  {}
+
+  std::vector<Case*>& registeredCases()
+  {
+    static std::vector<Case*> cases;
+    return cases;
+  }
+
+  std::vector<Result> const& results()
+  {
+    return reportedResults;
+  }
+
+  void report(std::string const& label, long operations, double seconds)
+  {
+    Result result = {runningCase, label, operations, seconds,
+                     numberOfAllocations - allocationsAtStart, peakMemory()};
+    reportedResults.push_back(result);
+
+    std::cout << std::left << std::setw(56) << label
+              << std::right << std::setw(10) << operations << " ops "
+              << std::setw(10) << std::fixed << std::setprecision(4) << seconds << " s "
+              << std::setw(14) << std::setprecision(1)
+              << (seconds > 0 ? operations / seconds : 0) << " ops/s"
+              << std::endl;
+  }
+
+  void writeJson(std::ostream& output)
+  {
+    output << "{\n  \"benchmarks\": [";
+    for (std::vector<Result>::const_iterator result = reportedResults.begin();
+         result != reportedResults.end();
+         result++)
+    {
+      output << (result == reportedResults.begin() ? "\n" : ",\n")
+             << "    {\"benchmark\": \"" << escape(result->benchmark) << "\", "
+             << "\"label\": \"" << escape(result->label) << "\", "
+             << "\"operations\": " << result->operations << ", "
+             << "\"seconds\": " << std::setprecision(9) << result->seconds << ", "
+             << "\"operationsPerSecond\": " << std::setprecision(1) << std::fixed
+             << (result->seconds > 0 ? result->operations / result->seconds : 0) << ", "
+             << "\"allocations\": " << result->allocations << ", "
+             << "\"peakMemory\": " << result->peakMemory << "}";
+      output.unsetf(std::ios_base::floatfield);
+    }
+    output << "\n  ]\n}\n";
+  }
+
+  int runAll(std::string const& filter)
+  {
+    int run = 0;
+    std::vector<Case*>& cases = registeredCases();
+    for (std::vector<Case*>::iterator benchmark = cases.begin();
+         benchmark != cases.end();
+         benchmark++)
+    {
+      if (std::string((*benchmark)->name).find(filter) == std::string::npos)
+      {
+        continue;
+      }
+
+      std::cout << "== " << (*benchmark)->name << std::endl;
+      runningCase = (*benchmark)->name;
+      resetPeakMemory();
+      (*benchmark)->run();
+      run++;
+    }
+
+    return run;
+  }
+}
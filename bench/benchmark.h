@@ -0,0 +1,131 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/benchmark.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Minimal framework for performance measurements.
+ *
+ * Benchmarks are registered the same way as unit tests
+ * with UnitTest++:
+ *
+ * @code
+ *   BENCHMARK(Something)
+ *   {
+ *     Benchmark::Timer timer;
+ *     ... work ...
+ *     Benchmark::report("Something", operations, timer.elapsed());
+ *   }
+ * @endcode
+ *
+ * Each report also records how many heap allocations were done
+ * since the last Timer was started and the peak resident set size
+ * of the current benchmark. All results can be written as JSON
+ * for comparing runs of different versions.
+ *
+ * The benchmarks don't need any external library.
+ */
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace Benchmark
+{
+  /**
+    Wall clock stopwatch. Starts running when constructed.
+   @remarks
+     Starting a timer also starts counting allocations
+     for the next report().
+   */
+  class Timer
+  {
+    public:
+      Timer();
+
+      void restart();
+      double elapsed() const; /**< Seconds since construction or restart(). */
+
+    private:
+      double started;
+  };
+
+  /** Base class for a single registered benchmark. */
+  class Case
+  {
+    public:
+      Case(const char* caseName);
+      virtual ~Case();
+
+      virtual void run() = 0;
+
+      const char* name;
+  };
+
+  std::vector<Case*>& registeredCases();
+
+  /** @{ */
+  /** Heap statistics, counted by the replaced global operator new. */
+  long allocations();    /**< Number of allocations since start. */
+  long allocatedBytes(); /**< Bytes currently allocated. */
+  /** @} */
+
+  /**
+    Highest resident set size of the process in bytes.
+   @remarks
+     It is reset before each benchmark where the system allows
+     it (Linux), so it belongs to the running benchmark only.
+   */
+  long peakMemory();
+
+  /** Single reported measurement. */
+  struct Result
+  {
+    std::string benchmark; /**< Name of the BENCHMARK. */
+    std::string label;
+    long operations;
+    double seconds;
+    long allocations;      /**< Allocations since the timer was started. */
+    long peakMemory;       /**< Peak RSS in bytes when reported. */
+  };
+
+  /** All results reported so far. */
+  std::vector<Result> const& results();
+
+  /**
+    Write all results as a JSON document.
+   @remarks
+     The document is an object with a "benchmarks" array,
+     one object for each reported result.
+   */
+  void writeJson(std::ostream& output);
+
+  /**
+    Print result of a measurement.
+   @param[in] label      What was measured.
+   @param[in] operations How many operations were done.
+   @param[in] seconds    How long it took.
+   */
+  void report(std::string const& label, long operations, double seconds);
+
+  /**
+    Run all registered benchmarks whose name contains filter.
+   @return Number of benchmarks run.
+   */
+  int runAll(std::string const& filter = "");
+}
+
+#define BENCHMARK(Name) \
+  class Benchmark##Name : public Benchmark::Case \
+  { \
+    public: \
+      Benchmark##Name() : Benchmark::Case(#Name) {} \
+      virtual void run(); \
+  } benchmark##Name##Instance; \
+  void Benchmark##Name::run()
+
+#endif
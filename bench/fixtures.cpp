@@ -0,0 +1,177 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/fixtures.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see fixtures.h
+ *
+ */
+
+#include "fixtures.h"
+
+#include <cmath>
+#include <vector>
+
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/path.h"
+#include "../src/streetgraph/organicroadpattern.h"
+#include "../src/streetgraph/rasterroadpattern.h"
+#include "../src/area/zone.h"
+#include "../src/area/block.h"
+#include "../src/area/lot.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/vector.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/random.h"
+
+namespace Fixtures
+{
+  const double BLOCK_SIZE = 300;
+
+  double latticeNetwork(StreetGraph* graph, int numberOfRoads)
+  {
+    Random generator(libcity::RANDOM_SEED);
+    int side = static_cast<int>(std::sqrt(numberOfRoads / 2.0)) + 1;
+    for (int i = 0; i < side; i++)
+    {
+      for (int j = 0; j < side; j++)
+      {
+        Point corner(i * BLOCK_SIZE + generator.generateDouble(-20, 20),
+                     j * BLOCK_SIZE + generator.generateDouble(-20, 20));
+        graph->addRoad(Path(LineSegment(corner, Point(corner.x() + BLOCK_SIZE, corner.y()))));
+        graph->addRoad(Path(LineSegment(corner, Point(corner.x(), corner.y() + BLOCK_SIZE))));
+      }
+    }
+
+    return side * BLOCK_SIZE;
+  }
+
+  SampleCity::SampleCity(double size, int primary, int secondaryPerZone)
+    : City(), primaryRoads(primary), secondaryRoadsPerZone(secondaryPerZone)
+  {
+    area->addVertex(Point(-size/2, -size/2));
+    area->addVertex(Point( size/2, -size/2));
+    area->addVertex(Point( size/2,  size/2));
+    area->addVertex(Point(-size/2,  size/2));
+  }
+
+  SampleCity::SampleCity(Polygon const& cityArea, int primary, int secondaryPerZone)
+    : City(), primaryRoads(primary), secondaryRoadsPerZone(secondaryPerZone)
+  {
+    *area = cityArea;
+  }
+
+  SampleCity::~SampleCity()
+  {
+    for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+    {
+      delete *lot;
+    }
+    for (std::list<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+    {
+      delete *block;
+    }
+    for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+    {
+      delete *zone;
+    }
+  }
+
+  int SampleCity::numberOfRoads()
+  {
+    return map->numberOfRoads();
+  }
+
+  int SampleCity::numberOfZones()
+  {
+    return zones->size();
+  }
+
+  int SampleCity::numberOfBlocks()
+  {
+    return blocks.size();
+  }
+
+  int SampleCity::numberOfLots()
+  {
+    return lots.size();
+  }
+
+  double SampleCity::lotsChecksum()
+  {
+    double checksum = 0;
+    int order = 1;
+    for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++, order++)
+    {
+      Point centroid = (*lot)->areaConstraints().centroid();
+      checksum += order * (centroid.x() + 3 * centroid.y());
+    }
+    return checksum;
+  }
+
+  void SampleCity::createPrimaryRoadNetwork()
+  {
+    OrganicRoadPattern generator;
+    generator.setTarget(map);
+    generator.setAreaConstraints(new Polygon(*area));
+    generator.setInitialPosition(area->centroid());
+    generator.setRandomEngine(randomEngine());
+    generator.setRoadType(Road::PRIMARY_ROAD);
+    generator.setRoadLength(600, 900);
+    generator.setSnapDistance(100);
+    generator.generateRoads(primaryRoads);
+  }
+
+  void SampleCity::createZones()
+  {
+    *zones = map->findZones();
+  }
+
+  void SampleCity::createSecondaryRoadNetwork()
+  {
+    for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+    {
+      Polygon constraints = (*zone)->areaConstraints();
+
+      RasterRoadPattern generator;
+      generator.setTarget(map);
+      generator.setAreaConstraints(new Polygon(constraints));
+      generator.setInitialPosition(constraints.centroid());
+      generator.setRandomEngine((*zone)->randomEngine());
+      generator.setRoadType(Road::SECONDARY_ROAD);
+      generator.setRoadLength(120, 180);
+      generator.setSnapDistance(20);
+      generator.generateRoads(secondaryRoadsPerZone);
+    }
+  }
+
+  void SampleCity::createBlocks()
+  {
+    std::map<Road::Type, double> roadWidths;
+    roadWidths[Road::PRIMARY_ROAD]   = 6;
+    roadWidths[Road::SECONDARY_ROAD] = 3;
+
+    forEachZone([&](Zone* zone) { zone->createBlocks(roadWidths); });
+
+    for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+    {
+      Zone::BlockRange zoneBlocks = (*zone)->blockRange();
+      blocks.insert(blocks.end(), zoneBlocks.begin(), zoneBlocks.end());
+    }
+  }
+
+  void SampleCity::createBuildings()
+  {
+    std::vector<Block*> allBlocks(blocks.begin(), blocks.end());
+    forEachBlock(allBlocks, [](Block* block) { block->createLots(30, 30, 0.2); });
+
+    for (std::list<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+    {
+      Block::LotRange blockLots = (*block)->lotRange();
+      lots.insert(lots.end(), blockLots.begin(), blockLots.end());
+    }
+  }
+}
@@ -0,0 +1,72 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/fixtures.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Input data shared by the benchmarks.
+ *
+ */
+
+#ifndef _FIXTURES_H_
+#define _FIXTURES_H_
+
+#include <list>
+
+#include "../src/city.h"
+
+class StreetGraph;
+class Zone;
+class Block;
+class Lot;
+
+namespace Fixtures
+{
+  /**
+    Streets on a jittered lattice of square blocks.
+   @remarks
+     Streets of the neighbouring blocks cross each other,
+     so the resulting graph has more roads than requested.
+   @return Length of the lattice side.
+   */
+  double latticeNetwork(StreetGraph* graph, int numberOfRoads);
+
+  /**
+    Complete city generation pipeline.
+   @remarks
+     Organic primary roads, raster secondary roads in each zone,
+     blocks and lots. Everything is freed with the city.
+   */
+  class SampleCity : public City
+  {
+    public:
+      SampleCity(double size, int primaryRoads, int secondaryRoadsPerZone);
+      SampleCity(Polygon const& cityArea, int primaryRoads, int secondaryRoadsPerZone);
+      virtual ~SampleCity();
+
+      int numberOfRoads();
+      int numberOfZones();
+      int numberOfBlocks();
+      int numberOfLots();
+
+      /** Sum of lot centroid coordinates, compares two cities cheaply. */
+      double lotsChecksum();
+
+    protected:
+      virtual void createPrimaryRoadNetwork();
+      virtual void createZones();
+      virtual void createSecondaryRoadNetwork();
+      virtual void createBlocks();
+      virtual void createBuildings();
+
+    private:
+      int primaryRoads;
+      int secondaryRoadsPerZone;
+
+      std::list<Block*> blocks;
+      std::list<Lot*> lots;
+  };
+}
+
+#endif
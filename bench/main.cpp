@@ -0,0 +1,49 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file bench/main.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Main program for the benchmarks.
+ *
+ * Usage: benchmarks [--json file] [name filter]
+ *
+ * With --json, all results are also written to the file as JSON.
+ */
+
+#include "benchmark.h"
+
+#include <iostream>
+#include <fstream>
+
+int main(int argc, char* argv[])
+{
+  std::string filter, json;
+  for (int argument = 1; argument < argc; argument++)
+  {
+    if (std::string(argv[argument]) == "--json" && argument + 1 < argc)
+    {
+      json = argv[++argument];
+    }
+    else
+    {
+      filter = argv[argument];
+    }
+  }
+
+  int run = Benchmark::runAll(filter);
+
+  if (!json.empty())
+  {
+    std::ofstream output(json.c_str());
+    Benchmark::writeJson(output);
+    if (!output)
+    {
+      std::cerr << "Cannot write " << json << std::endl;
+      return 1;
+    }
+  }
+
+  return run > 0 ? 0 : 1;
+}
@@ -12,56 +12,56 @@
 #include "area.h"
 
 #include "../debug.h"
+#include "../random.h"
 #include "../geometry/units.h"
 #include "../geometry/point.h"
 #include "../geometry/polygon.h"
 #include "../geometry/vector.h"
 
 Area::Area()
-{
-  initialize();
-}
+  : constraints(), parentArea(0), areaRandomEngine(0)
+{}
 
 Area::Area(Area const& source)
+  : constraints(source.constraints), parentArea(source.parentArea), areaRandomEngine(0)
 {
-  initialize();
-
-  *constraints = *(source.constraints);
-  parentArea = source.parentArea;
-}
-
-void Area::initialize()
-{
-  parentArea = 0;
-  constraints = new Polygon();
+  if (source.areaRandomEngine != 0)
+  {
+    areaRandomEngine = new RandomEngine(*source.areaRandomEngine);
+  }
 }
 
 Area& Area::operator=(Area const& source)
 {
-  *constraints = *(source.constraints);
+  constraints = source.constraints;
   parentArea = source.parentArea;
 
+  if (source.areaRandomEngine != 0)
+  {
+    setRandomEngine(*source.areaRandomEngine);
+  }
+  else
+  {
+    delete areaRandomEngine;
+    areaRandomEngine = 0;
+  }
+
   return *this;
 }
 
 Area::~Area()
 {
-  freeMemory();
-}
-
-void Area::freeMemory()
-{
-  delete constraints;
+  delete areaRandomEngine;
 }
 
 Polygon Area::areaConstraints()
 {
-  return *constraints;
+  return constraints;
 }
 
 void Area::setAreaConstraints(Polygon const& area)
 {
-  *constraints = area;
+  constraints = area;
 }
 
 void  Area::setParent(Area* area)
@@ -72,4 +72,21 @@ void  Area::setParent(Area* area)
 Area* Area::parent()
 {
   return parentArea;
-}
\ No newline at end of file
+}
+
+void Area::setRandomEngine(RandomEngine const& engine)
+{
+  if (areaRandomEngine == 0)
+  {
+    areaRandomEngine = new RandomEngine(engine);
+  }
+  else
+  {
+    *areaRandomEngine = engine;
+  }
+}
+
+RandomEngine* Area::randomEngine()
+{
+  return areaRandomEngine;
+}
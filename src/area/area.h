@@ -17,11 +17,13 @@
 #include <list>
 #include <map>
 
-class Polygon;
+#include "../geometry/polygon.h"
+
 class StreetGraph;
 class RoadLSystem;
 class Intersection;
 class Block;
+class RandomEngine;
 
 /**
   Base class for city areas (zones, districts, blocks, alottments).
@@ -45,13 +47,20 @@ class Area
     virtual void setParent(Area* area);
     virtual Area* parent();
 
+    /**
+      Random numbers of this area (and its subareas) are drawn
+      from the given engine instead of the shared Random seed.
+      The area keeps its own copy.
+     */
+    void setRandomEngine(RandomEngine const& engine);
+
+    /** @return The engine or 0 if the area uses the shared seed. */
+    RandomEngine* randomEngine();
+
   protected:
-    Polygon* constraints;
+    Polygon constraints;
     Area* parentArea;
-
-  private:
-    void initialize();
-    void freeMemory();
+    RandomEngine* areaRandomEngine;
 };
 
 #endif
\ No newline at end of file
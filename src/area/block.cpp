@@ -92,11 +92,11 @@ void Block::createLots(double lotWidth, double lotHeight, double deviance)
   Point sp1, sp2; /* Split line. */
 
   /* A valid region must have at least 3 vertices. */
-  assert(constraints->numberOfVertices() >= 3);
+  assert(constraints.numberOfVertices() >= 3);
 
   /* Convert areaConstraints of this block to polygonGraph
      that is used in subdivision algorithm. */
-  region = new SubRegion(*constraints);
+  region = new SubRegion(constraints);
 
   SubRegion::Edge* blockFirst = region->getFirstEdge();
   SubRegion::Edge* current = blockFirst;
@@ -175,6 +175,7 @@ void Block::createLots(double lotWidth, double lotHeight, double deviance)
     // split and process the new regions
     newRegions = splitRegion(region, sp1, sp2);
     regionQueue.pop_back();
+    delete region; /* The new regions have copies of its edges. */
     for (std::list<SubRegion*>::iterator newRegion = newRegions.begin();
          newRegion != newRegions.end();
          newRegion++)
@@ -229,7 +230,7 @@ Point Block::calcSplitPoint(LineSegment const& longestEdge, double splitSize, do
 
   // calculate longest edge vector src -> dst
   Vector longestEdgeDirection(longestEdge.begining(), longestEdge.end());
-  Random numberGenerator;
+  Random numberGenerator(areaRandomEngine);
 
   Point retval = longestEdge.begining() + longestEdgeDirection *
          (midPosition + (lotDeviance * (numberGenerator.generateDouble(0, 1) - 0.5) * fraction));
@@ -305,7 +306,7 @@ std::list<SubRegion*> Block::splitRegion(SubRegion* area, Point a, Point b)
   while(edge != region);
 
   // sort the created list by location on ab
-  createdEdges.sort();
+  createdEdges.sort(SubRegion::EdgeOrder());
 
   // mark edges as unvisited
   edge = region;
@@ -366,3 +367,13 @@ std::list<Lot*> Block::getLots()
 {
   return lots;
 }
+
+void Block::addLot(Lot* lot)
+{
+  lots.push_back(lot);
+}
+
+Block::LotRange Block::lotRange() const
+{
+  return LotRange(lots.begin(), lots.end());
+}
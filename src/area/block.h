@@ -14,9 +14,11 @@
 
 /* STL */
 #include <string>
+#include <list>
 
 /* libcity */
 #include "area.h"
+#include "../range.h"
 
 class LineSegment;
 class Point;
@@ -55,6 +57,13 @@ class Block : public Area
     void createLots(double lotWidth, double lotHeight, double deviance);
     std::list<Lot*> getLots();
 
+    /** Add a lot created elsewhere, the block doesn't own it. */
+    void addLot(Lot* lot);
+
+    /** Lots of the block without copying the list. */
+    typedef Range<std::list<Lot*>::const_iterator> LotRange;
+    LotRange lotRange() const;
+
   private:
 
     Point calcSplitPoint(LineSegment const& longestEdge, double splitSize, double lotDeviance);
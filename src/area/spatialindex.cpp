@@ -0,0 +1,492 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file area/spatialindex.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see area/spatialindex.h
+ *
+ */
+
+#include "spatialindex.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "zone.h"
+#include "block.h"
+#include "lot.h"
+#include "../entities/building.h"
+#include "../geometry/polygon.h"
+#include "../geometry/point.h"
+
+namespace
+{
+  /** Deeper than any tree split at medians can get. */
+  const int MAXIMAL_DEPTH = 64;
+
+  enum Relation
+  {
+    OUTSIDE,
+    OVERLAPPING,
+    INSIDE
+  };
+
+  Polygon footprintOf(Area* area)
+  {
+    return area->areaConstraints();
+  }
+
+  Polygon footprintOf(Building* building)
+  {
+    return building->lot()->areaConstraints();
+  }
+
+  /** @return False for a polygon without vertices. */
+  bool boundsOf(Polygon const& polygon, SpatialIndex::Bounds* bounds)
+  {
+    unsigned int numberOfVertices = polygon.numberOfVertices();
+    if (numberOfVertices == 0)
+    {
+      return false;
+    }
+
+    Point vertex = polygon.vertex(0);
+    bounds->minX = bounds->maxX = vertex.x();
+    bounds->minY = bounds->maxY = vertex.y();
+    for (unsigned int i = 1; i < numberOfVertices; i++)
+    {
+      vertex = polygon.vertex(i);
+      bounds->minX = std::min(bounds->minX, vertex.x());
+      bounds->maxX = std::max(bounds->maxX, vertex.x());
+      bounds->minY = std::min(bounds->minY, vertex.y());
+      bounds->maxY = std::max(bounds->maxY, vertex.y());
+    }
+    return true;
+  }
+
+  /** Orders elements by their centers along one axis. */
+  class CenterLess
+  {
+    public:
+      CenterLess(std::vector<SpatialIndex::Bounds> const& elementBounds, bool alongX)
+        : bounds(elementBounds), x(alongX)
+      {}
+
+      bool operator()(int first, int second) const
+      {
+        double firstCenter = center(bounds[first]), secondCenter = center(bounds[second]);
+        if (firstCenter != secondCenter)
+        {
+          return firstCenter < secondCenter;
+        }
+        return first < second;
+      }
+
+    private:
+      std::vector<SpatialIndex::Bounds> const& bounds;
+      bool x;
+
+      double center(SpatialIndex::Bounds const& box) const
+      {
+        return x ? box.minX + box.maxX : box.minY + box.maxY;
+      }
+  };
+
+  class BoxTest
+  {
+    public:
+      BoxTest(double minX, double minY, double maxX, double maxY)
+      {
+        region.minX = minX;
+        region.maxX = maxX;
+        region.minY = minY;
+        region.maxY = maxY;
+      }
+
+      bool isEmpty() const
+      {
+        return region.minX > region.maxX || region.minY > region.maxY;
+      }
+
+      int relation(SpatialIndex::Bounds const& box) const
+      {
+        if (box.maxX < region.minX || box.minX > region.maxX ||
+            box.maxY < region.minY || box.minY > region.maxY)
+        {
+          return OUTSIDE;
+        }
+        if (box.minX >= region.minX && box.maxX <= region.maxX &&
+            box.minY >= region.minY && box.maxY <= region.maxY)
+        {
+          return INSIDE;
+        }
+        return OVERLAPPING;
+      }
+
+    private:
+      SpatialIndex::Bounds region;
+  };
+
+  /**
+    Convex polygon as an intersection of half-planes
+    a * x + b * y + c >= 0, one for each edge.
+   @remarks
+     A box is outside if it's outside the bounds of the polygon
+     or of one of the half-planes, which are all the separating
+     axes of a box and a convex polygon. It's inside if all its
+     corners are inside all the half-planes.
+   */
+  class FootprintTest
+  {
+    public:
+      FootprintTest(Polygon const& footprint)
+        : extent(), empty(true)
+      {
+        unsigned int numberOfVertices = footprint.numberOfVertices();
+        if (numberOfVertices < 3)
+        {
+          return;
+        }
+
+        double doubleArea = 0;
+        for (unsigned int i = 0; i < numberOfVertices; i++)
+        {
+          Point first = footprint.vertex(i), second = footprint.vertex((i + 1) % numberOfVertices);
+          doubleArea += first.x() * second.y() - second.x() * first.y();
+        }
+        if (doubleArea == 0)
+        {
+          return;
+        }
+
+        /* Inside is on the left of the edges of a counterclockwise polygon */
+        double orientation = doubleArea > 0 ? 1 : -1;
+        for (unsigned int i = 0; i < numberOfVertices; i++)
+        {
+          Point first = footprint.vertex(i), second = footprint.vertex((i + 1) % numberOfVertices);
+          double edgeA = -(second.y() - first.y()) * orientation,
+                 edgeB = (second.x() - first.x()) * orientation;
+          a.push_back(edgeA);
+          b.push_back(edgeB);
+          c.push_back(-(edgeA * first.x() + edgeB * first.y()));
+        }
+
+        boundsOf(footprint, &extent);
+        empty = false;
+      }
+
+      bool isEmpty() const
+      {
+        return empty;
+      }
+
+      int relation(SpatialIndex::Bounds const& box) const
+      {
+        if (box.maxX < extent.minX || box.minX > extent.maxX ||
+            box.maxY < extent.minY || box.minY > extent.maxY)
+        {
+          return OUTSIDE;
+        }
+
+        bool inside = true;
+        for (unsigned int i = 0; i < a.size(); i++)
+        {
+          /* Corners farthest inside and outside the half-plane */
+          double farthestInside = a[i] * (a[i] > 0 ? box.maxX : box.minX) +
+                                  b[i] * (b[i] > 0 ? box.maxY : box.minY) + c[i];
+          if (farthestInside < 0)
+          {
+            return OUTSIDE;
+          }
+
+          double farthestOutside = a[i] * (a[i] > 0 ? box.minX : box.maxX) +
+                                   b[i] * (b[i] > 0 ? box.minY : box.maxY) + c[i];
+          if (farthestOutside < 0)
+          {
+            inside = false;
+          }
+        }
+        return inside ? INSIDE : OVERLAPPING;
+      }
+
+    private:
+      SpatialIndex::Bounds extent;
+      std::vector<double> a;
+      std::vector<double> b;
+      std::vector<double> c;
+      bool empty;
+  };
+}
+
+void SpatialIndex::Result::clear()
+{
+  zones.clear();
+  blocks.clear();
+  lots.clear();
+  buildings.clear();
+}
+
+int SpatialIndex::Result::size() const
+{
+  return zones.size() + blocks.size() + lots.size() + buildings.size();
+}
+
+void SpatialIndex::Hierarchy::clear()
+{
+  nodes.clear();
+  bounds.clear();
+}
+
+SpatialIndex::SpatialIndex()
+{}
+
+SpatialIndex::~SpatialIndex()
+{}
+
+void SpatialIndex::insert(Zone* zone)
+{
+  zones.push_back(zone);
+}
+
+void SpatialIndex::insert(Block* block)
+{
+  blocks.push_back(block);
+}
+
+void SpatialIndex::insert(Lot* lot)
+{
+  lots.push_back(lot);
+}
+
+void SpatialIndex::insert(Building* building)
+{
+  assert(building->lot() != 0);
+  buildings.push_back(building);
+}
+
+void SpatialIndex::build()
+{
+  build(&zones, &zoneHierarchy);
+  build(&blocks, &blockHierarchy);
+  build(&lots, &lotHierarchy);
+  build(&buildings, &buildingHierarchy);
+}
+
+void SpatialIndex::clear()
+{
+  zones.clear();
+  blocks.clear();
+  lots.clear();
+  buildings.clear();
+
+  zoneHierarchy.clear();
+  blockHierarchy.clear();
+  lotHierarchy.clear();
+  buildingHierarchy.clear();
+}
+
+template <typename Element>
+void SpatialIndex::build(std::vector<Element*>* elements, Hierarchy* hierarchy)
+{
+  hierarchy->clear();
+
+  std::vector<Element*> indexed;
+  std::vector<Bounds> bounds;
+  indexed.reserve(elements->size());
+  bounds.reserve(elements->size());
+  for (typename std::vector<Element*>::iterator element = elements->begin();
+       element != elements->end();
+       element++)
+  {
+    Bounds box;
+    if (boundsOf(footprintOf(*element), &box))
+    {
+      indexed.push_back(*element);
+      bounds.push_back(box);
+    }
+  }
+
+  int numberOfElements = indexed.size();
+  elements->clear();
+  if (numberOfElements == 0)
+  {
+    return;
+  }
+
+  std::vector<int> order(numberOfElements);
+  for (int i = 0; i < numberOfElements; i++)
+  {
+    order[i] = i;
+  }
+  hierarchy->nodes.reserve(2 * (numberOfElements / LEAF_SIZE + 1));
+  buildNode(bounds, &order, 0, numberOfElements, &hierarchy->nodes);
+
+  /* Elements of each node are next to each other */
+  elements->reserve(numberOfElements);
+  hierarchy->bounds.reserve(numberOfElements);
+  for (int i = 0; i < numberOfElements; i++)
+  {
+    elements->push_back(indexed[order[i]]);
+    hierarchy->bounds.push_back(bounds[order[i]]);
+  }
+}
+
+int SpatialIndex::buildNode(std::vector<Bounds> const& bounds, std::vector<int>* order,
+                            int first, int count, std::vector<Node>* nodes)
+{
+  Node node;
+  node.bounds = bounds[(*order)[first]];
+  node.first = first;
+  node.count = count;
+  node.second = 0;
+
+  /* Doubled centers, only their spread matters */
+  Bounds centers;
+  centers.minX = centers.maxX = node.bounds.minX + node.bounds.maxX;
+  centers.minY = centers.maxY = node.bounds.minY + node.bounds.maxY;
+  for (int i = first; i < first + count; i++)
+  {
+    Bounds const& box = bounds[(*order)[i]];
+    node.bounds.minX = std::min(node.bounds.minX, box.minX);
+    node.bounds.maxX = std::max(node.bounds.maxX, box.maxX);
+    node.bounds.minY = std::min(node.bounds.minY, box.minY);
+    node.bounds.maxY = std::max(node.bounds.maxY, box.maxY);
+    centers.minX = std::min(centers.minX, box.minX + box.maxX);
+    centers.maxX = std::max(centers.maxX, box.minX + box.maxX);
+    centers.minY = std::min(centers.minY, box.minY + box.maxY);
+    centers.maxY = std::max(centers.maxY, box.minY + box.maxY);
+  }
+  int index = nodes->size();
+  nodes->push_back(node);
+  if (count <= LEAF_SIZE)
+  {
+    return index;
+  }
+
+  bool alongX = centers.maxX - centers.minX >= centers.maxY - centers.minY;
+  int half = count / 2;
+  std::nth_element(order->begin() + first, order->begin() + first + half,
+                   order->begin() + first + count, CenterLess(bounds, alongX));
+
+  buildNode(bounds, order, first, half, nodes);
+  int second = buildNode(bounds, order, first + half, count - half, nodes);
+  (*nodes)[index].second = second;
+  return index;
+}
+
+void SpatialIndex::query(double minX, double minY, double maxX, double maxY,
+                         Result* output, int kinds) const
+{
+  output->clear();
+
+  BoxTest test(minX, minY, maxX, maxY);
+  if (!test.isEmpty())
+  {
+    query(test, output, kinds);
+  }
+}
+
+void SpatialIndex::query(Polygon const& footprint, Result* output, int kinds) const
+{
+  output->clear();
+
+  FootprintTest test(footprint);
+  if (!test.isEmpty())
+  {
+    query(test, output, kinds);
+  }
+}
+
+template <typename Test>
+void SpatialIndex::query(Test const& test, Result* output, int kinds) const
+{
+  if (kinds & ZONES)
+  {
+    query(zoneHierarchy, zones, test, &output->zones);
+  }
+  if (kinds & BLOCKS)
+  {
+    query(blockHierarchy, blocks, test, &output->blocks);
+  }
+  if (kinds & LOTS)
+  {
+    query(lotHierarchy, lots, test, &output->lots);
+  }
+  if (kinds & BUILDINGS)
+  {
+    query(buildingHierarchy, buildings, test, &output->buildings);
+  }
+}
+
+template <typename Element, typename Test>
+void SpatialIndex::query(Hierarchy const& hierarchy, std::vector<Element*> const& elements,
+                         Test const& test, std::vector<Element*>* output)
+{
+  if (hierarchy.nodes.empty())
+  {
+    return;
+  }
+
+  int stack[MAXIMAL_DEPTH];
+  int top = 0;
+  stack[top++] = 0;
+  while (top > 0)
+  {
+    int index = stack[--top];
+    Node const& node = hierarchy.nodes[index];
+
+    int relation = test.relation(node.bounds);
+    if (relation == OUTSIDE)
+    {
+      continue;
+    }
+
+    typename std::vector<Element*>::const_iterator first = elements.begin() + node.first;
+    if (relation == INSIDE)
+    /* The whole subtree */
+    {
+      output->insert(output->end(), first, first + node.count);
+      continue;
+    }
+
+    if (node.second == 0)
+    {
+      for (int i = node.first; i < node.first + node.count; i++)
+      {
+        if (test.relation(hierarchy.bounds[i]) != OUTSIDE)
+        {
+          output->push_back(elements[i]);
+        }
+      }
+      continue;
+    }
+
+    assert(top + 2 <= MAXIMAL_DEPTH);
+    stack[top++] = node.second;
+    stack[top++] = index + 1;
+  }
+}
+
+int SpatialIndex::size(int kinds) const
+{
+  int numberOfElements = 0;
+  if (kinds & ZONES)
+  {
+    numberOfElements += zones.size();
+  }
+  if (kinds & BLOCKS)
+  {
+    numberOfElements += blocks.size();
+  }
+  if (kinds & LOTS)
+  {
+    numberOfElements += lots.size();
+  }
+  if (kinds & BUILDINGS)
+  {
+    numberOfElements += buildings.size();
+  }
+  return numberOfElements;
+}
@@ -0,0 +1,173 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file area/spatialindex.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Hierarchy of bounding boxes over zones, blocks, lots and buildings
+ *
+ * Each kind of element has its own bounding volume hierarchy.
+ * It's a binary tree built top-down, the elements of a node
+ * are split at the median of their centers along the longer
+ * side of the node. Leaves hold up to LEAF_SIZE elements.
+ *
+ * The nodes are stored depth first and the elements in the
+ * order of the leaves, so the elements of any node are in one
+ * continuous range. A node that lies completely in the query
+ * region is reported at once, without visiting its subtree.
+ *
+ * The results are conservative: an element is found if its
+ * bounding box overlaps the region. Buildings are indexed by
+ * the bounding box of their lot.
+ *
+ * @code
+ *   SpatialIndex index;
+ *   city.buildSpatialIndex(&index);
+ *
+ *   SpatialIndex::Result visible;
+ *   index.query(footprint, &visible, SpatialIndex::LOTS);
+ * @endcode
+ */
+
+#ifndef _SPATIALINDEX_H_
+#define _SPATIALINDEX_H_
+
+#include <vector>
+
+class Zone;
+class Block;
+class Lot;
+class Building;
+class Polygon;
+
+class SpatialIndex
+{
+  public:
+    static const int LEAF_SIZE = 8;
+
+    /** Kinds of the elements, combine them to query more at once. */
+    enum Kind
+    {
+      ZONES      = 1,
+      BLOCKS     = 2,
+      LOTS       = 4,
+      BUILDINGS  = 8,
+      EVERYTHING = ZONES | BLOCKS | LOTS | BUILDINGS
+    };
+
+    /** Elements found by a query, in the order of the hierarchy. */
+    struct Result
+    {
+      std::vector<Zone*> zones;
+      std::vector<Block*> blocks;
+      std::vector<Lot*> lots;
+      std::vector<Building*> buildings;
+
+      void clear();
+      int size() const;
+    };
+
+    /** Axis aligned bounding box. */
+    struct Bounds
+    {
+      double minX;
+      double maxX;
+      double minY;
+      double maxY;
+    };
+
+    SpatialIndex();
+    ~SpatialIndex();
+
+    /* Elements without any vertices are ignored. */
+    void insert(Zone* zone);
+    void insert(Block* block);
+    void insert(Lot* lot);
+    void insert(Building* building);
+
+    /**
+      Build the hierarchies of the inserted elements.
+     @remarks
+       Must be called before querying and again after inserting
+       more elements. The build takes O(n log n) time.
+     */
+    void build();
+
+    void clear();
+
+    /**
+      Find the elements overlapping a rectangle.
+     @param[in] kinds Combination of the Kind values to look for.
+     @param[out] output Found elements, the vectors are cleared first.
+     */
+    void query(double minX, double minY, double maxX, double maxY,
+               Result* output, int kinds = EVERYTHING) const;
+
+    /**
+      Find the elements overlapping the footprint of a view
+      frustum, the part of the ground a camera can see.
+     @remarks
+       The footprint must be convex (the ground projection of
+       a frustum is), its orientation doesn't matter. Only x and
+       y coordinates are used, nothing is found for a footprint
+       with less than 3 vertices or a zero area.
+     @param[in] kinds Combination of the Kind values to look for.
+     @param[out] output Found elements, the vectors are cleared first.
+     */
+    void query(Polygon const& footprint, Result* output, int kinds = EVERYTHING) const;
+
+    /** Number of indexed elements of the given kinds. */
+    int size(int kinds = EVERYTHING) const;
+
+  private: /* Copying not allowed */
+    SpatialIndex(SpatialIndex const& source);
+    SpatialIndex& operator=(SpatialIndex const& source);
+
+    struct Node
+    {
+      Bounds bounds;
+      int first;  /**< First element of the node. */
+      int count;  /**< Number of elements in the node. */
+      int second; /**< Index of the second child, 0 for leaves. The first child follows the node. */
+    };
+
+    /** Bounding volume hierarchy of one kind of elements. */
+    struct Hierarchy
+    {
+      std::vector<Node> nodes;
+      std::vector<Bounds> bounds; /**< Bounds of the elements. */
+
+      void clear();
+    };
+
+    std::vector<Zone*> zones;
+    std::vector<Block*> blocks;
+    std::vector<Lot*> lots;
+    std::vector<Building*> buildings;
+
+    Hierarchy zoneHierarchy;
+    Hierarchy blockHierarchy;
+    Hierarchy lotHierarchy;
+    Hierarchy buildingHierarchy;
+
+    /**
+      Build the subtree of elements [first, first + count).
+     @param[in,out] order Elements in the order of the leaves once it's built.
+     @return Index of the node.
+     */
+    static int buildNode(std::vector<Bounds> const& bounds, std::vector<int>* order,
+                         int first, int count, std::vector<Node>* nodes);
+
+    template <typename Element>
+    static void build(std::vector<Element*>* elements, Hierarchy* hierarchy);
+
+    template <typename Element, typename Test>
+    static void query(Hierarchy const& hierarchy, std::vector<Element*> const& elements,
+                      Test const& test, std::vector<Element*>* output);
+
+    template <typename Test>
+    void query(Test const& test, Result* output, int kinds) const;
+};
+
+#endif
@@ -65,12 +65,27 @@ SubRegion::~SubRegion()
 
 void SubRegion::freeMemory()
 {
-  Edge* first = polygonGraph;
-  while(polygonGraph->next != first)
+  for (std::vector<Edge*>::iterator edge = edges.begin();
+       edge != edges.end();
+       edge++)
   {
-    polygonGraph = polygonGraph->next;
-    delete polygonGraph->previous;
+    delete *edge;
   }
+  edges.clear();
+  polygonGraph = 0;
+}
+
+SubRegion::Edge* SubRegion::createEdge()
+{
+  Edge* edge = new Edge;
+  edges.push_back(edge);
+  return edge;
+}
+
+void SubRegion::discardLastEdge()
+{
+  delete edges.back();
+  edges.pop_back();
 }
 
 
@@ -147,7 +162,7 @@ SubRegion::Edge* SubRegion::constructPolygonGraph(Polygon const& polygon)
 {
   assert(polygon.numberOfVertices() >= 3);
 
-  Edge* current = new Edge;
+  Edge* current = createEdge();
   Edge* first = current;
   Edge* next = 0;
   Edge* previous = 0;
@@ -156,7 +171,7 @@ SubRegion::Edge* SubRegion::constructPolygonGraph(Polygon const& polygon)
     current->begining = polygon.vertex(i);
     current->hasRoadAccess = false;
 
-    next = new Edge;
+    next = createEdge();
     previous = current;
     current->next = next;
     next->previous = current;
@@ -166,7 +181,7 @@ SubRegion::Edge* SubRegion::constructPolygonGraph(Polygon const& polygon)
 
   /* Connect the end to the begining */
   current = next->previous;  // one step back
-  delete next;               // discard the prepared node
+  discardLastEdge();         // discard the prepared node
   current->next = first;     // connect to cycle
   first->previous = current; // and back
 
@@ -177,7 +192,7 @@ SubRegion::Edge* SubRegion::copyPolygonGraph(Edge* source)
 {
   Edge* sourceCurrent = source;
 
-  Edge* current = new Edge;
+  Edge* current = createEdge();
   Edge* first = current;
   Edge* next;
   Edge* previous = 0;
@@ -188,7 +203,7 @@ SubRegion::Edge* SubRegion::copyPolygonGraph(Edge* source)
     current->hasRoadAccess = sourceCurrent->hasRoadAccess; // All block edges have road access
     current->s = sourceCurrent->s;
 
-    next = new Edge;
+    next = createEdge();
     previous = current;
     current->next = next;
     next->previous = current;
@@ -200,7 +215,7 @@ SubRegion::Edge* SubRegion::copyPolygonGraph(Edge* source)
 
   /* Connect the end to the begining */
   current = next->previous;  // one step back
-  delete next;               // discard the prepared node
+  discardLastEdge();         // discard the prepared node
   current->next = first;     // connect to cycle
   first->previous = current; // and back
 
@@ -221,7 +236,7 @@ SubRegion::Edge* SubRegion::insert(Edge* after, Point const& begining)
 
   assert(after != 0);
 
-  Edge* newEdge = new Edge;
+  Edge* newEdge = createEdge();
   newEdge->begining = begining;
   newEdge->hasRoadAccess = false;
   newEdge->s = 0;
@@ -237,7 +252,7 @@ SubRegion::Edge* SubRegion::insert(Edge* after, Point const& begining)
 
 SubRegion::Edge* SubRegion::insertFirst(Point const& begining)
 {
-  polygonGraph = new Edge;
+  polygonGraph = createEdge();
   polygonGraph->begining = begining;
   polygonGraph->hasRoadAccess = false;
   polygonGraph->s = 0;
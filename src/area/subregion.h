@@ -40,8 +40,15 @@ class SubRegion
       bool hasRoadAccess;
       Edge* previous;
       Edge* next;
+    };
 
-      bool operator<(Edge* second) { return begining < second->begining; }
+    /** Orders edge pointers by their begining points. */
+    struct EdgeOrder
+    {
+      bool operator()(Edge* first, Edge* second) const
+      {
+        return first->begining < second->begining;
+      }
     };
 
     SubRegion();
@@ -65,6 +72,12 @@ class SubRegion
   private:
     Edge *polygonGraph;
 
+    /* All the edges of the graph, bridge() splits it to more cycles. */
+    std::vector<Edge*> edges;
+
+    Edge* createEdge();
+    void discardLastEdge();
+
     Edge* insertFirst(Point const& begining);
     Edge* constructPolygonGraph(Polygon const& polygon);
     Edge* copyPolygonGraph(Edge* source);
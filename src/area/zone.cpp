@@ -16,8 +16,11 @@
 #include "../streetgraph/intersection.h"
 #include "../geometry/polygon.h"
 #include "../geometry/point.h"
+#include "../geometry/batch.h"
 #include "../streetgraph/areaextractor.h"
 #include "../lsystem/roadlsystem.h"
+#include "../random.h"
+#include "block.h"
 
 Zone::Zone(StreetGraph* streets)
 {
@@ -29,7 +32,6 @@ void Zone::initialize()
 {
   associatedStreetGraph = 0;
   roadGenerator = 0;
-  constraints = new Polygon();
   blocks = new std::list<Block*>;
 }
 
@@ -41,7 +43,6 @@ Zone::~Zone()
 void Zone::freeMemory()
 {
   freeRoadGenerator();
-  delete constraints;
   delete blocks;
 }
 
@@ -57,15 +58,20 @@ Zone::Zone(Zone const& source)
 {
   initialize();
   associatedStreetGraph = source.associatedStreetGraph;
-  *constraints = *(source.constraints);
+  constraints = source.constraints;
   roadGenerator = source.roadGenerator;
+
+  if (source.areaRandomEngine != 0)
+  {
+    setRandomEngine(*source.areaRandomEngine);
+  }
 }
 
 Zone& Zone::operator=(Zone const& source)
 {
-  associatedStreetGraph = source.associatedStreetGraph;
-  *constraints = *(source.constraints);
+  Area::operator=(source);
 
+  associatedStreetGraph = source.associatedStreetGraph;
   roadGenerator = source.roadGenerator;
 
   return *this;
@@ -88,7 +94,21 @@ StreetGraph* Zone::streetGraph()
 
 bool Zone::isIntersectionInside(Intersection* intersection)
 {
-  return constraints->encloses2D(intersection->position());
+  return constraints.encloses2D(intersection->position());
+}
+
+void Zone::areIntersectionsInside(std::vector<Intersection*> const& intersections, std::vector<bool>* inside)
+{
+  Batch::PointArray positions;
+  positions.reserve(intersections.size());
+  for (std::vector<Intersection*>::const_iterator intersection = intersections.begin();
+       intersection != intersections.end();
+       intersection++)
+  {
+    positions.push_back((*intersection)->position());
+  }
+
+  Batch::encloses2D(constraints, positions, inside);
 }
 
 bool Zone::roadIsInside(Road* road)
@@ -96,14 +116,36 @@ bool Zone::roadIsInside(Road* road)
   return isIntersectionInside(road->begining()) && isIntersectionInside(road->end());
 }
 
-void Zone::createBlocks(std::map<Road::Type, double> roadWidths)
+void Zone::createBlocks(std::map<Road::Type, double> roadWidths, AreaExtractor::Algorithm algorithm)
 {
   AreaExtractor graph;
   graph.setRoadWidths(roadWidths);
+  graph.setAlgorithm(algorithm);
   *blocks = graph.extractBlocks(associatedStreetGraph, this);
+
+  if (areaRandomEngine != 0)
+  /* Each block gets its own stream in the order of extraction */
+  {
+    for (std::list<Block*>::iterator block = blocks->begin();
+         block != blocks->end();
+         block++)
+    {
+      (*block)->setRandomEngine(areaRandomEngine->split());
+    }
+  }
 }
 
 std::list<Block*> Zone::getBlocks()
 {
   return *blocks;
-}
\ No newline at end of file
+}
+
+void Zone::addBlock(Block* block)
+{
+  blocks->push_back(block);
+}
+
+Zone::BlockRange Zone::blockRange() const
+{
+  return BlockRange(blocks->begin(), blocks->end());
+}
@@ -19,6 +19,8 @@
 
 /* libcity */
 #include "../streetgraph/road.h"
+#include "../streetgraph/areaextractor.h"
+#include "../range.h"
 #include "area.h"
 
 class Polygon;
@@ -42,11 +44,25 @@ class Zone : public Area
     void setStreetGraph(StreetGraph* streets);
 
     bool isIntersectionInside(Intersection* intersection);
+
+    /**
+      Test many intersections at once (see Batch::encloses2D()).
+     @param[out] inside One flag for each of the intersections.
+     */
+    void areIntersectionsInside(std::vector<Intersection*> const& intersections, std::vector<bool>* inside);
     bool roadIsInside(Road* road);
 
-    void createBlocks(std::map<Road::Type, double> roadWidths);
+    void createBlocks(std::map<Road::Type, double> roadWidths,
+                      AreaExtractor::Algorithm algorithm = AreaExtractor::MINIMAL_CYCLE_BASIS);
     std::list<Block*> getBlocks();
 
+    /** Add a block created elsewhere, the zone doesn't own it. */
+    void addBlock(Block* block);
+
+    /** Blocks of the zone without copying the list. */
+    typedef Range<std::list<Block*>::const_iterator> BlockRange;
+    BlockRange blockRange() const;
+
   private:
     RoadLSystem* roadGenerator;
     StreetGraph* associatedStreetGraph;
@@ -11,9 +11,22 @@
 
 #include "city.h"
 
+#include <algorithm>
+
 #include "streetgraph/streetgraph.h"
+#include "streetgraph/intersection.h"
+#include "streetgraph/path.h"
 #include "area/zone.h"
+#include "area/block.h"
+#include "area/lot.h"
+#include "area/spatialindex.h"
 #include "geometry/polygon.h"
+#include "geometry/point.h"
+#include "geometry/linesegment.h"
+#include "random.h"
+#include "threadpool.h"
+#include "io/cityfile.h"
+#include "io/mapwriter.h"
 
 City::City()
 {
@@ -30,20 +43,211 @@ void City::initialize()
   area = new Polygon;
   map = new StreetGraph;
   zones = new std::list<Zone*>;
+  connections = new std::vector<Point>;
+  cityRandomEngine = 0;
+  threads = 1;
+  pool = 0;
 }
 void City::freeMemory()
 {
   delete map;
   delete zones;
+  delete connections;
   delete area;
+  delete cityRandomEngine;
+  delete pool;
 }
 
 void City::generate()
 {
+  std::vector<Intersection*> existing;
+  if (!connections->empty())
+  {
+    StreetGraph::IntersectionRange intersections = map->intersectionRange();
+    existing.assign(intersections.begin(), intersections.end());
+    std::sort(existing.begin(), existing.end());
+  }
+
   createPrimaryRoadNetwork();
+  connectPrimaryRoadNetwork(existing);
   createZones();
+  seedZones();
   createSecondaryRoadNetwork();
   createBlocks();
   createBuildings();
 }
 
+void City::setConnections(std::vector<Point> const& points)
+{
+  *connections = points;
+}
+
+void City::connectPrimaryRoadNetwork(std::vector<Intersection*> const& existing)
+{
+  if (connections->empty())
+  {
+    return;
+  }
+
+  /* Intersections created by the primary road network, the
+     roads added for the connections don't change this list. */
+  std::vector<Intersection*> created;
+  StreetGraph::IntersectionRange intersections = map->intersectionRange();
+  for (StreetGraph::IntersectionRange::iterator intersection = intersections.begin();
+       intersection != intersections.end();
+       intersection++)
+  {
+    if (!std::binary_search(existing.begin(), existing.end(), *intersection))
+    {
+      created.push_back(*intersection);
+    }
+  }
+
+  for (std::vector<Point>::iterator point = connections->begin();
+       point != connections->end();
+       point++)
+  {
+    Intersection* nearest = 0;
+    double nearestDistance = 0;
+
+    for (std::vector<Intersection*>::iterator intersection = created.begin();
+         intersection != created.end();
+         intersection++)
+    {
+      Point position = (*intersection)->position();
+      double distance = (position.x() - point->x()) * (position.x() - point->x()) +
+                        (position.y() - point->y()) * (position.y() - point->y());
+      if (nearest == 0 || distance < nearestDistance)
+      {
+        nearest = *intersection;
+        nearestDistance = distance;
+      }
+    }
+
+    if (nearest != 0)
+    {
+      map->addRoad(Path(LineSegment(*point, nearest->position())), Road::PRIMARY_ROAD);
+    }
+  }
+}
+
+void City::setSeed(unsigned long long masterSeed)
+{
+  delete cityRandomEngine;
+  cityRandomEngine = new RandomEngine(masterSeed);
+}
+
+RandomEngine* City::randomEngine()
+{
+  return cityRandomEngine;
+}
+
+void City::seedZones()
+{
+  if (cityRandomEngine == 0)
+  {
+    return;
+  }
+
+  for (std::list<Zone*>::iterator zone = zones->begin();
+       zone != zones->end();
+       zone++)
+  {
+    (*zone)->setRandomEngine(cityRandomEngine->split());
+  }
+}
+
+bool City::save(std::string const& fileName)
+{
+  return CityFile::save(fileName, map, *zones);
+}
+
+bool City::write(MapWriter* writer)
+{
+  writer->writeStreetGraph(map);
+  for (std::list<Zone*>::iterator zone = zones->begin();
+       zone != zones->end();
+       zone++)
+  {
+    writer->writeZone(*zone);
+  }
+  return writer->finish();
+}
+
+void City::buildSpatialIndex(SpatialIndex* index)
+{
+  index->clear();
+  for (std::list<Zone*>::iterator zone = zones->begin();
+       zone != zones->end();
+       zone++)
+  {
+    index->insert(*zone);
+
+    Zone::BlockRange zoneBlocks = (*zone)->blockRange();
+    for (Zone::BlockRange::iterator block = zoneBlocks.begin();
+         block != zoneBlocks.end();
+         block++)
+    {
+      index->insert(*block);
+
+      Block::LotRange blockLots = (*block)->lotRange();
+      for (Block::LotRange::iterator lot = blockLots.begin();
+           lot != blockLots.end();
+           lot++)
+      {
+        index->insert(*lot);
+      }
+    }
+  }
+  index->build();
+}
+
+StreetGraph* City::streetGraph()
+{
+  return map;
+}
+
+void City::setNumberOfThreads(int numberOfThreads)
+{
+  threads = numberOfThreads < 1 ? 1 : numberOfThreads;
+}
+
+int City::numberOfThreads() const
+{
+  return threads;
+}
+
+void City::run(int count, std::function<void (int)> const& task)
+{
+  if (threads < 2 || cityRandomEngine == 0)
+  {
+    for (int index = 0; index < count; index++)
+    {
+      task(index);
+    }
+    return;
+  }
+
+  if (pool == 0 || pool->size() != threads)
+  {
+    delete pool;
+    pool = new ThreadPool(threads);
+  }
+  pool->run(count, task);
+}
+
+void City::forEachZone(ZoneTask const& task)
+{
+  std::vector<Zone*> items(zones->begin(), zones->end());
+  run(items.size(), [&](int index) { task(items[index]); });
+}
+
+void City::forEachBlock(std::vector<Block*> const& blocks, BlockTask const& task)
+{
+  run(blocks.size(), [&](int index) { task(blocks[index]); });
+}
+
+void City::forEachLot(std::vector<Lot*> const& lots, LotTask const& task)
+{
+  run(lots.size(), [&](int index) { task(lots[index]); });
+}
@@ -13,10 +13,21 @@
 #define _CITY_H_
 
 #include <list>
+#include <vector>
+#include <functional>
+#include <string>
 
 class StreetGraph;
+class Intersection;
 class Zone;
+class Block;
+class Lot;
 class Polygon;
+class Point;
+class RandomEngine;
+class MapWriter;
+class ThreadPool;
+class SpatialIndex;
 
 class City
 {
@@ -26,6 +37,59 @@ class City
 
     virtual void generate();
 
+    /**
+      Generate the city from its own random engine instead of
+      the shared Random seed. Each zone then gets a child
+      engine in the order of the zones list, so the result
+      depends only on the master seed.
+     */
+    void setSeed(unsigned long long masterSeed);
+
+    /**
+      Points to join to the primary road network, such as ends
+      of roads added to the street graph before generate().
+     @remarks
+       Once createPrimaryRoadNetwork() is done, each point gets
+       a primary road to the nearest intersection the network
+       created, so the zones are found with these roads. If the
+       network created no intersection, the points stay unconnected.
+     */
+    void setConnections(std::vector<Point> const& points);
+
+    /**
+      Number of threads for the per-zone, per-block and per-lot
+      steps (1 by default). They run in parallel only when the
+      city has a seed, the shared Random seed isn't thread-safe.
+      The result is the same for any number of threads.
+     */
+    void setNumberOfThreads(int threads);
+    int numberOfThreads() const;
+
+    /**
+      Write the street graph and the zones with their blocks
+      and lots into a file (see CityFile).
+     @return False if the file couldn't be written.
+     */
+    bool save(std::string const& fileName);
+
+    /**
+      Export the street graph and the zones with their blocks
+      and lots (see GeoJsonWriter, OsmWriter).
+     @return False if writing failed.
+     */
+    bool write(MapWriter* writer);
+
+    /**
+      Index the zones, blocks and lots for spatial queries.
+     @remarks
+       The index is cleared first and built at the end. Buildings
+       are created by the subclasses, insert them into the index
+       and call SpatialIndex::build() again to include them.
+     */
+    void buildSpatialIndex(SpatialIndex* index);
+
+    StreetGraph* streetGraph();
+
   private: /* Copying not allowed */
     City(City const& source);
     City& operator=(City const& source);
@@ -42,7 +106,46 @@ class City
 
     Polygon* area;
 
+    /** @return The engine or 0 if the city uses the shared seed. */
+    RandomEngine* randomEngine();
+
+    typedef std::function<void (Zone*)>  ZoneTask;
+    typedef std::function<void (Block*)> BlockTask;
+    typedef std::function<void (Lot*)>   LotTask;
+
+    /**
+      Fan independent work out across the city's threads
+      (@see setNumberOfThreads()). Tasks must touch only their
+      own area, collect the results after the call in the
+      order of the input to keep them deterministic.
+     */
+    void forEachZone(ZoneTask const& task);
+    void forEachBlock(std::vector<Block*> const& blocks, BlockTask const& task);
+    void forEachLot(std::vector<Lot*> const& lots, LotTask const& task);
+
   private:
+    RandomEngine* cityRandomEngine;
+    int threads;
+    ThreadPool* pool; /**< Created when it's needed */
+
+    /** Run task(0) ... task(count - 1), in parallel if it's allowed. */
+    void run(int count, std::function<void (int)> const& task);
+
+    std::vector<Point>* connections;
+
+    /** Give the zones their random engines. */
+    void seedZones();
+
+    /**
+      Join the connections to the nearest intersections
+      that aren't in the existing ones.
+     @remarks
+       The intersections created by the primary road network
+       are collected once, only they are searched for each point.
+     @param[in] existing Intersections before the primary road network, sorted.
+     */
+    void connectPrimaryRoadNetwork(std::vector<Intersection*> const& existing);
+
     void initialize();
     void freeMemory();
 };
@@ -0,0 +1,484 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/batch.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see geometry/batch.h
+ *
+ */
+
+#include "batch.h"
+#include "point.h"
+#include "polygon.h"
+#include "linesegment.h"
+#include "predicates.h"
+#include "units.h"
+
+#include <cmath>
+
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+  /** An edge of a polygon prepared for the tests of LineSegment::hasPoint2D(). */
+  struct Edge
+  {
+    enum Parameter
+    {
+      ALONG_X,
+      ALONG_Y,
+      NONE     /**< Both ends are the same point. */
+    };
+
+    Edge(Point const& begining, Point const& end)
+      : firstX(begining.x()), firstY(begining.y()),
+        secondX(end.x()), secondY(end.y()),
+        dx(end.x() - begining.x()), dy(end.y() - begining.y())
+    {
+      if (std::abs(firstX - secondX) > libcity::COORDINATES_EPSILON)
+      {
+        parameter = ALONG_X;
+      }
+      else if (std::abs(firstY - secondY) > libcity::COORDINATES_EPSILON)
+      {
+        parameter = ALONG_Y;
+      }
+      else
+      {
+        parameter = NONE;
+      }
+    }
+
+    double firstX, firstY, secondX, secondY, dx, dy;
+    Parameter parameter;
+  };
+
+  std::vector<Edge> polygonEdges(Polygon const& polygon)
+  {
+    std::vector<Edge> edges;
+    unsigned int count = polygon.numberOfVertices();
+    edges.reserve(count);
+    for (unsigned int i = 0; i < count; i++)
+    {
+      edges.push_back(Edge(polygon.vertex(i), polygon.vertex((i + 1) % count)));
+    }
+    return edges;
+  }
+
+  /** LineSegment::hasPoint2D() with the edge. */
+  inline bool isOnEdge(Edge const& edge, double x, double y)
+  {
+    double lineTest = (x - edge.firstX) * edge.dy - (y - edge.firstY) * edge.dx;
+    if (!(std::abs(lineTest) < libcity::COORDINATES_EPSILON))
+    {
+      return false;
+    }
+
+    double t;
+    switch (edge.parameter)
+    {
+      case Edge::ALONG_X:
+        t = (x - edge.firstX) / edge.dx;
+        return t >= 0 && t <= 1;
+      case Edge::ALONG_Y:
+        t = (y - edge.firstY) / edge.dy;
+        return t >= 0 && t <= 1;
+      default:
+        return std::abs(edge.firstX - x) < libcity::COORDINATES_EPSILON &&
+               std::abs(edge.firstY - y) < libcity::COORDINATES_EPSILON;
+    }
+  }
+
+  /** Does the edge cross the ray going from the point to the right? */
+  inline bool crossesRay(Edge const& edge, double x, double y)
+  {
+    bool secondIsAbove = edge.secondY > y;
+    if ((edge.firstY > y) == secondIsAbove)
+    {
+      return false;
+    }
+    int side = Predicates::orientation(edge.firstX, edge.firstY, edge.secondX, edge.secondY, x, y);
+    return side != 0 && (side > 0) == secondIsAbove;
+  }
+
+  bool encloses(std::vector<Edge> const& edges, double x, double y)
+  {
+    bool isInside = false;
+    for (std::vector<Edge>::const_iterator edge = edges.begin();
+         edge != edges.end();
+         edge++)
+    {
+      if (isOnEdge(*edge, x, y))
+      {
+        return true;
+      }
+      isInside ^= crossesRay(*edge, x, y);
+    }
+    return isInside;
+  }
+
+  /** LineSegment::intersection2D() != NONINTERSECTING */
+  bool intersects(LineSegment const& segment, double beginingX, double beginingY, double endX, double endY)
+  {
+    Point const& begining = segment.begining(),
+               & end      = segment.end();
+    int anotherBeginingSide = Predicates::orientation(begining.x(), begining.y(), end.x(), end.y(),
+                                                      beginingX, beginingY),
+        anotherEndSide      = Predicates::orientation(begining.x(), begining.y(), end.x(), end.y(),
+                                                      endX, endY);
+    if ((anotherBeginingSide == 0 && anotherEndSide == 0) ||
+        LineSegment::isNearlyCollinear(begining.x(), begining.y(), end.x(), end.y(),
+                                       beginingX, beginingY, endX, endY))
+    /* Collinear segments are classified with the tolerance. */
+    {
+      Point intersection;
+      return segment.intersection2D(LineSegment(Point(beginingX, beginingY), Point(endX, endY)),
+                                    &intersection) != LineSegment::NONINTERSECTING;
+    }
+
+    int beginingSide = Predicates::orientation(beginingX, beginingY, endX, endY, begining.x(), begining.y()),
+        endSide      = Predicates::orientation(beginingX, beginingY, endX, endY, end.x(), end.y());
+    return anotherBeginingSide * anotherEndSide <= 0 && beginingSide * endSide <= 0;
+  }
+
+#if defined(__AVX__)
+  /** AVX registers hold four doubles. */
+  struct Lanes
+  {
+    typedef __m256d Vector;
+    static const int WIDTH = 4;
+
+    static Vector load(double const* values) { return _mm256_loadu_pd(values); }
+    static Vector broadcast(double value) { return _mm256_set1_pd(value); }
+    static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+    static Vector sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+    static Vector div(Vector a, Vector b) { return _mm256_div_pd(a, b); }
+    static Vector abs(Vector a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static Vector less(Vector a, Vector b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static Vector lessOrEqual(Vector a, Vector b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static Vector notEqual(Vector a, Vector b) { return _mm256_cmp_pd(a, b, _CMP_NEQ_OQ); }
+    static Vector both(Vector a, Vector b) { return _mm256_and_pd(a, b); }
+    static Vector either(Vector a, Vector b) { return _mm256_or_pd(a, b); }
+    static Vector differ(Vector a, Vector b) { return _mm256_xor_pd(a, b); }
+    static Vector except(Vector a, Vector b) { return _mm256_andnot_pd(b, a); }
+    static int mask(Vector a) { return _mm256_movemask_pd(a); }
+  };
+  #define LIBCITY_BATCH_LANES "AVX"
+#elif defined(__SSE2__)
+  /** SSE2 registers hold two doubles. */
+  struct Lanes
+  {
+    typedef __m128d Vector;
+    static const int WIDTH = 2;
+
+    static Vector load(double const* values) { return _mm_loadu_pd(values); }
+    static Vector broadcast(double value) { return _mm_set1_pd(value); }
+    static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+    static Vector sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+    static Vector div(Vector a, Vector b) { return _mm_div_pd(a, b); }
+    static Vector abs(Vector a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static Vector less(Vector a, Vector b) { return _mm_cmplt_pd(a, b); }
+    static Vector lessOrEqual(Vector a, Vector b) { return _mm_cmple_pd(a, b); }
+    static Vector notEqual(Vector a, Vector b) { return _mm_cmpneq_pd(a, b); }
+    static Vector both(Vector a, Vector b) { return _mm_and_pd(a, b); }
+    static Vector either(Vector a, Vector b) { return _mm_or_pd(a, b); }
+    static Vector differ(Vector a, Vector b) { return _mm_xor_pd(a, b); }
+    static Vector except(Vector a, Vector b) { return _mm_andnot_pd(b, a); }
+    static int mask(Vector a) { return _mm_movemask_pd(a); }
+  };
+  #define LIBCITY_BATCH_LANES "SSE2"
+#endif
+
+#ifdef LIBCITY_BATCH_LANES
+  typedef Lanes::Vector Register;
+
+  /**
+    Signs of orientation(a, b, c) decided by the filter of
+    Predicates::orientation(), computed the same way.
+   @param[out] positive, negative Lanes with a certain sign.
+   @param[out] determinant        The approximate determinant itself.
+   @return Mask of the lanes which need the exact predicate.
+   */
+  inline int orientationSigns(Register ax, Register ay, Register bx, Register by, Register cx, Register cy,
+                              Register* positive, Register* negative, Register* determinant)
+  {
+    Register left  = Lanes::mul(Lanes::sub(ax, cx), Lanes::sub(by, cy)),
+           right = Lanes::mul(Lanes::sub(ay, cy), Lanes::sub(bx, cx)),
+           bound = Lanes::mul(Lanes::broadcast(Predicates::ORIENTATION_ERROR_BOUND),
+                              Lanes::add(Lanes::abs(left), Lanes::abs(right))),
+           zero = Lanes::broadcast(0);
+
+    *determinant = Lanes::sub(left, right);
+    *positive = Lanes::less(bound, *determinant);
+    *negative = Lanes::less(*determinant, Lanes::sub(zero, bound));
+    /* Zero bound means the determinant is exactly zero. */
+    return Lanes::mask(Lanes::notEqual(bound, zero)) & ~Lanes::mask(Lanes::either(*positive, *negative));
+  }
+
+  /** Points from first to first + Lanes::WIDTH */
+  void enclosesLanes(std::vector<Edge> const& edges, double const* x, double const* y,
+                     unsigned int first, std::vector<bool>* output)
+  {
+    Register pointX = Lanes::load(x + first),
+           pointY = Lanes::load(y + first),
+           epsilon = Lanes::broadcast(libcity::COORDINATES_EPSILON),
+           zero = Lanes::broadcast(0),
+           one = Lanes::broadcast(1);
+
+    int onEdge = 0, isInside = 0;
+    for (std::vector<Edge>::const_iterator edge = edges.begin();
+         edge != edges.end();
+         edge++)
+    {
+      Register firstX = Lanes::broadcast(edge->firstX),
+             firstY = Lanes::broadcast(edge->firstY),
+             secondX = Lanes::broadcast(edge->secondX),
+             secondY = Lanes::broadcast(edge->secondY),
+             relativeX = Lanes::sub(pointX, firstX),
+             relativeY = Lanes::sub(pointY, firstY);
+
+      /* LineSegment::hasPoint2D() */
+      Register lineTest = Lanes::sub(Lanes::mul(relativeX, Lanes::broadcast(edge->dy)),
+                                   Lanes::mul(relativeY, Lanes::broadcast(edge->dx))),
+             onLine = Lanes::less(Lanes::abs(lineTest), epsilon);
+      if (Lanes::mask(onLine) != 0)
+      {
+        Register t;
+        switch (edge->parameter)
+        {
+          case Edge::ALONG_X:
+            t = Lanes::div(relativeX, Lanes::broadcast(edge->dx));
+            onLine = Lanes::both(onLine, Lanes::both(Lanes::lessOrEqual(zero, t), Lanes::lessOrEqual(t, one)));
+            break;
+          case Edge::ALONG_Y:
+            t = Lanes::div(relativeY, Lanes::broadcast(edge->dy));
+            onLine = Lanes::both(onLine, Lanes::both(Lanes::lessOrEqual(zero, t), Lanes::lessOrEqual(t, one)));
+            break;
+          default:
+            onLine = Lanes::both(onLine, Lanes::both(Lanes::less(Lanes::abs(Lanes::sub(firstX, pointX)), epsilon),
+                                                     Lanes::less(Lanes::abs(Lanes::sub(firstY, pointY)), epsilon)));
+        }
+        onEdge |= Lanes::mask(onLine);
+      }
+
+      /* Crossing of the ray to the right */
+      Register secondIsAbove = Lanes::less(pointY, secondY),
+             straddles = Lanes::differ(Lanes::less(pointY, firstY), secondIsAbove);
+      int straddling = Lanes::mask(straddles);
+      if (straddling == 0)
+      {
+        continue;
+      }
+
+      Register positive, negative, determinant;
+      int uncertain = orientationSigns(firstX, firstY, secondX, secondY, pointX, pointY,
+                                       &positive, &negative, &determinant);
+      Register crossing = Lanes::either(Lanes::both(positive, secondIsAbove),
+                                      Lanes::except(negative, secondIsAbove));
+      isInside ^= Lanes::mask(crossing) & straddling;
+
+      uncertain &= straddling;
+      for (int lane = 0; uncertain != 0; lane++, uncertain >>= 1)
+      {
+        if (uncertain & 1)
+        {
+          isInside ^= crossesRay(*edge, x[first + lane], y[first + lane]) << lane;
+        }
+      }
+    }
+
+    for (int lane = 0; lane < Lanes::WIDTH; lane++)
+    {
+      (*output)[first + lane] = ((onEdge | isInside) >> lane) & 1;
+    }
+  }
+#endif
+}
+
+namespace Batch
+{
+  char const* instructionSet()
+  {
+#ifdef LIBCITY_BATCH_LANES
+    return LIBCITY_BATCH_LANES;
+#else
+    return "scalar";
+#endif
+  }
+
+  void PointArray::reserve(unsigned int size)
+  {
+    x.reserve(size);
+    y.reserve(size);
+  }
+
+  void PointArray::push_back(Point const& point)
+  {
+    x.push_back(point.x());
+    y.push_back(point.y());
+  }
+
+  void PointArray::clear()
+  {
+    x.clear();
+    y.clear();
+  }
+
+  unsigned int PointArray::size() const
+  {
+    return x.size();
+  }
+
+  void SegmentArray::reserve(unsigned int size)
+  {
+    beginingX.reserve(size);
+    beginingY.reserve(size);
+    endX.reserve(size);
+    endY.reserve(size);
+  }
+
+  void SegmentArray::push_back(LineSegment const& segment)
+  {
+    beginingX.push_back(segment.begining().x());
+    beginingY.push_back(segment.begining().y());
+    endX.push_back(segment.end().x());
+    endY.push_back(segment.end().y());
+  }
+
+  void SegmentArray::clear()
+  {
+    beginingX.clear();
+    beginingY.clear();
+    endX.clear();
+    endY.clear();
+  }
+
+  unsigned int SegmentArray::size() const
+  {
+    return beginingX.size();
+  }
+
+  void encloses2D(Polygon const& polygon, PointArray const& points,
+                  std::vector<bool>* output, Kernel kernel)
+  {
+    unsigned int count = points.size(), done = 0;
+    output->resize(count);
+    if (count == 0)
+    {
+      return;
+    }
+
+    std::vector<Edge> edges = polygonEdges(polygon);
+#ifdef LIBCITY_BATCH_LANES
+    if (kernel == VECTOR)
+    {
+      for (; done + Lanes::WIDTH <= count; done += Lanes::WIDTH)
+      {
+        enclosesLanes(edges, &points.x[0], &points.y[0], done, output);
+      }
+    }
+#endif
+    for (unsigned int i = done; i < count; i++)
+    {
+      (*output)[i] = encloses(edges, points.x[i], points.y[i]);
+    }
+  }
+
+  void intersects2D(LineSegment const& segment, SegmentArray const& segments,
+                    std::vector<bool>* output, Kernel kernel)
+  {
+    unsigned int count = segments.size(), done = 0;
+    output->resize(count);
+
+#ifdef LIBCITY_BATCH_LANES
+    if (kernel == VECTOR)
+    {
+      Register beginingX = Lanes::broadcast(segment.begining().x()),
+             beginingY = Lanes::broadcast(segment.begining().y()),
+             endX = Lanes::broadcast(segment.end().x()),
+             endY = Lanes::broadcast(segment.end().y());
+      double directionX = segment.end().x() - segment.begining().x(),
+             directionY = segment.end().y() - segment.begining().y();
+      Register looseEpsilon = Lanes::broadcast(4 * libcity::COORDINATES_EPSILON * libcity::COORDINATES_EPSILON),
+             nearThisLine = Lanes::mul(looseEpsilon, Lanes::broadcast(directionX * directionX + directionY * directionY));
+      for (; done + Lanes::WIDTH <= count; done += Lanes::WIDTH)
+      {
+        Register anotherBeginingX = Lanes::load(&segments.beginingX[done]),
+               anotherBeginingY = Lanes::load(&segments.beginingY[done]),
+               anotherEndX = Lanes::load(&segments.endX[done]),
+               anotherEndY = Lanes::load(&segments.endY[done]);
+
+        /* Sides as in LineSegment::intersection2D() */
+        Register positive[4], negative[4], determinant[4];
+        int uncertain = orientationSigns(beginingX, beginingY, endX, endY,
+                                         anotherBeginingX, anotherBeginingY,
+                                         &positive[0], &negative[0], &determinant[0]) |
+                        orientationSigns(beginingX, beginingY, endX, endY,
+                                         anotherEndX, anotherEndY,
+                                         &positive[1], &negative[1], &determinant[1]) |
+                        orientationSigns(anotherBeginingX, anotherBeginingY, anotherEndX, anotherEndY,
+                                         beginingX, beginingY,
+                                         &positive[2], &negative[2], &determinant[2]) |
+                        orientationSigns(anotherBeginingX, anotherBeginingY, anotherEndX, anotherEndY,
+                                         endX, endY,
+                                         &positive[3], &negative[3], &determinant[3]);
+
+        /* Lanes that may be nearly collinear (LineSegment::isNearlyCollinear())
+           are left to the scalar test. The filter uses a twice larger
+           tolerance, so rounding can't hide any of them. */
+        Register anotherDirectionX = Lanes::sub(anotherEndX, anotherBeginingX),
+               anotherDirectionY = Lanes::sub(anotherEndY, anotherBeginingY),
+               anotherLength = Lanes::add(Lanes::mul(anotherDirectionX, anotherDirectionX),
+                                          Lanes::mul(anotherDirectionY, anotherDirectionY)),
+               thisNear = Lanes::both(Lanes::less(Lanes::mul(determinant[0], determinant[0]), nearThisLine),
+                                      Lanes::less(Lanes::mul(determinant[1], determinant[1]), nearThisLine)),
+               anotherNear = Lanes::both(
+                 Lanes::less(Lanes::mul(determinant[2], determinant[2]), Lanes::mul(looseEpsilon, anotherLength)),
+                 Lanes::less(Lanes::mul(determinant[3], determinant[3]), Lanes::mul(looseEpsilon, anotherLength)));
+        int nearlyCollinear = Lanes::mask(Lanes::either(thisNear, anotherNear));
+
+        /* Both ends of one segment on the same side of the other */
+        int separated = Lanes::mask(Lanes::either(
+                          Lanes::either(Lanes::both(positive[0], positive[1]), Lanes::both(negative[0], negative[1])),
+                          Lanes::either(Lanes::both(positive[2], positive[3]), Lanes::both(negative[2], negative[3]))));
+        separated &= ~nearlyCollinear;
+        /* All sides known and none of them zero */
+        int decided = Lanes::mask(Lanes::both(Lanes::both(Lanes::either(positive[0], negative[0]),
+                                                          Lanes::either(positive[1], negative[1])),
+                                              Lanes::both(Lanes::either(positive[2], negative[2]),
+                                                          Lanes::either(positive[3], negative[3]))));
+        decided &= ~(uncertain | nearlyCollinear);
+
+        for (int lane = 0; lane < Lanes::WIDTH; lane++)
+        {
+          unsigned int i = done + lane;
+          if ((separated >> lane) & 1)
+          {
+            (*output)[i] = false;
+          }
+          else if ((decided >> lane) & 1)
+          {
+            (*output)[i] = true;
+          }
+          else
+          {
+            (*output)[i] = intersects(segment, segments.beginingX[i], segments.beginingY[i],
+                                      segments.endX[i], segments.endY[i]);
+          }
+        }
+      }
+    }
+#endif
+    for (unsigned int i = done; i < count; i++)
+    {
+      (*output)[i] = intersects(segment, segments.beginingX[i], segments.beginingY[i],
+                                segments.endX[i], segments.endY[i]);
+    }
+  }
+}
@@ -0,0 +1,89 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/batch.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Geometric tests of many points or segments at once
+ *
+ * Coordinates are stored as separate arrays (structure of
+ * arrays), so the tests run on several points at a time in
+ * SIMD registers: four with AVX (compile with -mavx2 or
+ * -march=native) and two with SSE2, which every x86-64
+ * compiler uses. Other targets get the scalar loop.
+ *
+ * Results are the same as calling the single tests one by one,
+ * Polygon::encloses2D() and LineSegment::intersection2D(). The
+ * vector code uses the same error bound as Predicates, lanes
+ * too close to call are decided by the exact predicate and
+ * nearly collinear segments by LineSegment::intersection2D().
+ *
+ * Only x and y coordinates are used.
+ */
+
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+#include <vector>
+
+class Point;
+class Polygon;
+class LineSegment;
+
+namespace Batch
+{
+  enum Kernel
+  {
+    SCALAR = 0,
+    VECTOR      /**< The widest one available, scalar if there's none. */
+  };
+
+  /** Name of the instruction set used by the VECTOR kernel. */
+  char const* instructionSet();
+
+  /** Coordinates of points in separate arrays. */
+  struct PointArray
+  {
+    std::vector<double> x;
+    std::vector<double> y;
+
+    void reserve(unsigned int size);
+    void push_back(Point const& point);
+    void clear();
+    unsigned int size() const;
+  };
+
+  /** End points of line segments in separate arrays. */
+  struct SegmentArray
+  {
+    std::vector<double> beginingX;
+    std::vector<double> beginingY;
+    std::vector<double> endX;
+    std::vector<double> endY;
+
+    void reserve(unsigned int size);
+    void push_back(LineSegment const& segment);
+    void clear();
+    unsigned int size() const;
+  };
+
+  /**
+    Polygon::encloses2D() of each of the points.
+   @param[out] output One flag for each point, resized to fit.
+   */
+  void encloses2D(Polygon const& polygon, PointArray const& points,
+                  std::vector<bool>* output, Kernel kernel = VECTOR);
+
+  /**
+    Does the segment intersect each of the segments? The flag is
+    set when LineSegment::intersection2D() doesn't return
+    NONINTERSECTING, so touching and collinear overlapping
+    segments count as well.
+   @param[out] output One flag for each of the segments, resized to fit.
+   */
+  void intersects2D(LineSegment const& segment, SegmentArray const& segments,
+                    std::vector<bool>* output, Kernel kernel = VECTOR);
+}
+
+#endif
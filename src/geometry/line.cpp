@@ -19,41 +19,19 @@
 #include <cmath>
 
 Line::Line()
-{
-  first  = new Point(0,0,0);
-  second = new Point(0,0,0);
-}
+  : first(0,0,0), second(0,0,0)
+{}
 
 Line::Line(Point const& firstPoint, Point const& secondPoint)
-{
-  first  = new Point(firstPoint);
-  second = new Point(secondPoint);
-}
+  : first(firstPoint), second(secondPoint)
+{}
 
 Line::Line(Point const& point, Vector const& vector)
-{
-  first  = new Point(point);
-  second = new Point(point + vector);
-}
-
-Line::Line(Line const& source)
-{
-  first  = new Point(source.begining());
-  second = new Point(source.end());
-}
-
-Line& Line::operator=(Line const& source)
-{
-  *first  = source.begining();
-  *second = source.end();
-  return *this;
-}
+  : first(point), second(point + vector)
+{}
 
 Line::~Line()
-{
-  delete first;
-  delete second;
-}
+{}
 
 void Line::set(Point const& begining, Point const& end)
 {
@@ -63,31 +41,28 @@ void Line::set(Point const& begining, Point const& end)
 
 void Line::setBegining(Point const& point)
 {
-  delete first;
-  first = new Point(point);
+  first = point;
 }
 
 void Line::setEnd(Point const& point)
 {
-
-  delete second;
-  second = new Point(point);
+  second = point;
 }
 
 Point Line::begining() const
 {
-  return *first;
+  return first;
 }
 
 Point Line::end() const
 {
-  return *second;
+  return second;
 }
 
 bool Line::hasPoint2D(Point const& point) const
 {
-  double lineTest = (point.x() - first->x()) * (second->y() - first->y()) -
-                    (point.y() - first->y()) * (second->x() - first->x());
+  double lineTest = (point.x() - first.x()) * (second.y() - first.y()) -
+                    (point.y() - first.y()) * (second.x() - first.x());
   if (std::abs(lineTest) < libcity::EPSILON)
   /* Point is on the line */
   {
@@ -126,15 +101,15 @@ Point Line::nearestPoint(Point const& point) const
   double parameter;
   Point orthogonalProjection;
 
-  parameter = (second->x() - first->x())*(point.x() - first->x()) +
-              (second->y() - first->y())*(point.y() - first->y()) +
-              (second->z() - first->z())*(point.z() - first->z());
+  parameter = (second.x() - first.x())*(point.x() - first.x()) +
+              (second.y() - first.y())*(point.y() - first.y()) +
+              (second.z() - first.z())*(point.z() - first.z());
 
-  parameter /= Vector(*first, *second).length()*Vector(*first, *second).length();
+  parameter /= Vector(first, second).length()*Vector(first, second).length();
 
-  orthogonalProjection.setX((1 - parameter)*first->x() + second->x()*parameter);
-  orthogonalProjection.setY((1 - parameter)*first->y() + second->y()*parameter);
-  orthogonalProjection.setZ((1 - parameter)*first->z() + second->z()*parameter);
+  orthogonalProjection.setX((1 - parameter)*first.x() + second.x()*parameter);
+  orthogonalProjection.setY((1 - parameter)*first.y() + second.y()*parameter);
+  orthogonalProjection.setZ((1 - parameter)*first.z() + second.z()*parameter);
 
   return orthogonalProjection;
 }
@@ -149,7 +124,7 @@ double Line::distance(Point const& point) const
 double Line::pointPositionTest(Point const& point) const
 {
   //return (x2 - x1) * (y3 - y1) - (y2 - y1) * (x3 - x1);
-  return (second->x() - first->x()) * (point.y() - first->y()) - (second->y() - first->y()) * (point.x() - first->x());
+  return (second.x() - first.x()) * (point.y() - first.y()) - (second.y() - first.y()) * (point.x() - first.x());
 }
 
 bool Line::operator==(Line const& another) const
@@ -160,5 +135,5 @@ bool Line::operator==(Line const& another) const
 
 std::string Line::toString()
 {
-  return "Line(" + first->toString() + ", " + second->toString() + ")";
+  return "Line(" + first.toString() + ", " + second.toString() + ")";
 }
@@ -18,7 +18,8 @@
 
 #include <string>
 
-class Point;
+#include "point.h"
+
 class Vector;
 
 class Line
@@ -39,9 +40,6 @@ class Line
     Line(Point const& firstPoint, Point const& secondPoint);
     Line(Point const& point, Vector const& vector);
 
-    Line(Line const& source); /**< Own copy constructor is neccessary */
-    Line& operator=(Line const& source); /**< Own assignment operator is neccessary */
-
     void set(Point const& begining, Point const& end);
     void setBegining(Point const& point);
     void setEnd(Point const& point);
@@ -63,8 +61,8 @@ class Line
     bool operator==(Line const& another) const;
 
   protected:
-    Point *first;
-    Point *second;
+    Point first;
+    Point second;
 };
 
 #endif
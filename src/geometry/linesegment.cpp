@@ -14,9 +14,68 @@
 #include "polygon.h"
 #include "vector.h"
 #include "units.h"
+#include "predicates.h"
 #include "../debug.h"
 
 #include <cmath>
+#include <algorithm>
+
+namespace
+{
+  /**
+    Is the point closer than the tolerance to the line through
+    a and b? Distances are compared squared and normalized by
+    the length of ab, cross / length < epsilon.
+   */
+  inline bool isNearLine(double ax, double ay, double bx, double by,
+                         double squaredLength, double x, double y)
+  {
+    double cross = (bx - ax) * (y - ay) - (by - ay) * (x - ax);
+    double squaredEpsilon = libcity::COORDINATES_EPSILON * libcity::COORDINATES_EPSILON;
+    return cross * cross < squaredEpsilon * squaredLength;
+  }
+
+  inline double squaredLength(double ax, double ay, double bx, double by)
+  {
+    return (bx - ax) * (bx - ax) + (by - ay) * (by - ay);
+  }
+
+  /** Are both ends of segment cd within the tolerance from the line ab? */
+  inline bool liesOnLine(double cx, double cy, double dx, double dy,
+                         double ax, double ay, double bx, double by)
+  {
+    double length = squaredLength(ax, ay, bx, by);
+    if (length < libcity::COORDINATES_EPSILON * libcity::COORDINATES_EPSILON)
+    {
+      return false;
+    }
+
+    return isNearLine(ax, ay, bx, by, length, cx, cy) &&
+           isNearLine(ax, ay, bx, by, length, dx, dy);
+  }
+
+  /**
+    LineSegment::hasPoint2D() with the tolerance of liesOnLine(),
+    so both of them agree on nearly collinear segments.
+   */
+  bool liesOnSegment(Point const& point, LineSegment const& segment)
+  {
+    double ax = segment.begining().x(), ay = segment.begining().y(),
+           bx = segment.end().x(),      by = segment.end().y();
+    double length = squaredLength(ax, ay, bx, by);
+    if (length < libcity::COORDINATES_EPSILON * libcity::COORDINATES_EPSILON)
+    {
+      return segment.begining() == point;
+    }
+    if (!isNearLine(ax, ay, bx, by, length, point.x(), point.y()))
+    {
+      return false;
+    }
+
+    double dot = (point.x() - ax) * (bx - ax) + (point.y() - ay) * (by - ay);
+    return dot >= 0 && dot <= length;
+  }
+}
 
 LineSegment::LineSegment()
   : Line()
@@ -30,24 +89,13 @@ LineSegment::LineSegment(Point const& point, Vector const& vector)
   : Line(point, point + vector)
 {}
 
-LineSegment::LineSegment(LineSegment const& source)
-  : Line(source)
-{}
-
-LineSegment& LineSegment::operator=(LineSegment const& source)
-{
-  *first  = source.begining();
-  *second = source.end();
-  return *this;
-}
-
 LineSegment::~LineSegment()
 {}
 
 bool LineSegment::hasPoint2D(Point const& point) const
 {
-  double lineTest = (point.x() - first->x()) * (second->y() - first->y()) -
-                    (point.y() - first->y()) * (second->x() - first->x());
+  double lineTest = (point.x() - first.x()) * (second.y() - first.y()) -
+                    (point.y() - first.y()) * (second.x() - first.x());
 //   debug(std::abs(lineTest));
 //   debug(toString());
 //   debug(point.toString());
@@ -55,21 +103,21 @@ bool LineSegment::hasPoint2D(Point const& point) const
   /* Point is on the line */
   {
     double t = 0.0;
-    if (std::abs(first->x() - second->x()) > libcity::COORDINATES_EPSILON) //(first->x() != second->x()) 
+    if (std::abs(first.x() - second.x()) > libcity::COORDINATES_EPSILON) //(first.x() != second.x()) 
     {
-      t = (point.x() - first->x()) / (second->x() - first->x());
+      t = (point.x() - first.x()) / (second.x() - first.x());
       //debug(t);
       return t >= 0 && t <= 1;
     }
-    else if (std::abs(first->y() - second->y()) > libcity::COORDINATES_EPSILON) //(first->y() != second->y())
+    else if (std::abs(first.y() - second.y()) > libcity::COORDINATES_EPSILON) //(first.y() != second.y())
     {
-      t = (point.y() - first->y()) / (second->y() - first->y());
+      t = (point.y() - first.y()) / (second.y() - first.y());
       //debug(t);
       return t >= 0 && t <= 1;
     }
     else
     {
-      return (*first) == point;
+      return first == point;
     }
   }
 
@@ -79,49 +127,53 @@ bool LineSegment::hasPoint2D(Point const& point) const
 LineSegment::Intersection LineSegment::intersection2D(LineSegment const& another, Point* intersection) const
 // SOURCE: http://paulbourke.net/geometry/lineline2d/
 {
-  double denominator     = ((another.end().y() - another.begining().y())*(end().x() - begining().x())) -
-                           ((another.end().x() - another.begining().x())*(end().y() - begining().y())),
-         firstNumerator  = ((another.end().x() - another.begining().x())*(begining().y() - another.begining().y())) -
-                           ((another.end().y() - another.begining().y())*(begining().x() - another.begining().x())),
-         secondNumerator = ((end().x() - begining().x())*(begining().y() - another.begining().y())) -
-                           ((end().y() - begining().y())*(begining().x() - another.begining().x()));
-
-  if (std::abs(denominator) < libcity::COORDINATES_EPSILON)
-  /* If the denominator is 0, both lines have same direction vector */
+  /* Sides of the segments are decided exactly, the
+     tolerance is used only to classify collinear segments,
+     which are rarely exactly collinear after rounding. */
+  int anotherBeginingSide = Predicates::orientation(begining(), end(), another.begining()),
+      anotherEndSide      = Predicates::orientation(begining(), end(), another.end()),
+      beginingSide        = Predicates::orientation(another.begining(), another.end(), begining()),
+      endSide             = Predicates::orientation(another.begining(), another.end(), end());
+  bool crossing = anotherBeginingSide * anotherEndSide < 0 && beginingSide * endSide < 0;
+
+  if ((anotherBeginingSide == 0 && anotherEndSide == 0) || isNearlyCollinear(another))
+  /* Lines are coincident. */
   {
-    if  (std::abs(firstNumerator) < libcity::COORDINATES_EPSILON &&
-        std::abs(secondNumerator) < libcity::COORDINATES_EPSILON)
-    /* Lines are coincident. */
-    {
 
     /* WARNING
      * Order of following checks is important
      * for the right functionality. */
-      if (*this == another)
-      /* Line segments are identical */
-      {
-        return IDENTICAL;
-      }
+    if (*this == another)
+    /* Line segments are identical */
+    {
+      return IDENTICAL;
+    }
 
-      if (hasPoint2D(another.begining()) && hasPoint2D(another.end()))
-      /* This line is containing another. */
-      {
-        return CONTAINING;
-      }
+    bool hasAnotherBegining = liesOnSegment(another.begining(), *this),
+         hasAnotherEnd      = liesOnSegment(another.end(), *this);
 
-      if (another.hasPoint2D(begining()) && another.hasPoint2D(end()))
-      /* This line is contained in another. */
-      {
-        return CONTAINED;
-      }
+    if (hasAnotherBegining && hasAnotherEnd)
+    /* This line is containing another. */
+    {
+      return CONTAINING;
+    }
 
-      if (!this->hasPoint2D(another.begining()) &&
-          !this->hasPoint2D(another.end()))
-      /* Line segments are subsequent. */
+    if (liesOnSegment(begining(), another) && liesOnSegment(end(), another))
+    /* This line is contained in another. */
+    {
+      return CONTAINED;
+    }
+
+    if (!hasAnotherBegining && !hasAnotherEnd)
+    /* Line segments are subsequent, unless they really cross. */
+    {
+      if (!crossing)
       {
         return NONINTERSECTING;
       }
-
+    }
+    else
+    {
       if (begining() == another.begining() ||
           begining() == another.end())
       /* Line segments touch just in one point. */
@@ -141,25 +193,58 @@ LineSegment::Intersection LineSegment::intersection2D(LineSegment const& another
       /* Line segments overlap */
       return OVERLAPING;
     }
+  }
 
-    // Lines are parallel thus nonintersecting
+  if (anotherBeginingSide * anotherEndSide > 0 || beginingSide * endSide > 0)
+  /* Both ends of one of the segments lie on the same side of the other. */
+  {
     return NONINTERSECTING;
   }
 
-  double ua = firstNumerator  / denominator,
-         ub = secondNumerator / denominator;
-
-  if (ua >= 0 && ua <= 1 &&
-      ub >= 0 && ub <= 1
-     )
+  /* An end lying on the other segment is the intersection itself. */
+  if (anotherBeginingSide == 0)
   {
+    *intersection = another.begining();
+  }
+  else if (anotherEndSide == 0)
+  {
+    *intersection = another.end();
+  }
+  else if (beginingSide == 0)
+  {
+    *intersection = begining();
+  }
+  else if (endSide == 0)
+  {
+    *intersection = end();
+  }
+  else
+  {
+    double denominator     = ((another.end().y() - another.begining().y())*(end().x() - begining().x())) -
+                             ((another.end().x() - another.begining().x())*(end().y() - begining().y())),
+           firstNumerator  = ((another.end().x() - another.begining().x())*(begining().y() - another.begining().y())) -
+                             ((another.end().y() - another.begining().y())*(begining().x() - another.begining().x()));
+
+    /* Rounding can push the parameter slightly out of the segment. */
+    double ua = std::min(1.0, std::max(0.0, firstNumerator / denominator));
     intersection->setX(begining().x() + ua*(end().x() - begining().x()));
     intersection->setY(begining().y() + ua*(end().y() - begining().y()));
-
-    return INTERSECTING;
   }
 
-  return NONINTERSECTING;
+  return INTERSECTING;
+}
+
+bool LineSegment::isNearlyCollinear(LineSegment const& another) const
+{
+  return isNearlyCollinear(first.x(), first.y(), second.x(), second.y(),
+                           another.first.x(), another.first.y(), another.second.x(), another.second.y());
+}
+
+bool LineSegment::isNearlyCollinear(double ax, double ay, double bx, double by,
+                                    double cx, double cy, double dx, double dy)
+{
+  return liesOnLine(cx, cy, dx, dy, ax, ay, bx, by) ||
+         liesOnLine(ax, ay, bx, by, cx, cy, dx, dy);
 }
 
 LineSegment::Intersection LineSegment::intersection2D(Line const& another, Point* intersection) const
@@ -196,32 +281,32 @@ Point LineSegment::nearestPoint(Point const& point) const
   double parameter;
   Point orthogonalProjection;
 
-  parameter = (second->x() - first->x())*(point.x() - first->x()) +
-              (second->y() - first->y())*(point.y() - first->y()) +
-              (second->z() - first->z())*(point.z() - first->z());
+  parameter = (second.x() - first.x())*(point.x() - first.x()) +
+              (second.y() - first.y())*(point.y() - first.y()) +
+              (second.z() - first.z())*(point.z() - first.z());
 
   parameter /= length()*length();
 
   if (parameter >= 0 && parameter <=1)
   {
-    orthogonalProjection.setX((1 - parameter)*first->x() + second->x()*parameter);
-    orthogonalProjection.setY((1 - parameter)*first->y() + second->y()*parameter);
-    orthogonalProjection.setZ((1 - parameter)*first->z() + second->z()*parameter);
+    orthogonalProjection.setX((1 - parameter)*first.x() + second.x()*parameter);
+    orthogonalProjection.setY((1 - parameter)*first.y() + second.y()*parameter);
+    orthogonalProjection.setZ((1 - parameter)*first.z() + second.z()*parameter);
 
     return orthogonalProjection;
   }
   else
   {
-    double distanceToFirst  = Vector(point, *first).length();
-    double distanceToSecond = Vector(point, *second).length();
+    double distanceToFirst  = Vector(point, first).length();
+    double distanceToSecond = Vector(point, second).length();
 
     if (distanceToFirst < distanceToSecond)
     {
-      return *first;
+      return first;
     }
     else
     {
-      return *second;
+      return second;
     }
   }
 }
@@ -235,7 +320,7 @@ double LineSegment::distance(Point const& point) const
 
 double LineSegment::length() const
 {
-  Vector directionVector(*first, *second);
+  Vector directionVector(first, second);
   return directionVector.length();
 }
 
@@ -247,7 +332,7 @@ bool LineSegment::operator==(LineSegment const& another) const
 
 Vector LineSegment::normal() const
 {
-  Vector direction = *second - *first;
+  Vector direction = second - first;
 
   return Vector(-direction.y(), direction.x());
 }
@@ -255,5 +340,5 @@ Vector LineSegment::normal() const
 
 std::string LineSegment::toString() const
 {
-  return "LineSegment(" + first->toString() + ", " + second->toString() + ")";
+  return "LineSegment(" + first.toString() + ", " + second.toString() + ")";
 }
@@ -28,9 +28,6 @@ class LineSegment : public Line
     LineSegment(Point const& firstPoint, Point const& secondPoint);
     LineSegment(Point const& point, Vector const& vector);
 
-    LineSegment(LineSegment const& source); /**< Own copy constructor is neccessary */
-    LineSegment& operator=(LineSegment const& source); /**< Own assignment operator is neccessary */
-
     ~LineSegment();
 
     double length() const;
@@ -39,6 +36,19 @@ class LineSegment : public Line
     bool hasPoint2D(Point const& point) const;
     Intersection intersection2D(LineSegment const& another, Point* intersection) const;
     Intersection intersection2D(Line const& another, Point* intersection) const;
+
+    /**
+      Are the segments collinear within libcity::COORDINATES_EPSILON?
+     @remarks
+       True when both ends of one segment are closer than the
+       tolerance to the line of the other. intersection2D()
+       classifies such segments as coincident.
+     */
+    bool isNearlyCollinear(LineSegment const& another) const;
+
+    /** isNearlyCollinear() of segments ab and cd, without creating them. */
+    static bool isNearlyCollinear(double ax, double ay, double bx, double by,
+                                  double cx, double cy, double dx, double dy);
     double distance(Point const& point) const;
     Point nearestPoint(Point const& point) const;
 
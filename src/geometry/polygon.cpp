@@ -16,31 +16,33 @@
 #include "linesegment.h"
 #include "line.h"
 #include "ray.h"
+#include "predicates.h"
+#include "batch.h"
+#include "segmentsweep.h"
+#include "triangulator.h"
 #include "../debug.h"
 
 #include <cmath>
-
-void Polygon::initialize()
-{
-  vertices = new std::vector<Point*>;
-}
+#include <utility>
+#include <algorithm>
 
 Polygon::Polygon()
-{
-  initialize();
-}
+  : vertices()
+{}
 
 Polygon::Polygon(Point const& one, Point const& two, Point const& three)
+  : vertices()
 {
-  initialize();
+  vertices.reserve(3);
   addVertex(one);
   addVertex(two);
   addVertex(three);
 }
 
 Polygon::Polygon(Point const& one, Point const& two, Point const& three, Point const& four)
+  : vertices()
 {
-  initialize();
+  vertices.reserve(4);
   addVertex(one);
   addVertex(two);
   addVertex(three);
@@ -48,56 +50,58 @@ Polygon::Polygon(Point const& one, Point const& two, Point const& three, Point c
 }
 
 Polygon::Polygon(Polygon const& source)
+  : vertices()
 {
-  initialize();
-
-  for (std::vector<Point*>::iterator vertex = source.vertices->begin();
-       vertex != source.vertices->end();
-       vertex++)
-  {
-    addVertex(**vertex);
-  }
+  copyVertices(source);
 }
 
 Polygon& Polygon::operator=(Polygon const& source)
 {
-  freeVertices();
-  initialize();
-
-  for (std::vector<Point*>::iterator vertex = source.vertices->begin();
-       vertex != source.vertices->end();
-       vertex++)
+  if (this != &source)
   {
-    addVertex(**vertex);
+    vertices.clear();
+    copyVertices(source);
   }
-
   return *this;
 }
 
-Polygon::~Polygon()
+void Polygon::copyVertices(Polygon const& source)
 {
-  freeVertices();
+  /* Copies go through addVertex(), so that the vertices
+     updated to the same position are merged. */
+  vertices.reserve(source.vertices.size());
+  for (std::vector<Point>::const_iterator vertex = source.vertices.begin();
+       vertex != source.vertices.end();
+       vertex++)
+  {
+    addVertex(*vertex);
+  }
 }
 
-void Polygon::freeVertices()
+Polygon::Polygon(Polygon&& source)
+  : vertices(std::move(source.vertices))
+{}
+
+Polygon& Polygon::operator=(Polygon&& source)
 {
-  while (!vertices->empty())
+  if (this != &source)
   {
-    delete vertices->back();
-    vertices->pop_back();
+    vertices = std::move(source.vertices);
   }
-
-  delete vertices;
+  return *this;
 }
 
+Polygon::~Polygon()
+{}
+
 unsigned int Polygon::numberOfVertices() const
 {
-  return vertices->size();
+  return vertices.size();
 }
 
 void Polygon::clear()
 {
-  vertices->clear();
+  vertices.clear();
 }
 
 void Polygon::addVertex(Point const& vertex)
@@ -105,7 +109,7 @@ void Polygon::addVertex(Point const& vertex)
   /* To avoid zero length edges. */
   if (numberOfVertices() > 0)
   {
-    double distanceFromLast = Vector(vertex, *vertices->back()).length();
+    double distanceFromLast = Vector(vertex, vertices.back()).length();
 
     if (distanceFromLast <= libcity::COORDINATES_EPSILON)
     {
@@ -113,33 +117,31 @@ void Polygon::addVertex(Point const& vertex)
     }
   }
 
-  vertices->push_back(new Point(vertex));
+  vertices.push_back(vertex);
 
   // FIXME: check if the vertex is in a plane with other vertices!
 }
 
 void Polygon::updateVertex(unsigned int number, Point const& vertex)
 {
-  assert(number < vertices->size());
-  *vertices->at(number) = vertex;
+  assert(number < vertices.size());
+  vertices.at(number) = vertex;
 }
 
 void Polygon::removeVertex(unsigned int number)
 {
-  if (number >= vertices->size())
+  if (number >= vertices.size())
   {
     // FIXME throw out of range exception
   }
 
-  Point *removedVertex = vertices->at(number);
-  vertices->erase(vertices->begin() + number);
-  delete removedVertex;
+  vertices.erase(vertices.begin() + number);
 }
 
 Point Polygon::vertex(unsigned int number) const
 {
   assert(number < numberOfVertices());
-  return *vertices->at(number);
+  return vertices.at(number);
 }
 
 LineSegment Polygon::edge(unsigned int number) const
@@ -147,7 +149,7 @@ LineSegment Polygon::edge(unsigned int number) const
   assert(numberOfVertices() >= 2);
   assert(number < (numberOfVertices()));
 
-  return LineSegment(*vertices->at(number), *vertices->at((number + 1) % numberOfVertices()));
+  return LineSegment(vertices.at(number), vertices.at((number + 1) % numberOfVertices()));
 }
 
 double Polygon::area() const
@@ -161,13 +163,13 @@ double Polygon::signedArea() const
 
   unsigned int currentVertexPosition = 0,
                count = numberOfVertices();
-  Point *currentVertex = 0,
-        *nextVertex = 0;
+  Point const *currentVertex = 0,
+              *nextVertex = 0;
 
   for (currentVertexPosition = 0; currentVertexPosition < count; currentVertexPosition++)
   {
-    currentVertex = vertices->at(currentVertexPosition);
-    nextVertex    = vertices->at((currentVertexPosition + 1) % count);
+    currentVertex = &vertices[currentVertexPosition];
+    nextVertex    = &vertices[(currentVertexPosition + 1) % count];
 
     area += currentVertex->x() * nextVertex->y() - currentVertex->y() * nextVertex->x();
   }
@@ -184,13 +186,13 @@ Point Polygon::centroid() const
 
   unsigned int currentVertexPosition = 0,
                count = numberOfVertices();
-  Point *currentVertex = 0,
-        *nextVertex = 0;
+  Point const *currentVertex = 0,
+              *nextVertex = 0;
 
   for (currentVertexPosition = 0; currentVertexPosition < count; currentVertexPosition++)
   {
-    currentVertex = vertices->at(currentVertexPosition);
-    nextVertex    = vertices->at((currentVertexPosition + 1) % count);
+    currentVertex = &vertices[currentVertexPosition];
+    nextVertex    = &vertices[(currentVertexPosition + 1) % count];
 
     areaStep = currentVertex->x() * nextVertex->y() - nextVertex->x() * currentVertex->y();
     area += areaStep;
@@ -207,16 +209,16 @@ bool Polygon::encloses2D(Point const& point) const
 {
   unsigned int currentVertexPosition = 0,
                count = numberOfVertices();
-  Point *currentVertex = 0,
-        *nextVertex = 0;
+  Point const *currentVertex = 0,
+              *nextVertex = 0;
   LineSegment currentLine;
 
   bool isInside = false;
 
   for (currentVertexPosition = 0; currentVertexPosition < count; currentVertexPosition++)
   {
-    currentVertex = vertices->at(currentVertexPosition);
-    nextVertex    = vertices->at((currentVertexPosition + 1) % count);
+    currentVertex = &vertices[currentVertexPosition];
+    nextVertex    = &vertices[(currentVertexPosition + 1) % count];
 
     /* The algorithm is unreilable at the edges so
      * we check them separately to make sure. */
@@ -227,12 +229,17 @@ bool Polygon::encloses2D(Point const& point) const
       return true;
     }
 
-    if (((currentVertex->y() > point.y()) != (nextVertex->y() > point.y())) &&
-        (point.x() < (nextVertex->x() - currentVertex->x()) / (nextVertex->y() - currentVertex->y())
-                     * (point.y() - currentVertex->y()) + currentVertex->x())
-       )
+    bool nextIsAbove = nextVertex->y() > point.y();
+    if ((currentVertex->y() > point.y()) != nextIsAbove)
+    /* The edge crosses the horizontal line through the point. The point
+       is left of it if it's on the left side of an upward edge or on
+       the right side of a downward one. */
     {
-       isInside = !isInside;
+      int side = Predicates::orientation(*currentVertex, *nextVertex, point);
+      if (side != 0 && (side > 0) == nextIsAbove)
+      {
+        isInside = !isInside;
+      }
     }
   }
 
@@ -244,7 +251,7 @@ Vector Polygon::normal() const
 {
   assert(numberOfVertices() >= 3);
 
-  Vector first(*vertices->at(1), *vertices->at(0)),
+  Vector first(vertices.at(1), vertices.at(0)),
          second;
 
   first.normalize();
@@ -254,7 +261,7 @@ Vector Polygon::normal() const
   {
     current = i;
     next = (i + 1) % verticesCount;
-    second.set(*vertices->at(current), *vertices->at(next));
+    second.set(vertices.at(current), vertices.at(next));
     second.normalize();
 
     /* Edges are not parallel */
@@ -278,15 +285,15 @@ Vector Polygon::edgeNormal(unsigned int edgeNumber) const
   int first  = edgeNumber;
   int second = (edgeNumber + 1) % verticesNumber;
 
-  Vector direction(*(vertices->at(first)), *(vertices->at(second))),
+  Vector direction(vertices.at(first), vertices.at(second)),
          normalVector;
 
   normalVector = direction.crossProduct(normal());
   normalVector.normalize();
 
-  Point edgeCenter((vertices->at(first)->x() + vertices->at(second)->x())/2,
-                   (vertices->at(first)->y() + vertices->at(second)->y())/2,
-                   (vertices->at(first)->z() + vertices->at(second)->z())/2);
+  Point edgeCenter((vertices.at(first).x() + vertices.at(second).x())/2,
+                   (vertices.at(first).y() + vertices.at(second).y())/2,
+                   (vertices.at(first).z() + vertices.at(second).z())/2);
 
   Ray testRay(edgeCenter, normalVector);
 
@@ -315,15 +322,16 @@ Vector Polygon::edgeNormal(unsigned int edgeNumber) const
 
 bool Polygon::isSubAreaOf(Polygon const& biggerPolygon)
 {
+  Batch::PointArray points;
+  points.reserve(numberOfVertices());
   for (unsigned int i = 0; i < numberOfVertices(); i++)
   {
-    if (!biggerPolygon.encloses2D(*(*vertices)[i]))
-    {
-      return false;
-    }
+    points.push_back(vertices[i]);
   }
 
-  return true;
+  std::vector<bool> isInside;
+  Batch::encloses2D(biggerPolygon, points, &isInside);
+  return std::find(isInside.begin(), isInside.end(), false) == isInside.end();
 }
 
 
@@ -557,11 +565,36 @@ void Polygon::substractEdge(int edgeNumber, double distance)
 
 bool Polygon::isNonSelfIntersecting()
 {
-  std::vector<Point> points;
-  std::vector<int> sequence;
+  unsigned int count = numberOfVertices();
+  if (count < 3 || signedArea() == 0)
+  /* Degenerate */
+  {
+    return false;
+  }
+
+  std::vector<LineSegment> edges;
+  edges.reserve(count);
+  for (unsigned int i = 0; i < count; i++)
+  {
+    edges.push_back(LineSegment(vertices[i], vertices[(i + 1) % count]));
+  }
 
-  return triangulation(&points, &sequence);
+  std::vector<SegmentSweep::Crossing> crossings;
+  SegmentSweep(edges).findCrossings(&crossings);
+  for (std::vector<SegmentSweep::Crossing>::iterator crossing = crossings.begin();
+       crossing != crossings.end();
+       crossing++)
+  {
+    bool adjacent = crossing->second == crossing->first + 1 ||
+                    (crossing->first == 0 && crossing->second == static_cast<int>(count) - 1);
+    if (!adjacent || crossing->type != LineSegment::INTERSECTING)
+    /* Neighbouring edges may only share their common vertex. */
+    {
+      return false;
+    }
+  }
 
+  return true;
 }
 
 bool Polygon::isClosed() const
@@ -575,152 +608,23 @@ std::string Polygon::toString() const
 
   for (unsigned int i = 0; i < numberOfVertices(); i++)
   {
-    output += (*vertices)[i]->toString() + ", ";
+    output += vertices[i].toString() + ", ";
   }
   return output + ").";
 }
 
 
 
-   /*
-     isInsideTriangle decides if a point P is Inside of the triangle
-     defined by A, B, C.
-   */
-bool Polygon::isInsideTriangle(double Ax, double Ay,
-                      double Bx, double By,
-                      double Cx, double Cy,
-                      double Px, double Py)
-
-{
-  double ax, ay, bx, by, cx, cy, apx, apy, bpx, bpy, cpx, cpy;
-  double cCROSSap, bCROSScp, aCROSSbp;
-
-  ax = Cx - Bx;  ay = Cy - By;
-  bx = Ax - Cx;  by = Ay - Cy;
-  cx = Bx - Ax;  cy = By - Ay;
-  apx= Px - Ax;  apy= Py - Ay;
-  bpx= Px - Bx;  bpy= Py - By;
-  cpx= Px - Cx;  cpy= Py - Cy;
-
-  aCROSSbp = ax*bpy - ay*bpx;
-  cCROSSap = cx*apy - cy*apx;
-  bCROSScp = bx*cpy - by*cpx;
-
-  return ((aCROSSbp >= 0.0) && (bCROSScp >= 0.0) && (cCROSSap >= 0.0));
-}
-
-bool Polygon::snip(int u,int v,int w,int n,int *V)
-{
-  int p;
-  double Ax, Ay, Bx, By, Cx, Cy, Px, Py;
-
-  Ax = (*vertices)[V[u]]->x();
-  Ay = (*vertices)[V[u]]->y();
-
-  Bx = (*vertices)[V[v]]->x();
-  By = (*vertices)[V[v]]->y();
-
-  Cx = (*vertices)[V[w]]->x();
-  Cy = (*vertices)[V[w]]->y();
-
-  if ( libcity::EPSILON > (((Bx-Ax)*(Cy-Ay)) - ((By-Ay)*(Cx-Ax))) )
-  {
-    return false;
-  }
-
-  for (p=0;p<n;p++)
-  {
-    if( (p == u) || (p == v) || (p == w) ) continue;
-    Px = (*vertices)[V[p]]->x();
-    Py = (*vertices)[V[p]]->y();
-    if (isInsideTriangle(Ax,Ay,Bx,By,Cx,Cy,Px,Py)) return false;
-  }
-
-  return true;
-}
-
 std::vector<Point> Polygon::triangulate()
 {
   std::vector<Point> points;
-  std::vector<int> sequence;
-
-  triangulation(&points, &sequence);
-
+  Triangulator().triangulate(*this, &points);
   return points;
 }
 
 std::vector<int> Polygon::getSurfaceIndexes()
 {
-  std::vector<Point> points;
   std::vector<int> sequence;
-
-  triangulation(&points, &sequence);
-
+  Triangulator().triangulate(*this, &sequence);
   return sequence;
 }
-
-bool Polygon::triangulation(std::vector<Point> *points, std::vector<int> *sequence)
-{
-  /* allocate and initialize list of Vertices in polygon */
-  assert(numberOfVertices() >= 3);
-
-  int n = vertices->size();
-
-  int *V = new int[n];
-
-  /* we want a counter-clockwise polygon in V */
-
-  if ( 0.0 < signedArea() )
-    for (int v=0; v<n; v++) V[v] = v;
-  else
-    for(int v=0; v<n; v++) V[v] = (n-1)-v;
-
-  int nv = n;
-
-  /*  remove nv-2 Vertices, creating 1 triangle every time */
-  int count = 2*nv;   /* error detection */
-
-  for(int m=0, v=nv-1; nv>2; )
-  {
-    /* if we loop, it is probably a non-simple polygon */
-    if (0 >= (count--))
-    {
-      //** Triangulate: ERROR - probable bad polygon!
-      return false;
-    }
-
-    /* three consecutive vertices in current polygon, <u,v,w> */
-    int u = v  ; if (nv <= u) u = 0;     /* previous */
-    v = u+1; if (nv <= v) v = 0;     /* new v    */
-    int w = v+1; if (nv <= w) w = 0;     /* next     */
-
-    if ( snip(u,v,w,nv,V) )
-    {
-      int a,b,c,s,t;
-
-      /* true names of the vertices */
-      a = V[u]; b = V[v]; c = V[w];
-
-      /* output Triangle */
-      points->push_back( *((*vertices)[a]) );
-      points->push_back( *((*vertices)[b]) );
-      points->push_back( *((*vertices)[c]) );
-
-      sequence->push_back(a);
-      sequence->push_back(b);
-      sequence->push_back(c);
-
-      m++;
-
-      /* remove v from remaining polygon */
-      for(s=v,t=v+1;t<nv;s++,t++) V[s] = V[t]; nv--;
-
-      /* resest error detection counter */
-      count = 2*nv;
-    }
-  }
-
-  delete V;
-
-  return true;
-}
\ No newline at end of file
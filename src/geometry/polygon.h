@@ -16,7 +16,8 @@
 #include <string>
 #include <list>
 
-class Point;
+#include "point.h"
+
 class Vector;
 class LineSegment;
 class Line;
@@ -31,10 +32,14 @@ class Polygon
     Polygon(Polygon const& source);
     Polygon& operator=(Polygon const& source);
 
+    /** Moving takes over the vertices without copying them. */
+    Polygon(Polygon&& source);
+    Polygon& operator=(Polygon&& source);
+
     ~Polygon();
 
   private:
-    std::vector<Point*> *vertices;
+    std::vector<Point> vertices;
 
   public:
     Point vertex(unsigned int number) const;
@@ -110,9 +115,19 @@ class Polygon
 
     bool encloses2D(Point const& point) const;
 
+    /**
+      Do edges of the polygon meet only at their common
+      vertices? Edges are tested by SegmentSweep.
+     @return False for self-intersecting and degenerate polygons.
+     */
     bool isNonSelfIntersecting();
     bool isClosed() const;
 
+    /**
+      Triangles covering the polygon (see Triangulator, use it
+      directly to triangulate many polygons without allocations).
+     @return Three points or vertex indexes for each triangle.
+     */
     std::vector<Point> triangulate();
     std::vector<int> getSurfaceIndexes();
 
@@ -121,31 +136,13 @@ class Polygon
 
     std::string toString() const;
   private:
-    void initialize();
-    void freeVertices();
+    void copyVertices(Polygon const& source);
 
     double signedArea() const;
 
     /* Helper functions for split polygon */
     bool isVertexIntersection(Point vertex, std::list<Point> intersections);
     bool areVerticesInPair(Point first, Point second, std::list<Point> intersections);
-
-  private:
-    /* Polygon triangulation */
-    /* Taken from:
-     * http://www.flipcode.com/archives/Efficient_Polygon_Triangulation.shtml */ 
-    // triangulate a contour/polygon, places results in STL vector
-    // as series of triangles.
-    bool triangulation(std::vector<Point> *points, std::vector<int> *sequence);
-
-    // decide if point Px/Py is inside triangle defined by
-    // (Ax,Ay) (Bx,By) (Cx,Cy)
-    bool isInsideTriangle(double Ax, double Ay,
-                        double Bx, double By,
-                        double Cx, double Cy,
-                        double Px, double Py);
-
-    bool snip(int u,int v,int w,int n,int *V);
 };
 
 #endif
\ No newline at end of file
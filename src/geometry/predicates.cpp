@@ -0,0 +1,310 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/predicates.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see geometry/predicates.h
+ *
+ */
+
+#include "predicates.h"
+#include "point.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  /** Half of the distance between 1 and the next double. */
+  const double EPSILON = std::ldexp(1.0, -53);
+
+  /** Error bound of the double evaluation of inCircle() (Shewchuk). */
+  const double IN_CIRCLE_ERROR_BOUND = (10.0 + 96.0 * EPSILON) * EPSILON;
+
+  /**
+    Floating-point expansion. The exact value is the sum of
+    the components, they don't overlap and grow in magnitude.
+   */
+  typedef std::vector<double> Expansion;
+
+  inline int sign(double value)
+  {
+    return (value > 0) - (value < 0);
+  }
+
+  /** sum + error == a + b exactly */
+  inline void twoSum(double a, double b, double* sum, double* error)
+  {
+    double x = a + b,
+           bVirtual = x - a,
+           aVirtual = x - bVirtual;
+    *sum = x;
+    *error = (a - aVirtual) + (b - bVirtual);
+  }
+
+  /** product + error == a * b exactly */
+  inline void twoProduct(double a, double b, double* product, double* error)
+  {
+    double x = a * b;
+    *product = x;
+    *error = std::fma(a, b, -x);
+  }
+
+  /**
+    Add a double to an expansion stored in an array, zero
+    components are dropped. The array must have room for
+    one more component.
+   @return New number of the components.
+   */
+  int grow(double* components, int length, double value)
+  {
+    double carry = value, error;
+    int kept = 0;
+    for (int i = 0; i < length; i++)
+    {
+      twoSum(carry, components[i], &carry, &error);
+      if (error != 0)
+      {
+        components[kept++] = error;
+      }
+    }
+    if (carry != 0 || kept == 0)
+    {
+      components[kept++] = carry;
+    }
+    return kept;
+  }
+
+  /** The largest component decides the sign. */
+  int sign(double const* components, int length)
+  {
+    for (int i = length - 1; i >= 0; i--)
+    {
+      if (components[i] != 0)
+      {
+        return sign(components[i]);
+      }
+    }
+    return 0;
+  }
+
+  Expansion difference(double a, double b)
+  {
+    double sum, error;
+    twoSum(a, -b, &sum, &error);
+    Expansion result;
+    if (error != 0)
+    {
+      result.push_back(error);
+    }
+    result.push_back(sum);
+    return result;
+  }
+
+  /** Components of both merged by magnitude and summed in one pass. */
+  Expansion sum(Expansion const& first, Expansion const& second)
+  {
+    Expansion merged(first.size() + second.size());
+    std::merge(first.begin(), first.end(), second.begin(), second.end(), merged.begin(),
+               [](double a, double b) { return std::abs(a) < std::abs(b); });
+
+    Expansion result;
+    result.reserve(merged.size());
+    double carry = merged[0], error;
+    for (unsigned int i = 1; i < merged.size(); i++)
+    {
+      twoSum(carry, merged[i], &carry, &error);
+      if (error != 0)
+      {
+        result.push_back(error);
+      }
+    }
+    if (carry != 0 || result.empty())
+    {
+      result.push_back(carry);
+    }
+    return result;
+  }
+
+  Expansion scale(Expansion const& expansion, double factor)
+  {
+    Expansion result;
+    result.reserve(2 * expansion.size());
+    double carry, error, partial, partialError;
+    twoProduct(expansion[0], factor, &carry, &error);
+    if (error != 0)
+    {
+      result.push_back(error);
+    }
+    for (unsigned int i = 1; i < expansion.size(); i++)
+    {
+      twoProduct(expansion[i], factor, &partial, &partialError);
+      twoSum(carry, partialError, &carry, &error);
+      if (error != 0)
+      {
+        result.push_back(error);
+      }
+      twoSum(partial, carry, &carry, &error);
+      if (error != 0)
+      {
+        result.push_back(error);
+      }
+    }
+    if (carry != 0 || result.empty())
+    {
+      result.push_back(carry);
+    }
+    return result;
+  }
+
+  Expansion product(Expansion const& first, Expansion const& second)
+  {
+    Expansion result = scale(first, second[0]);
+    for (unsigned int i = 1; i < second.size(); i++)
+    {
+      result = sum(result, scale(first, second[i]));
+    }
+    return result;
+  }
+
+  Expansion negate(Expansion expansion)
+  {
+    for (unsigned int i = 0; i < expansion.size(); i++)
+    {
+      expansion[i] = -expansion[i];
+    }
+    return expansion;
+  }
+
+  int exactOrientation(double ax, double ay, double bx, double by, double cx, double cy)
+  {
+    /* (ax - cx)(by - cy) - (ay - cy)(bx - cx) expanded, so only
+       the products of the coordinates have to be exact. */
+    double terms[][2] = {{ax, by}, {-ax, cy}, {-cx, by}, {-ay, bx}, {ay, cx}, {cy, bx}};
+    const int TERMS = sizeof(terms)/sizeof(terms[0]);
+
+    double determinant[2 * TERMS + 1];
+    int length = 0;
+    for (int i = 0; i < TERMS; i++)
+    {
+      double partial, error;
+      twoProduct(terms[i][0], terms[i][1], &partial, &error);
+      length = grow(determinant, length, error);
+      length = grow(determinant, length, partial);
+    }
+    return sign(determinant, length);
+  }
+
+  int exactInCircle(Point const& a, Point const& b, Point const& c, Point const& d)
+  {
+    Expansion adx = difference(a.x(), d.x()), ady = difference(a.y(), d.y()),
+              bdx = difference(b.x(), d.x()), bdy = difference(b.y(), d.y()),
+              cdx = difference(c.x(), d.x()), cdy = difference(c.y(), d.y());
+
+    Expansion aLift = sum(product(adx, adx), product(ady, ady)),
+              bLift = sum(product(bdx, bdx), product(bdy, bdy)),
+              cLift = sum(product(cdx, cdx), product(cdy, cdy));
+
+    Expansion bc = sum(product(bdx, cdy), negate(product(cdx, bdy))),
+              ca = sum(product(cdx, ady), negate(product(adx, cdy))),
+              ab = sum(product(adx, bdy), negate(product(bdx, ady)));
+
+    Expansion determinant = sum(sum(product(aLift, bc), product(bLift, ca)), product(cLift, ab));
+    return sign(&determinant[0], determinant.size());
+  }
+}
+
+namespace Predicates
+{
+  const double ORIENTATION_ERROR_BOUND = (3.0 + 16.0 * EPSILON) * EPSILON;
+
+  int orientation(double ax, double ay, double bx, double by, double cx, double cy)
+  {
+    double left  = (ax - cx) * (by - cy),
+           right = (ay - cy) * (bx - cx),
+           determinant = left - right,
+           bound = ORIENTATION_ERROR_BOUND * (std::abs(left) + std::abs(right));
+
+    if (std::abs(determinant) > bound || bound == 0)
+    {
+      return sign(determinant);
+    }
+
+    return exactOrientation(ax, ay, bx, by, cx, cy);
+  }
+
+  int orientation(Point const& a, Point const& b, Point const& c)
+  {
+    return orientation(a.x(), a.y(), b.x(), b.y(), c.x(), c.y());
+  }
+
+  int inCircle(Point const& a, Point const& b, Point const& c, Point const& d)
+  {
+    double adx = a.x() - d.x(), ady = a.y() - d.y(),
+           bdx = b.x() - d.x(), bdy = b.y() - d.y(),
+           cdx = c.x() - d.x(), cdy = c.y() - d.y();
+
+    double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy,
+           cdxady = cdx * ady, adxcdy = adx * cdy,
+           adxbdy = adx * bdy, bdxady = bdx * ady;
+
+    double aLift = adx * adx + ady * ady,
+           bLift = bdx * bdx + bdy * bdy,
+           cLift = cdx * cdx + cdy * cdy;
+
+    double determinant = aLift * (bdxcdy - cdxbdy) +
+                         bLift * (cdxady - adxcdy) +
+                         cLift * (adxbdy - bdxady);
+    double permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * aLift +
+                       (std::abs(cdxady) + std::abs(adxcdy)) * bLift +
+                       (std::abs(adxbdy) + std::abs(bdxady)) * cLift,
+           bound = IN_CIRCLE_ERROR_BOUND * permanent;
+
+    if (std::abs(determinant) > bound || bound == 0)
+    {
+      return sign(determinant);
+    }
+
+    return exactInCircle(a, b, c, d);
+  }
+
+  SegmentRelation segmentRelation(Point const& a, Point const& b,
+                                  Point const& c, Point const& d)
+  {
+    int cSide = orientation(a, b, c),
+        dSide = orientation(a, b, d),
+        aSide = orientation(c, d, a),
+        bSide = orientation(c, d, b);
+
+    if (cSide == 0 && dSide == 0 && aSide == 0 && bSide == 0)
+    /* Collinear, compare the segments along the line. */
+    {
+      bool vertical = a.x() == b.x() && b.x() == c.x() && c.x() == d.x();
+      double first[]  = {vertical ? a.y() : a.x(), vertical ? b.y() : b.x()},
+             second[] = {vertical ? c.y() : c.x(), vertical ? d.y() : d.x()};
+
+      double low  = std::max(std::min(first[0], first[1]), std::min(second[0], second[1])),
+             high = std::min(std::max(first[0], first[1]), std::max(second[0], second[1]));
+      if (low > high)
+      {
+        return DISJOINT;
+      }
+      return low == high ? TOUCHING : OVERLAPPING;
+    }
+
+    if (cSide * dSide > 0 || aSide * bSide > 0)
+    {
+      return DISJOINT;
+    }
+
+    if (cSide == 0 || dSide == 0 || aSide == 0 || bSide == 0)
+    {
+      return TOUCHING;
+    }
+
+    return CROSSING;
+  }
+}
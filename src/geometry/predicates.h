@@ -0,0 +1,72 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/predicates.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Exact geometric predicates
+ *
+ * Decisions like "which side of a line is this point on"
+ * made with plain doubles are wrong when the answer is close
+ * to zero, and comparing against EPSILON only moves the problem
+ * elsewhere (and breaks at large coordinates). The predicates
+ * here always return the sign of the exact result.
+ *
+ * Each predicate is first evaluated with doubles together with
+ * a bound of its rounding error (see Shewchuk, Adaptive Precision
+ * Floating-Point Arithmetic and Fast Robust Geometric Predicates).
+ * Only when the result is smaller than the bound, it's computed
+ * again exactly with floating-point expansions. That happens only
+ * for (nearly) degenerate input, so the common case costs a few
+ * multiplications and one comparison.
+ *
+ * Only x and y coordinates are used.
+ */
+
+#ifndef _PREDICATES_H_
+#define _PREDICATES_H_
+
+class Point;
+
+namespace Predicates
+{
+  /**
+    Relative error bound of the double evaluation of orientation()
+    (Shewchuk). Vectorized code decides with the same bound and
+    calls orientation() only when the result is within it.
+   */
+  extern const double ORIENTATION_ERROR_BOUND;
+
+  /**
+    Orientation of three points.
+   @return 1 if a, b, c turn counterclockwise, -1 if
+           they turn clockwise and 0 if they are collinear.
+   */
+  int orientation(Point const& a, Point const& b, Point const& c);
+  int orientation(double ax, double ay, double bx, double by, double cx, double cy);
+
+  /**
+    Position of a point relative to a circle.
+   @param[in] a, b, c Points on the circle in counterclockwise order.
+   @return 1 if d is inside the circle, -1 if it's
+           outside and 0 if it lies on the circle.
+   */
+  int inCircle(Point const& a, Point const& b, Point const& c, Point const& d);
+
+  enum SegmentRelation
+  {
+    DISJOINT = 0,
+    CROSSING,     /**< Segments cross in a point inside both of them. */
+    TOUCHING,     /**< They share a single point, an end of at least one of them. */
+    OVERLAPPING   /**< Collinear with more than one common point. */
+  };
+
+  /**
+    Relation of line segments ab and cd.
+   */
+  SegmentRelation segmentRelation(Point const& a, Point const& b,
+                                  Point const& c, Point const& d);
+}
+
+#endif
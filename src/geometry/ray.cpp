@@ -15,87 +15,50 @@
 #include "line.h"
 #include "linesegment.h"
 #include "units.h"
+#include "predicates.h"
 #include "../debug.h"
 
 #include <cmath>
 
 Ray::Ray()
-{
-  initialize();
-  rayOrigin->set(0,0,0);
-  rayDirection->set(1,0,0);
-}
+  : rayOrigin(0,0,0), rayDirection(1,0,0)
+{}
 
 Ray::Ray(Point const& point, Vector const& vector)
-{
-  initialize();
-  *rayOrigin = point;
-  *rayDirection = vector;
-}
+  : rayOrigin(point), rayDirection(vector)
+{}
 
 Ray::Ray(Point const& firstPoint, Point const& secondPoint)
-{
-  initialize();
-  *rayOrigin = firstPoint;
-  *rayDirection = Vector(firstPoint, secondPoint);
-}
-
-Ray::Ray(Ray const& source)
-{
-  initialize();
-  *rayOrigin = source.origin();
-  *rayDirection = source.direction();
-}
-
-Ray& Ray::operator=(Ray const& source)
-{
-  *rayOrigin = source.origin();
-  *rayDirection = source.direction();
-  return *this;
-}
-
-void Ray::initialize()
-{
-  rayOrigin = new Point();
-  rayDirection = new Vector();
-}
+  : rayOrigin(firstPoint), rayDirection(firstPoint, secondPoint)
+{}
 
 Ray::~Ray()
-{
-  freeMemory();
-}
-
-void Ray::freeMemory()
-{
-  delete rayOrigin;
-  delete rayDirection;
-}
+{}
 
 void Ray::set(Point const& point, Vector const& vector)
 {
-  *rayOrigin = point;
-  *rayDirection = vector;
+  rayOrigin = point;
+  rayDirection = vector;
 }
 
 void Ray::setOrigin(Point const& point)
 {
-  *rayOrigin = point;
+  rayOrigin = point;
 }
 
 void Ray::setDirection(Vector const& vector)
 {
-
-  *rayDirection = vector;
+  rayDirection = vector;
 }
 
 Point Ray::origin() const
 {
-  return *rayOrigin;
+  return rayOrigin;
 }
 
 Vector Ray::direction() const
 {
-  return *rayDirection;
+  return rayDirection;
 }
 
 
@@ -110,7 +73,7 @@ Ray::Intersection Ray::intersection2D(Ray const& another, Point* intersection) c
          x3 = another.origin().x(), y3 = another.origin().y(),
          x4 = another.origin().x() + another.direction().x(), y4 = another.origin().y() + another.direction().y();
 
-  if (std::abs((y2 - y1) / (x2 - x1) - (y4 - y3) / (x4 - x3)) > libcity::EPSILON)
+  if (Predicates::orientation(0, 0, x2 - x1, y2 - y1, x4 - x3, y4 - y3) != 0)
   /* Make sure the lines aren't parallel */
   {
     d = (((x2 - x1) * (y4 - y3)) - (y2 - y1) * (x4 - x3));
@@ -146,12 +109,7 @@ Ray::Intersection Ray::intersection2D(Line const& another, Point* intersection)
          x3 = another.begining().x(), y3 = another.begining().y(),
          x4 = another.end().x(), y4 = another.end().y();
 
-  if ((x2 - x1) == 0 && (x2 - x1) == (x4 - x3))
-  {
-    return PARALLEL;
-  }
-
-  if (std::abs((y2 - y1) / (x2 - x1) - (y4 - y3) / (x4 - x3)) > libcity::EPSILON)
+  if (Predicates::orientation(0, 0, x2 - x1, y2 - y1, x4 - x3, y4 - y3) != 0)
   /* Make sure the lines aren't parallel */
   {
     d = (((x2 - x1) * (y4 - y3)) - (y2 - y1) * (x4 - x3));
@@ -184,7 +142,7 @@ Ray::Intersection Ray::intersection2D(LineSegment const& another, Point* interse
          x3 = another.begining().x(), y3 = another.begining().y(),
          x4 = another.end().x(), y4 = another.end().y();
 
-  if (std::abs((y2 - y1) / (x2 - x1) - (y4 - y3) / (x4 - x3)) > libcity::COORDINATES_EPSILON)
+  if (Predicates::orientation(0, 0, x2 - x1, y2 - y1, x4 - x3, y4 - y3) != 0)
   /* Make sure the lines aren't parallel */
   {
     d = (((x2 - x1) * (y4 - y3)) - (y2 - y1) * (x4 - x3));
@@ -212,5 +170,5 @@ Ray::Intersection Ray::intersection2D(LineSegment const& another, Point* interse
 
 std::string Ray::toString()
 {
-  return "Ray(" + rayOrigin->toString() + ", " + rayDirection->toString() + ")";
+  return "Ray(" + rayOrigin.toString() + ", " + rayDirection.toString() + ")";
 }
@@ -16,8 +16,9 @@
 
 #include <string>
 
-class Point;
-class Vector;
+#include "point.h"
+#include "vector.h"
+
 class Line;
 class LineSegment;
 
@@ -36,9 +37,6 @@ class Ray
     Ray(Point const& point, Vector const& vector);
     Ray(Point const& firstPoint, Point const& secondPoint);
 
-    Ray(Ray const& source);
-    Ray& operator=(Ray const& source);
-
     ~Ray();
 
     void set(Point const& point, Vector const& vector);
@@ -57,11 +55,8 @@ class Ray
     //bool operator==(Ray const& second) const;
 
   private:
-    Point* rayOrigin;
-    Vector* rayDirection;
-
-    void initialize();
-    void freeMemory();
+    Point  rayOrigin;
+    Vector rayDirection;
 };
 
 #endif
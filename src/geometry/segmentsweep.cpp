@@ -0,0 +1,180 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/segmentsweep.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see geometry/segmentsweep.h
+ *
+ */
+
+#include "segmentsweep.h"
+#include "units.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  /** Segments touching within the tolerance must still be tested. */
+  const double BOUNDS_MARGIN = libcity::COORDINATES_EPSILON;
+
+  bool crossingOrder(SegmentSweep::Crossing const& first, SegmentSweep::Crossing const& second)
+  {
+    if (first.first != second.first)
+    {
+      return first.first < second.first;
+    }
+    return first.second < second.second;
+  }
+}
+
+SegmentSweep::SegmentSweep(std::vector<LineSegment> const& sweptSegments)
+  : segments(sweptSegments), bounds()
+{
+  bounds.reserve(segments.size());
+  for (std::vector<LineSegment>::iterator segment = segments.begin();
+       segment != segments.end();
+       segment++)
+  {
+    Point begining = segment->begining(),
+          end      = segment->end();
+
+    Bounds box;
+    box.minX = std::min(begining.x(), end.x()) - BOUNDS_MARGIN;
+    box.maxX = std::max(begining.x(), end.x()) + BOUNDS_MARGIN;
+    box.minY = std::min(begining.y(), end.y()) - BOUNDS_MARGIN;
+    box.maxY = std::max(begining.y(), end.y()) + BOUNDS_MARGIN;
+    bounds.push_back(box);
+  }
+}
+
+SegmentSweep::~SegmentSweep()
+{}
+
+void SegmentSweep::findCrossings(std::vector<Crossing>* output) const
+{
+  output->clear();
+  if (segments.empty())
+  {
+    return;
+  }
+
+  /* Bands are about twice as high as an average segment,
+     but there's no point in more bands than sqrt(n). */
+  double minY = bounds[0].minY, maxY = bounds[0].maxY, heights = 0;
+  for (std::vector<Bounds>::const_iterator box = bounds.begin();
+       box != bounds.end();
+       box++)
+  {
+    minY = std::min(minY, box->minY);
+    maxY = std::max(maxY, box->maxY);
+    heights += box->maxY - box->minY;
+  }
+  double span = maxY - minY;
+  int numberOfBands = 1;
+  if (span > 0)
+  {
+    double count = segments.size();
+    double byHeight = heights > 0 ? span * count / (2 * heights) : count;
+    numberOfBands = std::max(static_cast<int>(std::min(byHeight, std::sqrt(count))), 1);
+  }
+  double bandHeight = span / numberOfBands;
+
+  /* Events are the left ends of the segments, each band
+     gets them in the order of the sweep. */
+  std::vector< std::pair<double, int> > events;
+  events.reserve(segments.size());
+  for (unsigned int segment = 0; segment < segments.size(); segment++)
+  {
+    events.push_back(std::make_pair(bounds[segment].minX, segment));
+  }
+  std::sort(events.begin(), events.end());
+
+  std::vector< std::vector<int> > bands(numberOfBands);
+  for (std::vector< std::pair<double, int> >::iterator event = events.begin();
+       event != events.end();
+       event++)
+  {
+    Bounds const& box = bounds[event->second];
+    int last = band(box.maxY, minY, bandHeight, numberOfBands);
+    for (int i = band(box.minY, minY, bandHeight, numberOfBands); i <= last; i++)
+    {
+      bands[i].push_back(event->second);
+    }
+  }
+
+  for (int i = 0; i < numberOfBands; i++)
+  {
+    sweep(bands[i], i, minY, bandHeight, numberOfBands, output);
+    std::vector<int>().swap(bands[i]);
+  }
+
+  std::sort(output->begin(), output->end(), crossingOrder);
+}
+
+int SegmentSweep::band(double y, double minY, double bandHeight, int numberOfBands)
+{
+  if (bandHeight <= 0)
+  {
+    return 0;
+  }
+  int index = static_cast<int>((y - minY) / bandHeight);
+  return std::min(std::max(index, 0), numberOfBands - 1);
+}
+
+void SegmentSweep::sweep(std::vector<int> const& bandEvents, int bandIndex,
+                         double minY, double bandHeight, int numberOfBands,
+                         std::vector<Crossing>* output) const
+{
+  /* Bounds are kept next to the indices, the active
+     segments are scanned for every event. */
+  std::vector< std::pair<Bounds, int> > active;
+  for (std::vector<int>::const_iterator event = bandEvents.begin();
+       event != bandEvents.end();
+       event++)
+  {
+    int current = *event;
+    Bounds const& currentBounds = bounds[current];
+
+    /* Retire the segments left behind by the sweep line
+       while testing the rest against the current one. */
+    unsigned int kept = 0;
+    for (unsigned int i = 0; i < active.size(); i++)
+    {
+      Bounds const& anotherBounds = active[i].first;
+      if (anotherBounds.maxX < currentBounds.minX)
+      {
+        continue;
+      }
+      active[kept++] = active[i];
+
+      if (anotherBounds.maxY < currentBounds.minY ||
+          anotherBounds.minY > currentBounds.maxY)
+      {
+        continue;
+      }
+
+      /* Pairs spanning more bands are tested in the one
+         where their vertical overlap begins. */
+      double overlapBegins = std::max(anotherBounds.minY, currentBounds.minY);
+      if (band(overlapBegins, minY, bandHeight, numberOfBands) != bandIndex)
+      {
+        continue;
+      }
+
+      int another = active[i].second;
+      Crossing crossing;
+      crossing.first  = std::min(current, another);
+      crossing.second = std::max(current, another);
+      crossing.type = segments[crossing.first].intersection2D(segments[crossing.second], &crossing.point);
+      if (crossing.type != LineSegment::NONINTERSECTING)
+      {
+        output->push_back(crossing);
+      }
+    }
+    active.resize(kept);
+    active.push_back(std::make_pair(currentBounds, current));
+  }
+}
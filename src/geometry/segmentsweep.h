@@ -0,0 +1,87 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/segmentsweep.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief All intersecting pairs of a set of line segments
+ *
+ * A line sweeps the plane from left to right. Segments are
+ * activated at their leftmost point and retired once the line
+ * passes their rightmost point, so each segment is tested only
+ * against the active ones whose vertical extent overlaps its own.
+ *
+ * The plane is split into horizontal bands about twice as high
+ * as an average segment and each band is swept on its own, so
+ * the active segments are only those near the current one, not
+ * a whole column of the input. The cost is O(n log n) for sorting
+ * plus roughly the number of pairs with overlapping bounding
+ * boxes, instead of testing all n^2 pairs.
+ *
+ * Pairs are tested with LineSegment::intersection2D(), so the
+ * results are the same as testing the segments one by one.
+ */
+
+#ifndef _SEGMENTSWEEP_H_
+#define _SEGMENTSWEEP_H_
+
+#include <vector>
+
+#include "point.h"
+#include "linesegment.h"
+
+class SegmentSweep
+{
+  public:
+    /** Two segments meeting in a point or overlapping. */
+    struct Crossing
+    {
+      int first;   /**< Index of the first segment. */
+      int second;  /**< Index of the second segment, always greater. */
+      LineSegment::Intersection type; /**< Result of first.intersection2D(second). */
+      Point point; /**< The point computed along the first segment, set
+                        only for LineSegment::INTERSECTING. */
+    };
+
+    SegmentSweep(std::vector<LineSegment> const& sweptSegments);
+    ~SegmentSweep();
+
+    /**
+      Find all pairs of segments that cross, touch or overlap.
+     @remarks
+       Collinear overlapping segments meet in more than one
+       point, they are reported with their type only.
+     @param[out] output Crossings ordered by the segment indices,
+                        the vector is cleared first.
+     */
+    void findCrossings(std::vector<Crossing>* output) const;
+
+  private:
+    struct Bounds
+    {
+      double minX;
+      double maxX;
+      double minY;
+      double maxY;
+    };
+
+    std::vector<LineSegment> segments;
+    std::vector<Bounds> bounds;
+
+    /** @return Index of the band at y, the outermost bands extend to infinity. */
+    static int band(double y, double minY, double bandHeight, int numberOfBands);
+
+    /**
+      Sweep through the segments of a band.
+     @remarks
+       A pair overlapping in more bands is reported only by
+       the band where the vertical overlap begins.
+     @param[in] bandEvents Segments of the band ordered by their left end.
+     */
+    void sweep(std::vector<int> const& bandEvents, int bandIndex,
+               double minY, double bandHeight, int numberOfBands,
+               std::vector<Crossing>* output) const;
+};
+
+#endif
@@ -20,58 +20,54 @@
 #include <cmath>
 #include <string>
 #include <sstream>
+#include <utility>
 
 Shape::Shape()
-{
-  initialize();
-}
+  : shapeBase(), shapeHeight(0)
+{}
 
 Shape::Shape(Polygon const& base, double height)
+  : shapeBase(base), shapeHeight(height)
 {}
 
-void Shape::initialize()
-{
-  shapeBase   = new Polygon();
-  shapeHeight = 0;
-}
-
 Shape::Shape(Shape const& source)
-{
-  initialize();
-
-  *shapeBase = *(source.shapeBase);
-  shapeHeight = source.shapeHeight;
-}
+  : shapeBase(source.shapeBase), shapeHeight(source.shapeHeight)
+{}
 
 Shape& Shape::operator=(Shape const& source)
 {
-  *shapeBase = *(source.shapeBase);
+  shapeBase = source.shapeBase;
   shapeHeight = source.shapeHeight;
 
   return (*this);
 }
 
-Shape::~Shape()
-{
-  freeMemory();
-}
+Shape::Shape(Shape&& source)
+  : shapeBase(std::move(source.shapeBase)), shapeHeight(source.shapeHeight)
+{}
 
-void Shape::freeMemory()
+Shape& Shape::operator=(Shape&& source)
 {
-  delete shapeBase;
+  shapeBase = std::move(source.shapeBase);
+  shapeHeight = source.shapeHeight;
+
+  return (*this);
 }
 
+Shape::~Shape()
+{}
+
 Polygon Shape::base() const
 {
-  return *shapeBase;
+  return shapeBase;
 }
 
 Polygon Shape::top() const
 {
   Polygon upperBase;
-  for (unsigned int i = 0; i < shapeBase->numberOfVertices(); i++)
+  for (unsigned int i = 0; i < shapeBase.numberOfVertices(); i++)
   {
-    upperBase.addVertex(shapeBase->vertex(i) + Vector(0,0,1)*shapeHeight);
+    upperBase.addVertex(shapeBase.vertex(i) + Vector(0,0,1)*shapeHeight);
   }
 
   return upperBase;
@@ -84,7 +80,7 @@ double Shape::height() const
 
 void Shape::setBase(Polygon const& polygon)
 {
-  *shapeBase = polygon;
+  shapeBase = polygon;
 }
 
 void Shape::setHeight(double const& number)
@@ -94,12 +90,12 @@ void Shape::setHeight(double const& number)
 
 bool Shape::encloses(Point const& point)
 {
-  assert(shapeBase->numberOfVertices() > 0);
+  assert(shapeBase.numberOfVertices() > 0);
 
-  double lowerZBound  = shapeBase->vertex(0).z(),
+  double lowerZBound  = shapeBase.vertex(0).z(),
          higherZBound = lowerZBound + shapeHeight;
 
-  return shapeBase->encloses2D(point) && point.z() >= lowerZBound && point.z() <= higherZBound;
+  return shapeBase.encloses2D(point) && point.z() >= lowerZBound && point.z() <= higherZBound;
 }
 
 bool Shape::encloses(Shape const& shape)
@@ -133,7 +129,7 @@ bool Shape::encloses(Polygon const& polygon)
 std::string Shape::toString()
 {
   std::stringstream output;
-  output << "Shape(" << shapeBase->toString();
+  output << "Shape(" << shapeBase.toString();
   output << ", height = " << shapeHeight << ")";
 
   return output.str();
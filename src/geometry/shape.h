@@ -16,10 +16,11 @@
 #include <string>
 #include <list>
 
+#include "polygon.h"
+
 class Point;
 class Vector;
 class LineSegment;
-class Polygon;
 
 class Shape
 {
@@ -30,11 +31,14 @@ class Shape
     Shape(Shape const& source);
     Shape& operator=(Shape const& source);
 
+    Shape(Shape&& source);
+    Shape& operator=(Shape&& source);
+
     ~Shape();
 
   private:
-    Polygon* shapeBase;
-    double   shapeHeight;
+    Polygon shapeBase;
+    double  shapeHeight;
 
   public:
     Polygon base() const;
@@ -49,9 +53,6 @@ class Shape
     bool encloses(Polygon const& polygon);
 
     std::string toString();
-  private:
-    void initialize();
-    void freeMemory();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,196 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/triangulator.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see geometry/triangulator.h
+ *
+ */
+
+#include "triangulator.h"
+#include "polygon.h"
+#include "point.h"
+#include "predicates.h"
+
+#include <algorithm>
+
+Triangulator::Triangulator()
+  : x(), y(), previous(), next(), isReflex(), reflexVertices(), triangles()
+{}
+
+Triangulator::~Triangulator()
+{}
+
+bool Triangulator::triangulate(Polygon const& polygon, std::vector<Point>* points)
+{
+  bool isSimple = triangulate(polygon, &triangles);
+
+  points->clear();
+  points->reserve(triangles.size());
+  for (std::vector<int>::iterator index = triangles.begin();
+       index != triangles.end();
+       index++)
+  {
+    points->push_back(polygon.vertex(*index));
+  }
+
+  return isSimple;
+}
+
+bool Triangulator::triangulate(Polygon const& polygon, std::vector<int>* indexes)
+{
+  indexes->clear();
+
+  int count = polygon.numberOfVertices();
+  if (count < 3)
+  {
+    return false;
+  }
+  indexes->reserve(3 * (count - 2));
+
+  x.resize(count);
+  y.resize(count);
+  double doubleArea = 0;
+  for (int vertex = 0; vertex < count; vertex++)
+  {
+    Point position = polygon.vertex(vertex);
+    x[vertex] = position.x();
+    y[vertex] = position.y();
+  }
+  for (int vertex = 0; vertex < count; vertex++)
+  {
+    int following = (vertex + 1) % count;
+    doubleArea += x[vertex] * y[following] - y[vertex] * x[following];
+  }
+  if (doubleArea == 0)
+  {
+    return false;
+  }
+
+  /* Walk the polygon counterclockwise. */
+  previous.resize(count);
+  next.resize(count);
+  for (int vertex = 0; vertex < count; vertex++)
+  {
+    int following = (vertex + 1) % count,
+        preceding = (vertex + count - 1) % count;
+    next[vertex]     = doubleArea > 0 ? following : preceding;
+    previous[vertex] = doubleArea > 0 ? preceding : following;
+  }
+
+  isReflex.assign(count, false);
+  reflexVertices.clear();
+  for (int vertex = 0; vertex < count; vertex++)
+  {
+    if (!isConvex(vertex))
+    {
+      isReflex[vertex] = true;
+      reflexVertices.push_back(vertex);
+    }
+  }
+
+  int remaining = count,
+      attempts = remaining,
+      vertex = doubleArea > 0 ? 0 : count - 1;
+  while (remaining > 2)
+  {
+    if (isReflex[vertex] || !isEar(vertex))
+    {
+      if (--attempts == 0)
+      /* Went all the way around without an ear, not a simple polygon. */
+      {
+        return false;
+      }
+      vertex = next[vertex];
+      continue;
+    }
+
+    int before = previous[vertex],
+        after  = next[vertex];
+    indexes->push_back(before);
+    indexes->push_back(vertex);
+    indexes->push_back(after);
+
+    next[before] = after;
+    previous[after] = before;
+    remaining--;
+    attempts = remaining;
+
+    /* Clipping an ear can only make its neighbours convex. */
+    bool changed = false;
+    if (isReflex[before] && isConvex(before))
+    {
+      isReflex[before] = false;
+      changed = true;
+    }
+    if (isReflex[after] && isConvex(after))
+    {
+      isReflex[after] = false;
+      changed = true;
+    }
+    if (changed)
+    {
+      std::vector<int>::iterator last = reflexVertices.begin();
+      for (std::vector<int>::iterator reflex = reflexVertices.begin();
+           reflex != reflexVertices.end();
+           reflex++)
+      {
+        if (isReflex[*reflex])
+        {
+          *(last++) = *reflex;
+        }
+      }
+      reflexVertices.erase(last, reflexVertices.end());
+    }
+
+    vertex = next[after];
+  }
+
+  return true;
+}
+
+bool Triangulator::isConvex(int vertex) const
+{
+  int before = previous[vertex],
+      after  = next[vertex];
+  return Predicates::orientation(x[before], y[before], x[vertex], y[vertex], x[after], y[after]) > 0;
+}
+
+bool Triangulator::isEar(int vertex) const
+{
+  int before = previous[vertex],
+      after  = next[vertex];
+  double ax = x[before], ay = y[before],
+         bx = x[vertex], by = y[vertex],
+         cx = x[after],  cy = y[after];
+  double minX = std::min(ax, std::min(bx, cx)), maxX = std::max(ax, std::max(bx, cx)),
+         minY = std::min(ay, std::min(by, cy)), maxY = std::max(ay, std::max(by, cy));
+
+  for (std::vector<int>::const_iterator reflex = reflexVertices.begin();
+       reflex != reflexVertices.end();
+       reflex++)
+  {
+    if (*reflex == before || *reflex == after)
+    {
+      continue;
+    }
+
+    double px = x[*reflex], py = y[*reflex];
+    if (px < minX || px > maxX || py < minY || py > maxY)
+    {
+      continue;
+    }
+
+    /* Points on the border of the triangle count as inside. */
+    if (Predicates::orientation(bx, by, cx, cy, px, py) >= 0 &&
+        Predicates::orientation(cx, cy, ax, ay, px, py) >= 0 &&
+        Predicates::orientation(ax, ay, bx, by, px, py) >= 0)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
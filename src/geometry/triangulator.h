@@ -0,0 +1,70 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file geometry/triangulator.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Triangulation of simple polygons by ear clipping
+ *
+ * Vertices are kept in a circular doubly linked list, so clipping
+ * an ear doesn't shift the rest of them. A vertex is an ear when
+ * no other vertex lies in its triangle. Only reflex vertices can
+ * do that, so only they are tested. They are kept in a separate
+ * list, which for city lots is usually empty or very short.
+ *
+ * The working arrays live in the object and keep their capacity,
+ * triangulating many polygons with one Triangulator doesn't
+ * allocate once the arrays are large enough.
+ *
+ * Only x and y coordinates are used.
+ */
+
+#ifndef _TRIANGULATOR_H_
+#define _TRIANGULATOR_H_
+
+#include <vector>
+
+class Point;
+class Polygon;
+
+class Triangulator
+{
+  public:
+    Triangulator();
+    ~Triangulator();
+
+    /**
+      Split a polygon into triangles.
+     @remarks
+       Triangles are counterclockwise, whatever the orientation
+       of the polygon is.
+     @param[out] indexes Three indexes of polygon vertices for each
+                         triangle. The vector is cleared first.
+     @return False if the polygon has no area or the clipping got
+             stuck, which happens only when the polygon isn't simple.
+             The output then holds the triangles found so far. Not every
+             self-intersecting polygon is caught, that is what
+             Polygon::isNonSelfIntersecting() is for.
+     */
+    bool triangulate(Polygon const& polygon, std::vector<int>* indexes);
+
+    /**
+      Same as above, the output holds three points for each triangle.
+     */
+    bool triangulate(Polygon const& polygon, std::vector<Point>* points);
+
+  private:
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<int> previous;
+    std::vector<int> next;
+    std::vector<bool> isReflex;
+    std::vector<int> reflexVertices;
+    std::vector<int> triangles;
+
+    bool isConvex(int vertex) const;
+    bool isEar(int vertex) const;
+};
+
+#endif
@@ -21,4 +21,7 @@ namespace libcity
   const double EPSILON = 0.0000001;
 
   const double SNAP_DISTANCE = 25;
+
+  /* Equatorial radius of WGS 84 in meters, for map projections. */
+  const double EARTH_RADIUS = 6378137;
 }
\ No newline at end of file
@@ -0,0 +1,607 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/cityfile.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/cityfile.h
+ *
+ */
+
+#include "cityfile.h"
+
+#include <fstream>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../streetgraph/streetgraph.h"
+#include "../streetgraph/compactstreetgraph.h"
+#include "../streetgraph/intersection.h"
+#include "../geometry/polygon.h"
+#include "../geometry/point.h"
+#include "../area/zone.h"
+#include "../area/block.h"
+#include "../area/lot.h"
+
+const std::uint32_t CityFile::VERSION = 1;
+
+namespace
+{
+  enum SectionId
+  {
+    INTERSECTIONS_X,
+    INTERSECTIONS_Y,
+    INTERSECTIONS_Z,
+    ROADS_BEGININGS,
+    ROADS_ENDS,
+    ROADS_TYPES,
+    WAY_OFFSETS,
+    WAYS_ROADS,
+    WAYS_TARGETS,
+    ZONES,
+    BLOCKS,
+    LOTS,
+    VERTICES_X,
+    VERTICES_Y,
+    VERTICES_Z,
+    NUMBER_OF_SECTIONS
+  };
+
+  const std::uint32_t ITEM_SIZES[NUMBER_OF_SECTIONS] =
+    {8, 8, 8, 4, 4, 2, 4, 4, 4, 16, 16, 16, 8, 8, 8};
+
+  const char MAGIC[8] = {'L', 'I', 'B', 'C', 'I', 'T', 'Y', '\0'};
+  const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+  struct FileHeader
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;        /**< BYTE_ORDER_MARK as stored by the writer. */
+    std::uint32_t numberOfSections;
+    std::uint32_t reserved;
+    std::uint64_t fileSize;
+  };
+
+  struct SectionEntry
+  {
+    std::uint32_t id;
+    std::uint32_t itemSize;
+    std::uint64_t offset;           /**< From the start of the file, aligned to 8 bytes. */
+    std::uint64_t count;
+  };
+
+  static_assert(sizeof(FileHeader) == 32 && sizeof(SectionEntry) == 24, "Unexpected padding");
+  static_assert(sizeof(CityFile::AreaRecord) == 16, "Unexpected padding");
+  static_assert(sizeof(Road::Type) == 2 && sizeof(double) == 8, "Unsupported type sizes");
+
+  bool isLittleEndian()
+  {
+    std::uint32_t value = BYTE_ORDER_MARK;
+    return *reinterpret_cast<unsigned char*>(&value) == 0x04;
+  }
+
+  std::uint64_t aligned(std::uint64_t offset)
+  {
+    return (offset + 7) & ~static_cast<std::uint64_t>(7);
+  }
+
+  /** Section waiting to be written. */
+  struct SectionData
+  {
+    void const* data;
+    std::uint64_t count;
+  };
+
+  template<typename Item>
+  SectionData describe(std::vector<Item> const& items)
+  {
+    SectionData section = {items.empty() ? 0 : &items[0], items.size()};
+    return section;
+  }
+
+  /** Vertices of all the areas. */
+  struct Vertices
+  {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+
+    CityFile::AreaRecord add(Polygon const& polygon)
+    {
+      CityFile::AreaRecord record = {static_cast<std::uint32_t>(x.size()),
+                                     polygon.numberOfVertices(), 0, 0};
+      for (unsigned int vertex = 0; vertex < polygon.numberOfVertices(); vertex++)
+      {
+        Point position = polygon.vertex(vertex);
+        x.push_back(position.x());
+        y.push_back(position.y());
+        z.push_back(position.z());
+      }
+      return record;
+    }
+  };
+}
+
+CityFile::CityFile()
+  : mapping(0), mappingSize(0)
+{}
+
+CityFile::~CityFile()
+{
+  close();
+}
+
+bool CityFile::save(std::string const& fileName, StreetGraph* graph,
+                    std::list<Zone*> const& cityZones)
+{
+  if (!isLittleEndian())
+  {
+    return false;
+  }
+
+  /* Street graph in the order of the compact snapshot */
+  CompactStreetGraph compact(graph);
+  int intersections = compact.numberOfIntersections(),
+      roads = compact.numberOfRoads();
+
+  std::vector<double> x(intersections), y(intersections), z(intersections);
+  std::vector<std::int32_t> wayOffsets(1, 0), waysRoads, waysTargets;
+  for (int intersection = 0; intersection < intersections; intersection++)
+  {
+    Point position = compact.intersection(intersection).original()->position();
+    x[intersection] = position.x();
+    y[intersection] = position.y();
+    z[intersection] = position.z();
+
+    for (int way = compact.firstWay(intersection); way < compact.lastWay(intersection); way++)
+    {
+      waysRoads.push_back(compact.wayRoad(way));
+      waysTargets.push_back(compact.wayTarget(way));
+    }
+    wayOffsets.push_back(waysRoads.size());
+  }
+
+  std::vector<std::int32_t> beginings(roads), ends(roads);
+  std::vector<Road::Type> types(roads);
+  for (int road = 0; road < roads; road++)
+  {
+    beginings[road] = compact.roadBegining(road);
+    ends[road]      = compact.roadEnd(road);
+    types[road]     = compact.road(road).type();
+  }
+
+  /* Areas, children of each area are stored next to each other */
+  Vertices vertices;
+  std::vector<AreaRecord> zoneRecords, blockRecords, lotRecords;
+  for (std::list<Zone*>::const_iterator zone = cityZones.begin();
+       zone != cityZones.end();
+       zone++)
+  {
+    AreaRecord zoneRecord = vertices.add((*zone)->areaConstraints());
+    zoneRecord.firstChild = blockRecords.size();
+
+    Zone::BlockRange zoneBlocks = (*zone)->blockRange();
+    for (Zone::BlockRange::iterator block = zoneBlocks.begin();
+         block != zoneBlocks.end();
+         block++)
+    {
+      AreaRecord blockRecord = vertices.add((*block)->areaConstraints());
+      blockRecord.firstChild = lotRecords.size();
+
+      Block::LotRange blockLots = (*block)->lotRange();
+      for (Block::LotRange::iterator lot = blockLots.begin();
+           lot != blockLots.end();
+           lot++)
+      {
+        lotRecords.push_back(vertices.add((*lot)->areaConstraints()));
+      }
+
+      blockRecord.numberOfChildren = lotRecords.size() - blockRecord.firstChild;
+      blockRecords.push_back(blockRecord);
+    }
+
+    zoneRecord.numberOfChildren = blockRecords.size() - zoneRecord.firstChild;
+    zoneRecords.push_back(zoneRecord);
+  }
+
+  SectionData data[NUMBER_OF_SECTIONS] =
+    {describe(x), describe(y), describe(z),
+     describe(beginings), describe(ends), describe(types),
+     describe(wayOffsets), describe(waysRoads), describe(waysTargets),
+     describe(zoneRecords), describe(blockRecords), describe(lotRecords),
+     describe(vertices.x), describe(vertices.y), describe(vertices.z)};
+
+  /* Lay the sections out */
+  SectionEntry entries[NUMBER_OF_SECTIONS];
+  std::uint64_t offset = aligned(sizeof(FileHeader) + sizeof(entries));
+  for (int id = 0; id < NUMBER_OF_SECTIONS; id++)
+  {
+    entries[id].id = id;
+    entries[id].itemSize = ITEM_SIZES[id];
+    entries[id].offset = offset;
+    entries[id].count = data[id].count;
+    offset = aligned(offset + data[id].count * ITEM_SIZES[id]);
+  }
+
+  FileHeader header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.numberOfSections = NUMBER_OF_SECTIONS;
+  header.reserved = 0;
+  header.fileSize = offset;
+
+  std::ofstream output(fileName.c_str(), std::ios::binary | std::ios::trunc);
+  output.write(reinterpret_cast<char const*>(&header), sizeof(header));
+  output.write(reinterpret_cast<char const*>(entries), sizeof(entries));
+
+  const char padding[8] = {0};
+  std::uint64_t written = sizeof(header) + sizeof(entries);
+  for (int id = 0; id < NUMBER_OF_SECTIONS; id++)
+  {
+    output.write(padding, entries[id].offset - written);
+    output.write(static_cast<char const*>(data[id].data), data[id].count * ITEM_SIZES[id]);
+    written = entries[id].offset + data[id].count * ITEM_SIZES[id];
+  }
+  output.write(padding, header.fileSize - written);
+
+  output.close();
+  return !output.fail();
+}
+
+bool CityFile::open(std::string const& fileName)
+{
+  close();
+
+  int descriptor = ::open(fileName.c_str(), O_RDONLY);
+  if (descriptor < 0)
+  {
+    return false;
+  }
+
+  struct stat status;
+  if (fstat(descriptor, &status) != 0 ||
+      static_cast<std::uint64_t>(status.st_size) < sizeof(FileHeader))
+  {
+    ::close(descriptor);
+    return false;
+  }
+
+  void* mapped = mmap(0, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  ::close(descriptor);
+  if (mapped == MAP_FAILED)
+  {
+    return false;
+  }
+  mapping = mapped;
+  mappingSize = status.st_size;
+
+  char const* bytes = static_cast<char const*>(mapping);
+  FileHeader const* header = reinterpret_cast<FileHeader const*>(bytes);
+  if (!isLittleEndian() ||
+      std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header->version != VERSION ||
+      header->byteOrder != BYTE_ORDER_MARK ||
+      header->fileSize != mappingSize ||
+      header->numberOfSections > (mappingSize - sizeof(FileHeader)) / sizeof(SectionEntry))
+  {
+    close();
+    return false;
+  }
+
+  /* Unknown sections are skipped, all known ones must be present */
+  Section missing = {0, 0};
+  sections.assign(NUMBER_OF_SECTIONS, missing);
+  SectionEntry const* entries = reinterpret_cast<SectionEntry const*>(bytes + sizeof(FileHeader));
+  for (std::uint32_t entry = 0; entry < header->numberOfSections; entry++)
+  {
+    SectionEntry const& section = entries[entry];
+    if (section.id >= NUMBER_OF_SECTIONS)
+    {
+      continue;
+    }
+    if (section.itemSize != ITEM_SIZES[section.id] ||
+        section.offset % 8 != 0 ||
+        section.offset > mappingSize ||
+        section.count > (mappingSize - section.offset) / section.itemSize)
+    {
+      close();
+      return false;
+    }
+    sections[section.id].data = bytes + section.offset;
+    sections[section.id].count = section.count;
+  }
+
+  bool isComplete = true;
+  for (int id = 0; id < NUMBER_OF_SECTIONS; id++)
+  {
+    isComplete = isComplete && sections[id].data != 0;
+  }
+  if (!isComplete ||
+      count(INTERSECTIONS_Y) != count(INTERSECTIONS_X) ||
+      count(INTERSECTIONS_Z) != count(INTERSECTIONS_X) ||
+      count(ROADS_ENDS) != count(ROADS_BEGININGS) ||
+      count(ROADS_TYPES) != count(ROADS_BEGININGS) ||
+      count(WAY_OFFSETS) != count(INTERSECTIONS_X) + 1 ||
+      count(WAYS_TARGETS) != count(WAYS_ROADS) ||
+      count(VERTICES_Y) != count(VERTICES_X) ||
+      count(VERTICES_Z) != count(VERTICES_X))
+  {
+    close();
+    return false;
+  }
+
+  zones.assign(count(ZONES), 0);
+  return true;
+}
+
+void CityFile::close()
+{
+  for (std::vector<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+  {
+    delete *lot;
+  }
+  for (std::vector<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+  {
+    delete *block;
+  }
+  for (std::vector<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+  {
+    delete *zone;
+  }
+  lots.clear();
+  blocks.clear();
+  zones.clear();
+  sections.clear();
+
+  if (mapping != 0)
+  {
+    munmap(const_cast<void*>(mapping), mappingSize);
+    mapping = 0;
+    mappingSize = 0;
+  }
+}
+
+bool CityFile::isOpen() const
+{
+  return mapping != 0;
+}
+
+template<typename Item>
+Item const* CityFile::section(int id) const
+{
+  return sections.empty() ? 0 : static_cast<Item const*>(sections[id].data);
+}
+
+std::uint64_t CityFile::count(int id) const
+{
+  return sections.empty() ? 0 : sections[id].count;
+}
+
+int CityFile::numberOfIntersections() const
+{
+  return count(INTERSECTIONS_X);
+}
+
+int CityFile::numberOfRoads() const
+{
+  return count(ROADS_BEGININGS);
+}
+
+int CityFile::numberOfZones() const
+{
+  return count(ZONES);
+}
+
+int CityFile::numberOfBlocks() const
+{
+  return count(BLOCKS);
+}
+
+int CityFile::numberOfLots() const
+{
+  return count(LOTS);
+}
+
+double const* CityFile::intersectionsX() const
+{
+  return section<double>(INTERSECTIONS_X);
+}
+
+double const* CityFile::intersectionsY() const
+{
+  return section<double>(INTERSECTIONS_Y);
+}
+
+double const* CityFile::intersectionsZ() const
+{
+  return section<double>(INTERSECTIONS_Z);
+}
+
+std::int32_t const* CityFile::roadsBeginings() const
+{
+  return section<std::int32_t>(ROADS_BEGININGS);
+}
+
+std::int32_t const* CityFile::roadsEnds() const
+{
+  return section<std::int32_t>(ROADS_ENDS);
+}
+
+Road::Type const* CityFile::roadsTypes() const
+{
+  return section<Road::Type>(ROADS_TYPES);
+}
+
+std::int32_t const* CityFile::wayOffsets() const
+{
+  return section<std::int32_t>(WAY_OFFSETS);
+}
+
+std::int32_t const* CityFile::waysRoads() const
+{
+  return section<std::int32_t>(WAYS_ROADS);
+}
+
+std::int32_t const* CityFile::waysTargets() const
+{
+  return section<std::int32_t>(WAYS_TARGETS);
+}
+
+CityFile::AreaRecord const* CityFile::zoneRecords() const
+{
+  return section<AreaRecord>(ZONES);
+}
+
+CityFile::AreaRecord const* CityFile::blockRecords() const
+{
+  return section<AreaRecord>(BLOCKS);
+}
+
+CityFile::AreaRecord const* CityFile::lotRecords() const
+{
+  return section<AreaRecord>(LOTS);
+}
+
+double const* CityFile::verticesX() const
+{
+  return section<double>(VERTICES_X);
+}
+
+double const* CityFile::verticesY() const
+{
+  return section<double>(VERTICES_Y);
+}
+
+double const* CityFile::verticesZ() const
+{
+  return section<double>(VERTICES_Z);
+}
+
+bool CityFile::areaIsValid(AreaRecord const& area, int numberOfChildren) const
+{
+  return static_cast<std::uint64_t>(area.firstVertex) + area.numberOfVertices <= count(VERTICES_X) &&
+         static_cast<std::uint64_t>(area.firstChild) + area.numberOfChildren <=
+           static_cast<std::uint64_t>(numberOfChildren);
+}
+
+bool CityFile::border(AreaRecord const& area, Polygon* polygon) const
+{
+  polygon->clear();
+  if (static_cast<std::uint64_t>(area.firstVertex) + area.numberOfVertices > count(VERTICES_X))
+  {
+    return false;
+  }
+
+  double const* x = verticesX() + area.firstVertex;
+  double const* y = verticesY() + area.firstVertex;
+  double const* z = verticesZ() + area.firstVertex;
+  for (std::uint32_t vertex = 0; vertex < area.numberOfVertices; vertex++)
+  {
+    polygon->addVertex(Point(x[vertex], y[vertex], z[vertex]));
+  }
+  return true;
+}
+
+bool CityFile::loadStreetGraph(StreetGraph* graph) const
+{
+  int intersections = numberOfIntersections(),
+      roads = numberOfRoads();
+  for (int road = 0; road < roads; road++)
+  {
+    std::int32_t from = roadsBeginings()[road],
+                 to   = roadsEnds()[road];
+    if (from < 0 || from >= intersections || to < 0 || to >= intersections)
+    {
+      return false;
+    }
+  }
+
+  std::vector<Point> positions;
+  positions.reserve(intersections);
+  for (int intersection = 0; intersection < intersections; intersection++)
+  {
+    positions.push_back(Point(intersectionsX()[intersection],
+                              intersectionsY()[intersection],
+                              intersectionsZ()[intersection]));
+  }
+
+  graph->addPlanarRoads(positions,
+                        std::vector<int>(roadsBeginings(), roadsBeginings() + roads),
+                        std::vector<int>(roadsEnds(), roadsEnds() + roads),
+                        std::vector<Road::Type>(roadsTypes(), roadsTypes() + roads));
+  return true;
+}
+
+Zone* CityFile::zone(int index)
+{
+  if (index < 0 || index >= numberOfZones())
+  {
+    return 0;
+  }
+  if (zones[index] != 0)
+  {
+    return zones[index];
+  }
+
+  /* Check everything first, so that nothing leaks from a broken file */
+  AreaRecord const& zoneRecord = zoneRecords()[index];
+  if (!areaIsValid(zoneRecord, numberOfBlocks()))
+  {
+    return 0;
+  }
+  for (std::uint32_t block = zoneRecord.firstChild;
+       block < zoneRecord.firstChild + zoneRecord.numberOfChildren;
+       block++)
+  {
+    AreaRecord const& blockRecord = blockRecords()[block];
+    if (!areaIsValid(blockRecord, numberOfLots()))
+    {
+      return 0;
+    }
+    for (std::uint32_t lot = blockRecord.firstChild;
+         lot < blockRecord.firstChild + blockRecord.numberOfChildren;
+         lot++)
+    {
+      if (!areaIsValid(lotRecords()[lot], 0))
+      {
+        return 0;
+      }
+    }
+  }
+
+  Polygon polygon;
+  Zone* newZone = new Zone(0);
+  border(zoneRecord, &polygon);
+  newZone->setAreaConstraints(polygon);
+
+  for (std::uint32_t block = zoneRecord.firstChild;
+       block < zoneRecord.firstChild + zoneRecord.numberOfChildren;
+       block++)
+  {
+    AreaRecord const& blockRecord = blockRecords()[block];
+    border(blockRecord, &polygon);
+    Block* newBlock = new Block(newZone, polygon);
+    newZone->addBlock(newBlock);
+    blocks.push_back(newBlock);
+
+    for (std::uint32_t lot = blockRecord.firstChild;
+         lot < blockRecord.firstChild + blockRecord.numberOfChildren;
+         lot++)
+    {
+      border(lotRecords()[lot], &polygon);
+      Lot* newLot = new Lot(newBlock, polygon);
+      newBlock->addLot(newLot);
+      lots.push_back(newLot);
+    }
+  }
+
+  zones[index] = newZone;
+  return newZone;
+}
@@ -0,0 +1,175 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/cityfile.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Binary file with a generated city, read through mmap
+ *
+ * The file holds the street graph and the zones, blocks and
+ * lots of a city. It starts with a header and a table of
+ * sections, each section is a plain array:
+ *
+ *  - intersection coordinates (x, y and z arrays of doubles),
+ *  - road endpoints (intersection indexes) and types,
+ *  - ways of the intersections in compressed sparse row format
+ *    (the same layout as CompactStreetGraph uses),
+ *  - zone, block and lot records pointing into one shared
+ *    array of polygon vertices and to their child areas.
+ *
+ * All numbers are little-endian and every section starts at
+ * a multiple of 8 bytes, so the arrays are used right from the
+ * mapped memory without any parsing. Zones with their blocks
+ * and lots are created only when they are asked for.
+ *
+ * Files are versioned, opening a file of another version
+ * fails. Only little-endian machines are supported.
+ */
+
+#ifndef _CITYFILE_H_
+#define _CITYFILE_H_
+
+#include <string>
+#include <vector>
+#include <list>
+#include <cstddef>
+#include <cstdint>
+
+#include "../streetgraph/road.h"
+
+class StreetGraph;
+class Polygon;
+class Zone;
+class Block;
+class Lot;
+
+class CityFile
+{
+  public:
+    /** Version of the format written by save(). */
+    static const std::uint32_t VERSION;
+
+    /** Zone, block or lot in the file. */
+    struct AreaRecord
+    {
+      std::uint32_t firstVertex;
+      std::uint32_t numberOfVertices;
+      std::uint32_t firstChild;       /**< First block of a zone or lot of a block. */
+      std::uint32_t numberOfChildren;
+    };
+
+    CityFile();
+    ~CityFile();
+
+    /**
+      Write a city into a file.
+     @param[in] graph Street graph of the city.
+     @param[in] zones Zones with their blocks and lots.
+     @return False if the file couldn't be written.
+     */
+    static bool save(std::string const& fileName, StreetGraph* graph,
+                     std::list<Zone*> const& zones);
+
+    /**
+      Map a file into memory.
+     @remarks
+       Only the header and the table of sections are checked.
+       Indexes inside of the sections are checked when the
+       objects are created from them.
+     @return False if the file can't be mapped or isn't
+             a city file of this version.
+     */
+    bool open(std::string const& fileName);
+
+    /** Unmap the file and delete the zones created from it. */
+    void close();
+    bool isOpen() const;
+
+    int numberOfIntersections() const;
+    int numberOfRoads() const;
+    int numberOfZones() const;
+    int numberOfBlocks() const;
+    int numberOfLots() const;
+
+    /** @{ */
+    /**
+      Arrays in the mapped file.
+     @remarks
+       Valid until the file is closed. Indexes stored in
+       them aren't checked.
+     */
+    double const* intersectionsX() const;
+    double const* intersectionsY() const;
+    double const* intersectionsZ() const;
+
+    std::int32_t const* roadsBeginings() const;
+    std::int32_t const* roadsEnds() const;
+    Road::Type const* roadsTypes() const;
+
+    std::int32_t const* wayOffsets() const; /**< numberOfIntersections() + 1 items. */
+    std::int32_t const* waysRoads() const;
+    std::int32_t const* waysTargets() const;
+
+    AreaRecord const* zoneRecords() const;
+    AreaRecord const* blockRecords() const;
+    AreaRecord const* lotRecords() const;
+
+    double const* verticesX() const;
+    double const* verticesY() const;
+    double const* verticesZ() const;
+    /** @} */
+
+    /**
+      Border of an area.
+     @return False if the record points outside of the vertices.
+     */
+    bool border(AreaRecord const& area, Polygon* polygon) const;
+
+    /**
+      Add roads of the file into a street graph.
+     @remarks
+       The roads are added as they are, without looking for
+       crossings (see StreetGraph::addPlanarRoads()).
+     @return False if a road refers to a missing intersection.
+     */
+    bool loadStreetGraph(StreetGraph* graph) const;
+
+    /**
+      Zone with its blocks and lots.
+     @remarks
+       The zone is created from the file when it's asked for
+       the first time. It belongs to the CityFile and is deleted
+       by close() together with its blocks and lots. The zone
+       has no street graph set.
+     @return The zone or 0 if its records are broken.
+     */
+    Zone* zone(int index);
+
+  private: /* Copying not allowed */
+    CityFile(CityFile const& source);
+    CityFile& operator=(CityFile const& source);
+
+    struct Section
+    {
+      void const* data;
+      std::uint64_t count;
+    };
+
+    void const* mapping;
+    std::size_t mappingSize;
+
+    std::vector<Section> sections;
+
+    std::vector<Zone*> zones;
+    std::vector<Block*> blocks;
+    std::vector<Lot*> lots;
+
+    template<typename Item>
+    Item const* section(int id) const;
+    std::uint64_t count(int id) const;
+
+    bool areaIsValid(AreaRecord const& area, int numberOfChildren) const;
+};
+
+#endif
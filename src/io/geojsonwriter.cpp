@@ -0,0 +1,88 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/geojsonwriter.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/geojsonwriter.h
+ *
+ */
+
+#include "geojsonwriter.h"
+#include "outputstream.h"
+
+#include "../streetgraph/intersection.h"
+#include "../streetgraph/road.h"
+#include "../geometry/polygon.h"
+#include "../geometry/point.h"
+
+GeoJsonWriter::GeoJsonWriter(OutputStream* stream)
+  : MapWriter(stream), numberOfFeatures(0), finished(false)
+{
+  output->write("{\"type\":\"FeatureCollection\",\"features\":[\n");
+}
+
+GeoJsonWriter::~GeoJsonWriter()
+{
+  finish();
+}
+
+void GeoJsonWriter::beginFeature(char const* geometryType)
+{
+  if (numberOfFeatures++ > 0)
+  {
+    output->write(",\n");
+  }
+  output->write("{\"type\":\"Feature\",\"geometry\":{\"type\":\"");
+  output->write(geometryType);
+  output->write("\",\"coordinates\":");
+}
+
+void GeoJsonWriter::writeIntersection(Intersection* intersection)
+{
+  beginFeature("Point");
+  output->write('[');
+  writeCoordinates(intersection->position(), ",");
+  output->write("]},\"properties\":{\"kind\":\"intersection\",\"ways\":");
+  output->writeInteger(intersection->numberOfWays());
+  output->write("}}");
+}
+
+void GeoJsonWriter::writeRoad(Road* road)
+{
+  beginFeature("LineString");
+  output->write("[[");
+  writeCoordinates(road->begining()->position(), ",");
+  output->write("],[");
+  writeCoordinates(road->end()->position(), ",");
+  output->write("]]},\"properties\":{\"kind\":\"road\",\"type\":");
+  output->writeInteger(road->type());
+  output->write("}}");
+}
+
+void GeoJsonWriter::writeArea(Polygon const& border, AreaType type)
+{
+  beginFeature("Polygon");
+  output->write("[[");
+  /* Rings are closed by repeating the first vertex */
+  for (unsigned int vertex = 0; border.numberOfVertices() > 0 && vertex <= border.numberOfVertices(); vertex++)
+  {
+    output->write(vertex > 0 ? ",[" : "[");
+    writeCoordinates(border.vertex(vertex % border.numberOfVertices()), ",");
+    output->write(']');
+  }
+  output->write("]]},\"properties\":{\"kind\":\"");
+  output->write(areaName(type));
+  output->write("\"}}");
+}
+
+bool GeoJsonWriter::finish()
+{
+  if (!finished)
+  {
+    output->write("\n]}\n");
+    finished = true;
+  }
+  return output->flush();
+}
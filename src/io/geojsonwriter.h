@@ -0,0 +1,46 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/geojsonwriter.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Streaming export of a city map to GeoJSON
+ *
+ * The output is a single FeatureCollection with one feature
+ * per line. Intersections are points, roads are line strings
+ * and areas are polygons. The "kind" property tells them apart
+ * ("intersection", "road", "zone", "block" or "lot"), roads
+ * also have their "type" and intersections their number of
+ * "ways".
+ *
+ * RFC 7946 expects longitudes and latitudes, use setOrigin()
+ * to get them. Without it the plain coordinates are written.
+ */
+
+#ifndef _GEOJSONWRITER_H_
+#define _GEOJSONWRITER_H_
+
+#include "mapwriter.h"
+
+class GeoJsonWriter : public MapWriter
+{
+  public:
+    /** Starts the FeatureCollection. */
+    GeoJsonWriter(OutputStream* stream);
+    virtual ~GeoJsonWriter();
+
+    virtual void writeIntersection(Intersection* intersection);
+    virtual void writeRoad(Road* road);
+    virtual void writeArea(Polygon const& border, AreaType type);
+
+    virtual bool finish();
+
+  private:
+    int numberOfFeatures;
+    bool finished;
+
+    void beginFeature(char const* geometryType);
+};
+
+#endif
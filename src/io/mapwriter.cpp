@@ -0,0 +1,123 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/mapwriter.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/mapwriter.h
+ *
+ */
+
+#include "mapwriter.h"
+#include "outputstream.h"
+
+#include <cmath>
+
+#include "../streetgraph/streetgraph.h"
+#include "../streetgraph/intersection.h"
+#include "../area/zone.h"
+#include "../area/block.h"
+#include "../area/lot.h"
+#include "../geometry/polygon.h"
+#include "../geometry/point.h"
+#include "../geometry/units.h"
+
+namespace
+{
+  const double DEGREES_PER_METER = 180 / (libcity::PI * libcity::EARTH_RADIUS);
+
+  /** About a centimeter in degrees and a millimeter in meters. */
+  const int GEOGRAPHIC_DECIMALS = 7;
+  const int METRIC_DECIMALS = 3;
+}
+
+MapWriter::MapWriter(OutputStream* stream)
+  : output(stream), geographic(false),
+    originLatitude(0), originLongitude(0), longitudeScale(DEGREES_PER_METER)
+{}
+
+MapWriter::~MapWriter()
+{}
+
+void MapWriter::setOrigin(double latitude, double longitude)
+{
+  geographic = true;
+  originLatitude = latitude;
+  originLongitude = longitude;
+  longitudeScale = DEGREES_PER_METER / std::cos(latitude * libcity::PI / 180);
+}
+
+bool MapWriter::isGeographic() const
+{
+  return geographic;
+}
+
+void MapWriter::writeCoordinates(Point const& position, char const* separator)
+{
+  if (geographic)
+  {
+    output->writeFixed(originLongitude + position.x() * longitudeScale, GEOGRAPHIC_DECIMALS);
+    output->write(separator);
+    output->writeFixed(originLatitude + position.y() * DEGREES_PER_METER, GEOGRAPHIC_DECIMALS);
+  }
+  else
+  {
+    output->writeFixed(position.x(), METRIC_DECIMALS);
+    output->write(separator);
+    output->writeFixed(position.y(), METRIC_DECIMALS);
+  }
+}
+
+char const* MapWriter::areaName(AreaType type)
+{
+  switch (type)
+  {
+    case ZONE:
+      return "zone";
+    case BLOCK:
+      return "block";
+    default:
+      return "lot";
+  }
+}
+
+void MapWriter::writeStreetGraph(StreetGraph* graph)
+{
+  StreetGraph::IntersectionRange intersections = graph->intersectionRange();
+  for (StreetGraph::IntersectionRange::iterator intersection = intersections.begin();
+       intersection != intersections.end();
+       intersection++)
+  {
+    writeIntersection(*intersection);
+  }
+
+  StreetGraph::RoadRange roads = graph->roadRange();
+  for (StreetGraph::RoadRange::iterator road = roads.begin();
+       road != roads.end();
+       road++)
+  {
+    writeRoad(*road);
+  }
+}
+
+void MapWriter::writeZone(Zone* zone)
+{
+  writeArea(zone->areaConstraints(), ZONE);
+
+  Zone::BlockRange blocks = zone->blockRange();
+  for (Zone::BlockRange::iterator block = blocks.begin();
+       block != blocks.end();
+       block++)
+  {
+    writeArea((*block)->areaConstraints(), BLOCK);
+
+    Block::LotRange lots = (*block)->lotRange();
+    for (Block::LotRange::iterator lot = lots.begin();
+         lot != lots.end();
+         lot++)
+    {
+      writeArea((*lot)->areaConstraints(), LOT);
+    }
+  }
+}
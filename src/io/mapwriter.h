@@ -0,0 +1,89 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/mapwriter.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Base class for streaming exports of a city map
+ *
+ * Objects are formatted into an OutputStream as soon as they
+ * are written, nothing is collected in memory (except the node
+ * ids of OsmWriter, see there). A city can be
+ * exported piece by piece while it's being generated, e.g. each
+ * zone once its lots are done.
+ *
+ * @see GeoJsonWriter, OsmWriter
+ */
+
+#ifndef _MAPWRITER_H_
+#define _MAPWRITER_H_
+
+class OutputStream;
+class StreetGraph;
+class Intersection;
+class Road;
+class Zone;
+class Point;
+class Polygon;
+
+class MapWriter
+{
+  public:
+    enum AreaType
+    {
+      ZONE,
+      BLOCK,
+      LOT
+    };
+
+    MapWriter(OutputStream* stream);
+    virtual ~MapWriter();
+
+    /**
+      Write latitudes and longitudes instead of the coordinates.
+     @remarks
+       Coordinates are taken as meters to the east (x) and to
+       the north (y) of the origin, a unit is a meter (libcity::METER
+       isn't applied, like in OsmReader). The projection is a plain
+       equirectangular one, precise enough for a city.
+     */
+    void setOrigin(double latitude, double longitude);
+
+    /** Intersections and then roads of the graph. */
+    void writeStreetGraph(StreetGraph* graph);
+
+    /** Border of the zone followed by its blocks and their lots. */
+    void writeZone(Zone* zone);
+
+    virtual void writeIntersection(Intersection* intersection) = 0;
+    virtual void writeRoad(Road* road) = 0;
+    virtual void writeArea(Polygon const& border, AreaType type) = 0;
+
+    /**
+      Close the document and flush the stream.
+     @remarks
+       Nothing can be written afterwards. Called by the
+       destructors of the writers if it wasn't called before.
+     @return False if writing to the stream failed.
+     */
+    virtual bool finish() = 0;
+
+  protected:
+    OutputStream* output;
+
+    bool isGeographic() const;
+
+    /** Write the x or longitude and the y or latitude of a position. */
+    void writeCoordinates(Point const& position, char const* separator);
+
+    static char const* areaName(AreaType type);
+
+  private:
+    bool geographic;
+    double originLatitude;
+    double originLongitude;
+    double longitudeScale; /**< Degrees of longitude per meter. */
+};
+
+#endif
@@ -0,0 +1,454 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/osmreader.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/osmreader.h
+ *
+ */
+
+#include "osmreader.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+
+#include "../streetgraph/streetgraph.h"
+#include "../streetgraph/path.h"
+#include "../geometry/linesegment.h"
+#include "../geometry/segmentsweep.h"
+#include "../geometry/units.h"
+
+const double OsmReader::DEFAULT_WELD_DISTANCE = 0.1;
+
+namespace
+{
+  const double DEGREES_PER_METER = 180 / (libcity::PI * libcity::EARTH_RADIUS);
+
+  /** Highway values of car roads, links are matched without "_link". */
+  const char* ROADS[] = {"motorway", "trunk", "primary", "secondary", "tertiary",
+                         "unclassified", "residential", "living_street", "service", "road"};
+
+  long long cellKey(long long column, long long row)
+  {
+    return (column << 32) ^ (row & 0xFFFFFFFFLL);
+  }
+}
+
+OsmReader::OsmReader()
+  : hasOrigin(false), originLatitude(0), originLongitude(0),
+    longitudeScale(DEGREES_PER_METER), weldDistance(DEFAULT_WELD_DISTANCE)
+{
+  clear();
+}
+
+OsmReader::~OsmReader()
+{}
+
+void OsmReader::setOrigin(double latitude, double longitude)
+{
+  hasOrigin = true;
+  originLatitude = latitude;
+  originLongitude = longitude;
+  longitudeScale = DEGREES_PER_METER / std::cos(latitude * libcity::PI / 180);
+}
+
+void OsmReader::setWeldDistance(double meters)
+{
+  weldDistance = meters > libcity::EPSILON ? meters : libcity::EPSILON;
+}
+
+bool OsmReader::roadType(std::string const& highway, Road::Type* type)
+{
+  static std::mutex lock;
+  static std::map<std::string, Road::Type> definedTypes;
+
+  std::string road = highway;
+  std::size_t link = road.rfind("_link");
+  if (link != std::string::npos && link + 5 == road.size())
+  {
+    road.erase(link);
+  }
+
+  bool isRoad = false;
+  for (unsigned int i = 0; i < sizeof(ROADS)/sizeof(ROADS[0]); i++)
+  {
+    isRoad = isRoad || road == ROADS[i];
+  }
+  if (!isRoad)
+  {
+    return false;
+  }
+
+  if (road == "primary")
+  {
+    *type = Road::PRIMARY_ROAD;
+    return true;
+  }
+  if (road == "secondary")
+  {
+    *type = Road::SECONDARY_ROAD;
+    return true;
+  }
+
+  std::lock_guard<std::mutex> guard(lock);
+  std::map<std::string, Road::Type>::iterator defined = definedTypes.find(road);
+  if (defined == definedTypes.end())
+  {
+    defined = definedTypes.insert(std::make_pair(road, Road::defineNewRoadType())).first;
+  }
+  *type = defined->second;
+  return true;
+}
+
+bool OsmReader::read(std::string const& fileName, StreetGraph* graph)
+{
+  clear();
+  if (!parseFile(fileName))
+  {
+    clear();
+    return false;
+  }
+
+  /* Nodes aren't needed anymore, only the statistics */
+  weldedNodes = weldedPositions.size();
+  std::vector<Node>().swap(nodes);
+  std::unordered_map<long long, int>().swap(cells);
+  std::vector<int>().swap(nextInCell);
+
+  addSegments(graph);
+
+  std::vector<Point>().swap(weldedPositions);
+  std::vector<int>().swap(segmentBeginings);
+  std::vector<int>().swap(segmentEnds);
+  std::vector<Road::Type>().swap(types);
+  return true;
+}
+
+int OsmReader::numberOfNodes() const
+{
+  return nodesRead;
+}
+
+int OsmReader::numberOfWays() const
+{
+  return ways;
+}
+
+int OsmReader::numberOfWeldedNodes() const
+{
+  return weldedNodes;
+}
+
+int OsmReader::numberOfSegments() const
+{
+  return segments;
+}
+
+void OsmReader::startElement(char const* name, Attributes const& attributes)
+{
+  if (std::strcmp(name, "node") == 0)
+  {
+    readNode(attributes);
+  }
+  else if (inWay && std::strcmp(name, "nd") == 0)
+  {
+    char const* reference = find(attributes, "ref");
+    if (reference != 0)
+    {
+      wayNodes.push_back(std::strtoll(reference, 0, 10));
+    }
+  }
+  else if (inWay && std::strcmp(name, "tag") == 0)
+  {
+    readTag(attributes);
+  }
+  else if (std::strcmp(name, "way") == 0)
+  {
+    inWay = true;
+    wayNodes.clear();
+    highway.clear();
+    isArea = false;
+    hasLibcityType = false;
+  }
+  else if (std::strcmp(name, "bounds") == 0 && !hasOrigin)
+  {
+    char const* minimalLatitude = find(attributes, "minlat");
+    char const* maximalLatitude = find(attributes, "maxlat");
+    char const* minimalLongitude = find(attributes, "minlon");
+    char const* maximalLongitude = find(attributes, "maxlon");
+    if (minimalLatitude != 0 && maximalLatitude != 0 && minimalLongitude != 0 && maximalLongitude != 0)
+    {
+      setOrigin((std::strtod(minimalLatitude, 0) + std::strtod(maximalLatitude, 0)) / 2,
+                (std::strtod(minimalLongitude, 0) + std::strtod(maximalLongitude, 0)) / 2);
+    }
+  }
+}
+
+void OsmReader::endElement(char const* name)
+{
+  if (inWay && std::strcmp(name, "way") == 0)
+  {
+    finishWay();
+    inWay = false;
+  }
+}
+
+void OsmReader::readNode(Attributes const& attributes)
+{
+  char const* id = find(attributes, "id");
+  char const* latitude = find(attributes, "lat");
+  char const* longitude = find(attributes, "lon");
+  if (id == 0 || latitude == 0 || longitude == 0)
+  /* Deleted nodes of change files */
+  {
+    return;
+  }
+
+  double nodeLatitude = std::strtod(latitude, 0);
+  double nodeLongitude = std::strtod(longitude, 0);
+  if (!hasOrigin)
+  {
+    setOrigin(nodeLatitude, nodeLongitude);
+  }
+
+  Node node;
+  node.id = std::strtoll(id, 0, 10);
+  node.x = (nodeLongitude - originLongitude) / longitudeScale;
+  node.y = (nodeLatitude - originLatitude) / DEGREES_PER_METER;
+  node.welded = -1;
+
+  if (!nodes.empty() && node.id <= nodes.back().id)
+  {
+    nodesSorted = false;
+  }
+  nodes.push_back(node);
+  nodesRead++;
+}
+
+void OsmReader::readTag(Attributes const& attributes)
+{
+  char const* key = find(attributes, "k");
+  char const* value = find(attributes, "v");
+  if (key == 0 || value == 0)
+  {
+    return;
+  }
+
+  if (std::strcmp(key, "highway") == 0)
+  {
+    highway = value;
+  }
+  else if (std::strcmp(key, "area") == 0)
+  {
+    isArea = std::strcmp(value, "yes") == 0;
+  }
+  else if (std::strcmp(key, "libcity:type") == 0)
+  {
+    hasLibcityType = true;
+    libcityType = std::strtoul(value, 0, 10);
+  }
+}
+
+void OsmReader::finishWay()
+{
+  Road::Type type;
+  if (highway.empty() || isArea)
+  {
+    return;
+  }
+  if (hasLibcityType)
+  {
+    type = libcityType;
+  }
+  else if (!roadType(highway, &type))
+  {
+    return;
+  }
+
+  /* Nodes missing in the file (cut off by the extract) split the way */
+  int previous = -1;
+  int added = 0;
+  for (std::vector<long long>::iterator id = wayNodes.begin();
+       id != wayNodes.end();
+       id++)
+  {
+    Node* node = findNode(*id);
+    int current = node != 0 ? weld(node) : -1;
+    if (previous >= 0 && current >= 0 && previous != current)
+    {
+      segmentBeginings.push_back(previous);
+      segmentEnds.push_back(current);
+      types.push_back(type);
+      added++;
+    }
+    previous = current;
+  }
+
+  if (added > 0)
+  {
+    ways++;
+    segments += added;
+  }
+}
+
+void OsmReader::addSegments(StreetGraph* graph)
+{
+  /* Roads already in the graph could cross any of the segments */
+  std::vector<bool> crossed(types.size(), graph->numberOfRoads() > 0);
+  if (graph->numberOfRoads() == 0)
+  {
+    std::vector<LineSegment> lines;
+    lines.reserve(types.size());
+    for (unsigned int i = 0; i < types.size(); i++)
+    {
+      lines.push_back(LineSegment(weldedPositions[segmentBeginings[i]], weldedPositions[segmentEnds[i]]));
+    }
+
+    std::vector<SegmentSweep::Crossing> crossings;
+    SegmentSweep(lines).findCrossings(&crossings);
+    for (std::vector<SegmentSweep::Crossing>::iterator crossing = crossings.begin();
+         crossing != crossings.end();
+         crossing++)
+    {
+      int first = crossing->first, second = crossing->second;
+      bool sharedNode = segmentBeginings[first] == segmentBeginings[second] ||
+                        segmentBeginings[first] == segmentEnds[second] ||
+                        segmentEnds[first] == segmentBeginings[second] ||
+                        segmentEnds[first] == segmentEnds[second];
+      if (crossing->type != LineSegment::INTERSECTING || !sharedNode)
+      /* Crossing, touching or overlapping, the graph has to split them */
+      {
+        crossed[first] = true;
+        crossed[second] = true;
+      }
+    }
+  }
+
+  /* Only nodes of planar segments become intersections directly */
+  std::vector<int> intersectionIndices(weldedPositions.size(), -1);
+  std::vector<Point> positions;
+  std::vector<int> beginings, ends;
+  std::vector<Road::Type> planarTypes, crossedTypes;
+  std::vector<Path> crossedPaths;
+  auto intersectionIndex = [&](int node)
+  {
+    if (intersectionIndices[node] < 0)
+    {
+      intersectionIndices[node] = positions.size();
+      positions.push_back(weldedPositions[node]);
+    }
+    return intersectionIndices[node];
+  };
+
+  for (unsigned int i = 0; i < types.size(); i++)
+  {
+    int begining = segmentBeginings[i], end = segmentEnds[i];
+    if (crossed[i])
+    {
+      crossedPaths.push_back(Path(LineSegment(weldedPositions[begining], weldedPositions[end])));
+      crossedTypes.push_back(types[i]);
+      continue;
+    }
+
+    beginings.push_back(intersectionIndex(begining));
+    ends.push_back(intersectionIndex(end));
+    planarTypes.push_back(types[i]);
+  }
+
+  graph->addPlanarRoads(positions, beginings, ends, planarTypes);
+  graph->addRoads(crossedPaths, crossedTypes);
+}
+
+OsmReader::Node* OsmReader::findNode(long long id)
+{
+  if (!nodesSorted)
+  /* Files are sorted by ids as a rule, this happens at most once */
+  {
+    std::stable_sort(nodes.begin(), nodes.end(),
+                     [](Node const& first, Node const& second) { return first.id < second.id; });
+    nodesSorted = true;
+  }
+
+  std::vector<Node>::iterator found =
+    std::lower_bound(nodes.begin(), nodes.end(), id,
+                     [](Node const& node, long long value) { return node.id < value; });
+  if (found == nodes.end() || found->id != id)
+  {
+    return 0;
+  }
+  return &(*found);
+}
+
+int OsmReader::weld(Node* node)
+{
+  if (node->welded >= 0)
+  {
+    return node->welded;
+  }
+
+  long long column = static_cast<long long>(std::floor(node->x / weldDistance));
+  long long row = static_cast<long long>(std::floor(node->y / weldDistance));
+  double limit = weldDistance * weldDistance;
+
+  for (long long neighbourColumn = column - 1; neighbourColumn <= column + 1; neighbourColumn++)
+  {
+    for (long long neighbourRow = row - 1; neighbourRow <= row + 1; neighbourRow++)
+    {
+      std::unordered_map<long long, int>::iterator cell = cells.find(cellKey(neighbourColumn, neighbourRow));
+      if (cell == cells.end())
+      {
+        continue;
+      }
+
+      for (int welded = cell->second; welded >= 0; welded = nextInCell[welded])
+      {
+        double dx = weldedPositions[welded].x() - node->x;
+        double dy = weldedPositions[welded].y() - node->y;
+        if (dx*dx + dy*dy <= limit)
+        {
+          node->welded = welded;
+          return welded;
+        }
+      }
+    }
+  }
+
+  node->welded = weldedPositions.size();
+  weldedPositions.push_back(Point(node->x, node->y));
+
+  long long key = cellKey(column, row);
+  std::unordered_map<long long, int>::iterator cell = cells.find(key);
+  nextInCell.push_back(cell != cells.end() ? cell->second : -1);
+  cells[key] = node->welded;
+  return node->welded;
+}
+
+void OsmReader::clear()
+{
+  nodes.clear();
+  nodesSorted = true;
+  weldedPositions.clear();
+  nextInCell.clear();
+  cells.clear();
+
+  inWay = false;
+  wayNodes.clear();
+  highway.clear();
+  isArea = false;
+  hasLibcityType = false;
+  libcityType = Road::PRIMARY_ROAD;
+
+  segmentBeginings.clear();
+  segmentEnds.clear();
+  types.clear();
+  ways = 0;
+  segments = 0;
+  nodesRead = 0;
+  weldedNodes = 0;
+}
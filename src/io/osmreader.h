@@ -0,0 +1,151 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/osmreader.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Import of road networks from OSM XML
+ *
+ * The file is parsed as a stream (see XmlParser). Nodes are kept
+ * in an array sorted by their ids, ways are turned into road
+ * segments as soon as they end. When the file is read, the
+ * segments are added to the graph in two batches. Segments that
+ * meet the others only in their shared nodes go through
+ * StreetGraph::addPlanarRoads() without any tests. The rest, and
+ * all of them if the graph already has roads, go through
+ * StreetGraph::addRoads(), which splits them where they cross.
+ *
+ * Nodes of roads closer than the weld distance are merged into
+ * one intersection, so duplicated nodes and ways that almost
+ * meet are connected. The graph is planar, so ways that cross
+ * without a shared node (e.g. bridges) get an intersection too.
+ *
+ * Ways are roads if they are tagged with one of the highway
+ * values of car roads and aren't areas. The "libcity:type" tag
+ * written by OsmWriter takes precedence over "highway".
+ *
+ * Latitudes and longitudes are projected to meters to the east
+ * and north of the origin, the same way as MapWriter does it.
+ * A unit of the graph is taken as a meter, libcity::METER
+ * isn't applied.
+ */
+
+#ifndef _OSMREADER_H_
+#define _OSMREADER_H_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "xmlparser.h"
+#include "../streetgraph/road.h"
+#include "../geometry/point.h"
+
+class StreetGraph;
+
+class OsmReader : private XmlParser
+{
+  public:
+    static const double DEFAULT_WELD_DISTANCE;
+
+    OsmReader();
+    virtual ~OsmReader();
+
+    /**
+      Origin of the coordinates. The center of the bounds element
+      or the first node of the file is used if it isn't set.
+     */
+    void setOrigin(double latitude, double longitude);
+
+    /** Distance in meters under which road nodes are merged. */
+    void setWeldDistance(double meters);
+
+    /**
+      Add the roads of the file to the graph.
+     @return False if the file couldn't be read or parsed, the
+             graph is left unchanged in that case.
+     */
+    bool read(std::string const& fileName, StreetGraph* graph);
+
+    /**
+      Road type for a highway tag value.
+     @remarks
+       Primary and secondary roads are the built-in types, every
+       other kind of car road gets its own type on the first use
+       (see Road::defineNewRoadType()). Links share the type of
+       the road they belong to, e.g. "primary_link".
+     @return False if the value isn't a car road (e.g. "footway").
+     */
+    static bool roadType(std::string const& highway, Road::Type* type);
+
+    /* Statistics of the last read() */
+    int numberOfNodes() const;
+    int numberOfWays() const;
+    int numberOfWeldedNodes() const;
+    int numberOfSegments() const;
+
+  private:
+    struct Node
+    {
+      long long id;
+      double x;
+      double y;
+      int welded; /**< Index of the welded position or -1. */
+    };
+
+    /* Projection */
+    bool hasOrigin;
+    double originLatitude;
+    double originLongitude;
+    double longitudeScale;
+
+    /* Nodes of the file */
+    std::vector<Node> nodes;
+    bool nodesSorted;
+
+    /* Welded road nodes, a spatial hash with cells of the weld distance */
+    double weldDistance;
+    std::vector<Point> weldedPositions;
+    std::vector<int> nextInCell;
+    std::unordered_map<long long, int> cells;
+
+    /* Way being read */
+    bool inWay;
+    std::vector<long long> wayNodes;
+    std::string highway;
+    bool isArea;
+    bool hasLibcityType;
+    Road::Type libcityType;
+
+    /* Segments collected for the graph, ends are welded nodes */
+    std::vector<int> segmentBeginings;
+    std::vector<int> segmentEnds;
+    std::vector<Road::Type> types;
+
+    /* Statistics */
+    int nodesRead;
+    int weldedNodes;
+    int ways;
+    int segments;
+
+    virtual void startElement(char const* name, Attributes const& attributes);
+    virtual void endElement(char const* name);
+
+    void readNode(Attributes const& attributes);
+    void readTag(Attributes const& attributes);
+    void finishWay();
+
+    /** Add the collected segments to the graph. */
+    void addSegments(StreetGraph* graph);
+
+    /** @return The node or 0 if the file doesn't have it. */
+    Node* findNode(long long id);
+
+    /** @return Index of the welded position of the node. */
+    int weld(Node* node);
+
+    void clear();
+};
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/osmwriter.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/osmwriter.h
+ *
+ */
+
+#include "osmwriter.h"
+#include "outputstream.h"
+
+#include "../streetgraph/intersection.h"
+#include "../streetgraph/road.h"
+#include "../geometry/polygon.h"
+#include "../geometry/point.h"
+
+OsmWriter::OsmWriter(OutputStream* stream)
+  : MapWriter(stream), lastNode(0), lastWay(0), finished(false)
+{
+  /* OSM knows only latitudes and longitudes */
+  setOrigin(0, 0);
+
+  output->write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                "<osm version=\"0.6\" generator=\"libcity\">\n");
+}
+
+OsmWriter::~OsmWriter()
+{
+  finish();
+}
+
+long long OsmWriter::writeNode(Point const& position)
+{
+  output->write("  <node id=\"");
+  output->writeInteger(--lastNode);
+  output->write("\" ");
+  /* Coordinates come as longitude and latitude */
+  output->write("lon=\"");
+  writeCoordinates(position, "\" lat=\"");
+  output->write("\"/>\n");
+  return lastNode;
+}
+
+void OsmWriter::beginWay()
+{
+  output->write("  <way id=\"");
+  output->writeInteger(--lastWay);
+  output->write("\">\n");
+}
+
+void OsmWriter::writeNodeReference(long long node)
+{
+  output->write("    <nd ref=\"");
+  output->writeInteger(node);
+  output->write("\"/>\n");
+}
+
+void OsmWriter::writeTag(char const* key, char const* value)
+{
+  output->write("    <tag k=\"");
+  output->write(key);
+  output->write("\" v=\"");
+  output->write(value);
+  output->write("\"/>\n");
+}
+
+void OsmWriter::writeIntersection(Intersection* intersection)
+{
+  if (intersectionNodes.count(intersection) == 0)
+  {
+    intersectionNodes[intersection] = writeNode(intersection->position());
+  }
+}
+
+void OsmWriter::writeRoad(Road* road)
+{
+  writeIntersection(road->begining());
+  writeIntersection(road->end());
+
+  beginWay();
+  writeNodeReference(intersectionNodes[road->begining()]);
+  writeNodeReference(intersectionNodes[road->end()]);
+
+  Road::Type type = road->type();
+  writeTag("highway", type == Road::PRIMARY_ROAD ? "primary" :
+                      type == Road::SECONDARY_ROAD ? "secondary" : "road");
+  output->write("    <tag k=\"libcity:type\" v=\"");
+  output->writeInteger(type);
+  output->write("\"/>\n  </way>\n");
+}
+
+void OsmWriter::writeArea(Polygon const& border, AreaType type)
+{
+  long long firstNode = lastNode - 1;
+  for (unsigned int vertex = 0; vertex < border.numberOfVertices(); vertex++)
+  {
+    writeNode(border.vertex(vertex));
+  }
+
+  beginWay();
+  /* Closed way, the first node is repeated */
+  for (unsigned int vertex = 0; vertex <= border.numberOfVertices() && border.numberOfVertices() > 0; vertex++)
+  {
+    writeNodeReference(firstNode - vertex % border.numberOfVertices());
+  }
+  writeTag("area", "yes");
+  writeTag("libcity:area", areaName(type));
+  output->write("  </way>\n");
+}
+
+bool OsmWriter::finish()
+{
+  if (!finished)
+  {
+    output->write("</osm>\n");
+    finished = true;
+  }
+  return output->flush();
+}
@@ -0,0 +1,66 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/osmwriter.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Streaming export of a city map to OSM XML
+ *
+ * Intersections become nodes and roads become ways tagged with
+ * "highway" (primary, secondary or road for the other types)
+ * and "libcity:type". Areas are closed ways tagged with
+ * "area=yes" and "libcity:area" (zone, block or lot), each of
+ * them is preceded by the nodes of its border.
+ *
+ * All the objects are new, so they have negative ids as OSM
+ * editors expect. The writer remembers the ids of the written
+ * intersections, an intersection is written before the first
+ * road that needs it.
+ *
+ * Unlike the rest of the export, the ids take memory: one entry
+ * for each written intersection, O(intersections) until the
+ * writer is destroyed. Ways refer to the nodes by their ids and
+ * roads know only the pointers of their intersections, so the
+ * ids can't be derived without such a lookup.
+ *
+ * OSM always uses latitudes and longitudes. The origin is at
+ * zero latitude and longitude unless setOrigin() moves it.
+ */
+
+#ifndef _OSMWRITER_H_
+#define _OSMWRITER_H_
+
+#include <unordered_map>
+
+#include "mapwriter.h"
+
+class OsmWriter : public MapWriter
+{
+  public:
+    /** Starts the osm element. */
+    OsmWriter(OutputStream* stream);
+    virtual ~OsmWriter();
+
+    virtual void writeIntersection(Intersection* intersection);
+    virtual void writeRoad(Road* road);
+    virtual void writeArea(Polygon const& border, AreaType type);
+
+    virtual bool finish();
+
+  private:
+    long long lastNode;
+    long long lastWay;
+    bool finished;
+
+    /** Node ids of the written intersections, grows with the graph. */
+    std::unordered_map<Intersection*, long long> intersectionNodes;
+
+    /** @return Id of the new node. */
+    long long writeNode(Point const& position);
+    void beginWay();
+    void writeNodeReference(long long node);
+    void writeTag(char const* key, char const* value);
+};
+
+#endif
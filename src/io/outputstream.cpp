@@ -0,0 +1,233 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/outputstream.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/outputstream.h
+ *
+ */
+
+#include "outputstream.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+#include <unistd.h>
+
+const std::size_t OutputStream::DEFAULT_BUFFER_SIZE = 1 << 16;
+
+namespace
+{
+  const double POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+  const int MAXIMAL_DECIMALS = 9;
+
+  /** Magnitude up to which the scaled value fits into long long. */
+  const double MAXIMAL_SCALED = 9e18;
+}
+
+OutputStream::OutputStream(int fileDescriptor, std::size_t bufferSize, bool inBackground)
+  : descriptor(fileDescriptor), capacity(bufferSize > 0 ? bufferSize : 1),
+    current(0), used(0), total(0),
+    background(inBackground), pending(0), stopping(false), error(false)
+{
+  buffers[0].resize(capacity);
+  if (background)
+  {
+    buffers[1].resize(capacity);
+    writer = std::thread(&OutputStream::writerLoop, this);
+  }
+}
+
+OutputStream::~OutputStream()
+{
+  flush();
+
+  if (background)
+  {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      stopping = true;
+    }
+    changed.notify_all();
+    writer.join();
+  }
+}
+
+void OutputStream::write(char const* data, std::size_t length)
+{
+  total += length;
+  while (length > 0)
+  {
+    if (used == capacity)
+    {
+      submit();
+    }
+
+    std::size_t part = std::min(length, capacity - used);
+    std::memcpy(&buffers[current][used], data, part);
+    used += part;
+    data += part;
+    length -= part;
+  }
+}
+
+void OutputStream::write(std::string const& text)
+{
+  write(text.data(), text.size());
+}
+
+void OutputStream::writeInteger(long long value)
+{
+  char digits[24];
+  int length = 0;
+  unsigned long long magnitude = value < 0 ? -static_cast<unsigned long long>(value) : value;
+  do
+  {
+    digits[length++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude > 0);
+
+  if (value < 0)
+  {
+    write('-');
+  }
+  while (length > 0)
+  {
+    write(digits[--length]);
+  }
+}
+
+void OutputStream::writeFixed(double value, int decimals)
+{
+  if (decimals < 0)
+  {
+    decimals = 0;
+  }
+  if (decimals > MAXIMAL_DECIMALS ||
+      !(std::fabs(value) * POWERS_OF_TEN[decimals] < MAXIMAL_SCALED))
+  /* Too precise, too large or not a number at all */
+  {
+    char text[400];
+    int length = std::snprintf(text, sizeof(text), "%.*f", decimals, value);
+    write(text, length);
+    return;
+  }
+
+  long long scaled = std::llround(value * POWERS_OF_TEN[decimals]);
+  long long unit = static_cast<long long>(POWERS_OF_TEN[decimals]);
+  if (scaled < 0)
+  {
+    write('-');
+    scaled = -scaled;
+  }
+  writeInteger(scaled / unit);
+
+  if (decimals > 0)
+  {
+    write('.');
+    long long fraction = scaled % unit;
+    for (long long digit = unit / 10; digit > 0; digit /= 10)
+    {
+      write(static_cast<char>('0' + (fraction / digit) % 10));
+    }
+  }
+}
+
+bool OutputStream::flush()
+{
+  if (used > 0)
+  {
+    submit();
+  }
+
+  if (background)
+  {
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this] { return pending == 0; });
+  }
+
+  return !failed();
+}
+
+bool OutputStream::failed() const
+{
+  std::lock_guard<std::mutex> guard(lock);
+  return error;
+}
+
+unsigned long long OutputStream::bytesWritten() const
+{
+  return total;
+}
+
+void OutputStream::submit()
+{
+  if (!background)
+  {
+    if (!writeOut(&buffers[current][0], used))
+    {
+      error = true;
+    }
+    used = 0;
+    return;
+  }
+
+  /* Wait for the writer to finish the other buffer */
+  {
+    std::unique_lock<std::mutex> guard(lock);
+    changed.wait(guard, [this] { return pending == 0; });
+    pending = used;
+    current = 1 - current;
+  }
+  changed.notify_all();
+  used = 0;
+}
+
+bool OutputStream::writeOut(char const* data, std::size_t length)
+{
+  while (length > 0)
+  {
+    ssize_t written = ::write(descriptor, data, length);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    length -= written;
+  }
+  return true;
+}
+
+void OutputStream::writerLoop()
+{
+  std::unique_lock<std::mutex> guard(lock);
+  while (true)
+  {
+    changed.wait(guard, [this] { return pending > 0 || stopping; });
+    if (pending == 0)
+    /* Stopping and there's nothing left */
+    {
+      return;
+    }
+
+    /* The caller fills the other buffer meanwhile */
+    char const* data = &buffers[1 - current][0];
+    std::size_t length = pending;
+    guard.unlock();
+    bool succeeded = writeOut(data, length);
+    guard.lock();
+
+    error = error || !succeeded;
+    pending = 0;
+    changed.notify_all();
+  }
+}
@@ -0,0 +1,110 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/outputstream.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Buffered output to a file descriptor
+ *
+ * Text is collected in a buffer of a fixed size and written
+ * to the descriptor whenever the buffer fills up, so the memory
+ * used doesn't depend on how much is written.
+ *
+ * In the background mode there are two buffers. A full buffer
+ * is handed over to a writer thread and the caller goes on
+ * filling the other one, so formatting and writing to the disk
+ * overlap. The caller waits only when both buffers are full.
+ *
+ * Numbers are formatted without iostreams and don't depend
+ * on the locale.
+ */
+
+#ifndef _OUTPUTSTREAM_H_
+#define _OUTPUTSTREAM_H_
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class OutputStream
+{
+  public:
+    static const std::size_t DEFAULT_BUFFER_SIZE;
+
+    /**
+     @param[in] fileDescriptor Where to write, it isn't closed by the stream.
+     @param[in] bufferSize     Size of the buffer (each of the two buffers
+                               in the background mode).
+     @param[in] inBackground   Write from a separate thread.
+     */
+    OutputStream(int fileDescriptor, std::size_t bufferSize = DEFAULT_BUFFER_SIZE,
+                 bool inBackground = false);
+
+    /** Flushes the buffers. */
+    ~OutputStream();
+
+    void write(char const* data, std::size_t length);
+    void write(std::string const& text);
+    void write(char character);
+
+    void writeInteger(long long value);
+
+    /** Number with a fixed number of decimal places, e.g. "-12.500". */
+    void writeFixed(double value, int decimals);
+
+    /**
+      Write out everything written so far.
+     @return False if any write failed.
+     */
+    bool flush();
+
+    bool failed() const;
+
+    /** Bytes passed to the stream so far. */
+    unsigned long long bytesWritten() const;
+
+  private: /* Copying not allowed */
+    OutputStream(OutputStream const& source);
+    OutputStream& operator=(OutputStream const& source);
+
+    int descriptor;
+    std::size_t capacity;
+
+    std::vector<char> buffers[2];
+    int current;        /**< Buffer being filled. */
+    std::size_t used;   /**< Bytes in the current buffer. */
+    unsigned long long total;
+
+    /* Background writing */
+    bool background;
+    std::thread writer;
+    mutable std::mutex lock;
+    std::condition_variable changed;
+    std::size_t pending; /**< Bytes of the other buffer not yet written. */
+    bool stopping;
+    bool error;
+
+    /** Pass the current buffer on to be written and empty it. */
+    void submit();
+
+    /** Write to the descriptor directly. */
+    bool writeOut(char const* data, std::size_t length);
+    void writerLoop();
+};
+
+/* Inlines */
+inline void OutputStream::write(char character)
+{
+  if (used == capacity)
+  {
+    submit();
+  }
+  buffers[current][used++] = character;
+  total++;
+}
+
+#endif
@@ -0,0 +1,459 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/xmlparser.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see io/xmlparser.h
+ *
+ */
+
+#include "xmlparser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+const std::size_t XmlParser::DEFAULT_BUFFER_SIZE = 1 << 16;
+
+namespace
+{
+  inline bool isSpace(char character)
+  {
+    return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+  }
+
+  /** @return Last character of the pattern found in [from, to) or 0. */
+  char* findPattern(char* from, char* to, char const* pattern)
+  {
+    std::size_t length = std::strlen(pattern);
+    char* found = std::search(from, to, pattern, pattern + length);
+    return found == to ? 0 : found + length - 1;
+  }
+
+  /**
+    Find the '>' that ends the markup starting at '<'.
+   @return Pointer to it or 0 if it isn't in the buffer yet.
+   */
+  char* markupEnd(char* start, char* end)
+  {
+    std::ptrdiff_t available = end - start;
+    if (available < 2)
+    {
+      return 0;
+    }
+
+    if (start[1] == '?')
+    {
+      return findPattern(start + 2, end, "?>");
+    }
+
+    if (start[1] == '!')
+    {
+      if (available < 4)
+      {
+        return 0;
+      }
+      if (std::memcmp(start, "<!--", 4) == 0)
+      {
+        return findPattern(start + 4, end, "-->");
+      }
+      if (std::memcmp(start, "<![", 3) == 0)
+      {
+        if (available < 9)
+        {
+          return 0;
+        }
+        if (std::memcmp(start, "<![CDATA[", 9) == 0)
+        {
+          return findPattern(start + 9, end, "]]>");
+        }
+      }
+      return static_cast<char*>(std::memchr(start, '>', available));
+    }
+
+    /* Element, '>' may be in quoted attribute values */
+    char quote = 0;
+    for (char* position = start + 1; position < end; position++)
+    {
+      if (quote != 0)
+      {
+        if (*position == quote)
+        {
+          quote = 0;
+        }
+      }
+      else if (*position == '"' || *position == '\'')
+      {
+        quote = *position;
+      }
+      else if (*position == '>')
+      {
+        return position;
+      }
+    }
+    return 0;
+  }
+
+  /** @return Number of bytes written. */
+  int encodeUtf8(unsigned long codePoint, char* output)
+  {
+    if (codePoint < 0x80)
+    {
+      output[0] = codePoint;
+      return 1;
+    }
+    if (codePoint < 0x800)
+    {
+      output[0] = 0xC0 | (codePoint >> 6);
+      output[1] = 0x80 | (codePoint & 0x3F);
+      return 2;
+    }
+    if (codePoint < 0x10000)
+    {
+      output[0] = 0xE0 | (codePoint >> 12);
+      output[1] = 0x80 | ((codePoint >> 6) & 0x3F);
+      output[2] = 0x80 | (codePoint & 0x3F);
+      return 3;
+    }
+    output[0] = 0xF0 | (codePoint >> 18);
+    output[1] = 0x80 | ((codePoint >> 12) & 0x3F);
+    output[2] = 0x80 | ((codePoint >> 6) & 0x3F);
+    output[3] = 0x80 | (codePoint & 0x3F);
+    return 4;
+  }
+
+  /**
+    Decode the number of a character reference, "65" or "x41".
+   @remarks
+     Only digits are accepted, no spaces, signs or "0x".
+   @return False unless the whole [from, to) is the number of
+           a Unicode character other than 0 and the surrogates.
+   */
+  bool decodeCharacterReference(char const* from, char const* to, unsigned long* codePoint)
+  {
+    int base = 10;
+    if (from != to && *from == 'x')
+    {
+      base = 16;
+      from++;
+    }
+    if (from == to)
+    {
+      return false;
+    }
+
+    /* References are short, the number can't overflow */
+    unsigned long value = 0;
+    for (char const* digit = from; digit != to; digit++)
+    {
+      int digitValue;
+      if (*digit >= '0' && *digit <= '9')
+      {
+        digitValue = *digit - '0';
+      }
+      else if (base == 16 && *digit >= 'a' && *digit <= 'f')
+      {
+        digitValue = *digit - 'a' + 10;
+      }
+      else if (base == 16 && *digit >= 'A' && *digit <= 'F')
+      {
+        digitValue = *digit - 'A' + 10;
+      }
+      else
+      {
+        return false;
+      }
+      value = value * base + digitValue;
+    }
+
+    *codePoint = value;
+    return value > 0 && value <= 0x10FFFF && (value < 0xD800 || value > 0xDFFF);
+  }
+
+  /** Longest entity reference decoded, "&#x10FFFF;". */
+  const int MAXIMAL_REFERENCE = 10;
+}
+
+XmlParser::XmlParser(std::size_t bufferSize)
+  : buffer(bufferSize > 0 ? bufferSize : 1)
+{}
+
+XmlParser::~XmlParser()
+{}
+
+bool XmlParser::parseFile(std::string const& fileName)
+{
+  int descriptor = open(fileName.c_str(), O_RDONLY);
+  if (descriptor < 0)
+  {
+    return false;
+  }
+
+  bool parsed = parse(descriptor);
+  close(descriptor);
+  return parsed;
+}
+
+bool XmlParser::parse(int fileDescriptor)
+{
+  std::size_t begin = 0, end = 0;
+  bool endOfFile = false;
+  int depth = 0;
+
+  while (true)
+  {
+    /* Handle everything complete in the buffer */
+    while (begin < end)
+    {
+      char* data = &buffer[0];
+      char* start = static_cast<char*>(std::memchr(data + begin, '<', end - begin));
+      if (start == 0)
+      /* Text content only */
+      {
+        begin = end;
+        break;
+      }
+
+      begin = start - data;
+      char* close = markupEnd(start, data + end);
+      if (close == 0)
+      {
+        break;
+      }
+
+      if (!parseTag(start + 1, close, &depth))
+      {
+        return false;
+      }
+      begin = close - data + 1;
+    }
+
+    if (endOfFile)
+    {
+      return begin == end && depth == 0;
+    }
+
+    /* Keep the incomplete markup and read more */
+    if (begin > 0)
+    {
+      std::memmove(&buffer[0], &buffer[begin], end - begin);
+      end -= begin;
+      begin = 0;
+    }
+    if (end == buffer.size())
+    {
+      buffer.resize(2 * buffer.size());
+    }
+
+    ssize_t length = read(fileDescriptor, &buffer[end], buffer.size() - end);
+    if (length < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return false;
+    }
+    endOfFile = length == 0;
+    end += length;
+  }
+}
+
+char const* XmlParser::find(Attributes const& attributes, char const* name)
+{
+  for (Attributes::const_iterator attribute = attributes.begin();
+       attribute != attributes.end();
+       attribute++)
+  {
+    if (std::strcmp(attribute->name, name) == 0)
+    {
+      return attribute->value;
+    }
+  }
+  return 0;
+}
+
+bool XmlParser::parseTag(char* tag, char* tagEnd, int* depth)
+{
+  if (*tag == '!' || *tag == '?')
+  /* Comment, CDATA, DOCTYPE or processing instruction */
+  {
+    return true;
+  }
+
+  if (*tag == '/')
+  {
+    char* name = tag + 1;
+    char* nameEnd = name;
+    while (nameEnd < tagEnd && !isSpace(*nameEnd))
+    {
+      nameEnd++;
+    }
+    *nameEnd = '\0';
+
+    if (nameEnd == name || --*depth < 0)
+    {
+      return false;
+    }
+    endElement(name);
+    return true;
+  }
+
+  bool empty = tagEnd > tag && tagEnd[-1] == '/';
+  if (empty)
+  {
+    tagEnd--;
+  }
+
+  char* name = tag;
+  char* position = tag;
+  while (position < tagEnd && !isSpace(*position))
+  {
+    position++;
+  }
+  if (position == name)
+  {
+    return false;
+  }
+  char* nameEnd = position;
+
+  attributes.clear();
+  while (true)
+  {
+    while (position < tagEnd && isSpace(*position))
+    {
+      position++;
+    }
+    if (position >= tagEnd)
+    {
+      break;
+    }
+
+    Attribute attribute;
+    attribute.name = position;
+    while (position < tagEnd && *position != '=' && !isSpace(*position))
+    {
+      position++;
+    }
+    char* attributeNameEnd = position;
+
+    while (position < tagEnd && isSpace(*position))
+    {
+      position++;
+    }
+    if (position >= tagEnd || *position != '=')
+    {
+      return false;
+    }
+    position++;
+    while (position < tagEnd && isSpace(*position))
+    {
+      position++;
+    }
+    if (position >= tagEnd || (*position != '"' && *position != '\''))
+    {
+      return false;
+    }
+
+    char quote = *position++;
+    char* value = position;
+    while (position < tagEnd && *position != quote)
+    {
+      position++;
+    }
+    if (position >= tagEnd)
+    {
+      return false;
+    }
+    char* valueEnd = position++;
+
+    *attributeNameEnd = '\0';
+    decode(value, valueEnd);
+    attribute.value = value;
+    attributes.push_back(attribute);
+  }
+  *nameEnd = '\0';
+
+  startElement(name, attributes);
+  if (empty)
+  {
+    endElement(name);
+  }
+  else
+  {
+    ++*depth;
+  }
+  return true;
+}
+
+void XmlParser::decode(char* value, char* valueEnd)
+{
+  char* output = value;
+  char* input = value;
+  while (input < valueEnd)
+  {
+    if (*input != '&')
+    {
+      *output++ = *input++;
+      continue;
+    }
+
+    char* semicolon = static_cast<char*>(std::memchr(input, ';',
+                      std::min<std::ptrdiff_t>(valueEnd - input, MAXIMAL_REFERENCE)));
+    if (semicolon == 0)
+    {
+      *output++ = *input++;
+      continue;
+    }
+
+    char* reference = input + 1;
+    std::size_t length = semicolon - reference;
+    char character = 0;
+    if (length == 3 && std::memcmp(reference, "amp", 3) == 0)
+    {
+      character = '&';
+    }
+    else if (length == 2 && std::memcmp(reference, "lt", 2) == 0)
+    {
+      character = '<';
+    }
+    else if (length == 2 && std::memcmp(reference, "gt", 2) == 0)
+    {
+      character = '>';
+    }
+    else if (length == 4 && std::memcmp(reference, "quot", 4) == 0)
+    {
+      character = '"';
+    }
+    else if (length == 4 && std::memcmp(reference, "apos", 4) == 0)
+    {
+      character = '\'';
+    }
+    else if (length > 1 && reference[0] == '#')
+    /* Character reference, the semicolon ends the number */
+    {
+      unsigned long codePoint;
+      if (decodeCharacterReference(reference + 1, semicolon, &codePoint))
+      {
+        output += encodeUtf8(codePoint, output);
+        input = semicolon + 1;
+        continue;
+      }
+    }
+
+    if (character == 0)
+    /* Unknown reference, kept as it is */
+    {
+      *output++ = *input++;
+      continue;
+    }
+    *output++ = character;
+    input = semicolon + 1;
+  }
+  *output = '\0';
+}
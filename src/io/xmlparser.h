@@ -0,0 +1,79 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file io/xmlparser.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Streaming (SAX-style) XML parser
+ *
+ * The document is read in chunks into a buffer and each element
+ * is passed to startElement() and endElement() as soon as it's
+ * read, so the memory used doesn't depend on the size of the
+ * document. Names and attributes point into the buffer and are
+ * valid only during the call.
+ *
+ * Only what map data needs is supported. Text content, comments,
+ * CDATA, processing instructions and DOCTYPE are skipped, entity
+ * references are decoded in attribute values. Nesting of the
+ * elements is not checked beyond their number.
+ */
+
+#ifndef _XMLPARSER_H_
+#define _XMLPARSER_H_
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+class XmlParser
+{
+  public:
+    struct Attribute
+    {
+      char const* name;
+      char const* value;
+    };
+
+    typedef std::vector<Attribute> Attributes;
+
+    static const std::size_t DEFAULT_BUFFER_SIZE;
+
+    /** The buffer grows if a single tag doesn't fit. */
+    XmlParser(std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    virtual ~XmlParser();
+
+    /**
+      Read the whole document.
+     @param[in] fileDescriptor Where to read from, it isn't closed.
+     @return False if reading failed or the document ended
+             in the middle of a tag or an element.
+     */
+    bool parse(int fileDescriptor);
+    bool parseFile(std::string const& fileName);
+
+    /** @return Value of the attribute or 0 if there's none. */
+    static char const* find(Attributes const& attributes, char const* name);
+
+  protected:
+    virtual void startElement(char const* name, Attributes const& attributes) = 0;
+    virtual void endElement(char const* name) = 0;
+
+  private: /* Copying not allowed */
+    XmlParser(XmlParser const& source);
+    XmlParser& operator=(XmlParser const& source);
+
+    std::vector<char> buffer;
+    Attributes attributes;
+
+    /**
+      Parse the tag between '<' and '>' (both excluded).
+     @return False if it's malformed.
+     */
+    bool parseTag(char* tag, char* tagEnd, int* depth);
+
+    /** Decode entity references in place and terminate the value. */
+    static void decode(char* value, char* valueEnd);
+};
+
+#endif
@@ -40,11 +40,22 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "geometry/polygon.h"
 #include "geometry/ray.h"
 #include "geometry/shape.h"
+#include "geometry/segmentsweep.h"
+#include "geometry/predicates.h"
+#include "geometry/batch.h"
+#include "geometry/triangulator.h"
 
 #include "streetgraph/road.h"
 #include "streetgraph/path.h"
 #include "streetgraph/intersection.h"
 #include "streetgraph/streetgraph.h"
+#include "streetgraph/intersectiongrid.h"
+#include "streetgraph/roadgrid.h"
+#include "streetgraph/gridcell.h"
+#include "streetgraph/compactstreetgraph.h"
+#include "streetgraph/face.h"
+#include "streetgraph/facetracker.h"
+#include "streetgraph/streetgraphlistener.h"
 #include "streetgraph/rasterroadpattern.h"
 #include "streetgraph/organicroadpattern.h"
 #include "streetgraph/areaextractor.h"
@@ -54,6 +65,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "area/block.h"
 #include "area/lot.h"
 #include "area/subregion.h"
+#include "area/spatialindex.h"
 
 #include "lsystem/lsystem.h"
 #include "lsystem/graphiclsystem.h"
@@ -62,8 +74,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "entities/urbanentity.h"
 #include "entities/building.h"
 
+#include "io/cityfile.h"
+#include "io/outputstream.h"
+#include "io/mapwriter.h"
+#include "io/geojsonwriter.h"
+#include "io/osmwriter.h"
+#include "io/xmlparser.h"
+#include "io/osmreader.h"
+
 #include "random.h"
+#include "threadpool.h"
+#include "range.h"
 #include "city.h"
+#include "tiledcity.h"
 #include "debug.h"
 
 #endif
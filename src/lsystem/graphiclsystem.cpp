@@ -16,10 +16,8 @@
 #include "../geometry/vector.h"
 
 GraphicLSystem::GraphicLSystem()
-  : LSystem(), cursor(), graphicInformationForSymbols(0)
+  : LSystem(), cursor(), readPositionRevision(0), interpretedSymbolRemoved(false)
 {
-  graphicInformationForSymbols = new std::map<Symbol*, GraphicInformation*>;
-
   /* Symbols:
    *  [ - push current position
    *  ] - pop current position
@@ -33,21 +31,7 @@ GraphicLSystem::GraphicLSystem()
 }
 
 GraphicLSystem::~GraphicLSystem()
-{
-  freeGraphicInformation();
-}
-
-void GraphicLSystem::freeGraphicInformation()
-{
-  for (std::map<Symbol*, GraphicInformation*>::iterator position = graphicInformationForSymbols->begin();
-       position != graphicInformationForSymbols->end();
-       position++)
-  {
-    delete position->second;
-  }
-
-  delete graphicInformationForSymbols;
-}
+{}
 
 void GraphicLSystem::pushCursor()
 {
@@ -63,55 +47,71 @@ void GraphicLSystem::popCursor()
 
 void GraphicLSystem::loadCursorPositionForSymbol(Symbol *symbol)
 {
-  if (graphicInformationForSymbols->find(symbol) == graphicInformationForSymbols->end())
-  {
-    (*graphicInformationForSymbols)[symbol] = new GraphicInformation();
-  }
-
-  cursor = (*graphicInformationForSymbols)[symbol]->cursorAfterInterpretation;
+  cursor = static_cast<GraphicSymbol*>(symbol)->cursorAfterInterpretation;
 }
 
 void GraphicLSystem::saveCursorPositionForSymbol(Symbol *symbol)
 {
-  if (graphicInformationForSymbols->find(symbol) == graphicInformationForSymbols->end())
-  {
-    (*graphicInformationForSymbols)[symbol] = new GraphicInformation();
-  }
+  static_cast<GraphicSymbol*>(symbol)->cursorAfterInterpretation = cursor;
+}
 
-  (*graphicInformationForSymbols)[symbol]->cursorAfterInterpretation = cursor;
+LSystem::Symbol* GraphicLSystem::createSymbol(char character)
+{
+  return new GraphicSymbol(character);
 }
 
 void GraphicLSystem::removeSymbol(SymbolString::iterator position)
 {
-  delete (*graphicInformationForSymbols)[*position];
-  graphicInformationForSymbols->erase(*position);
+  if (readPositionRevision == producedStringRevision() && position == readPosition)
+  /* Symbol being interpreted, continue after it */
+  {
+    readPosition++;
+    interpretedSymbolRemoved = true;
+  }
 
   LSystem::removeSymbol(position);
 }
 
 char GraphicLSystem::readNextSymbol()
 {
+  /* Interpretation works with Symbol objects in producedString */
+  assert(storageMode() == LINKED_SYMBOLS);
+
   if (producedString->empty())
   /* Should not happen */
   {
     return '\0';
   }
 
-  SymbolString::iterator position = producedString->begin();
-  Symbol *currentSymbol;
-  while(position != producedString->end())
+  if (readPositionRevision != producedStringRevision())
+  /* The string was rewritten, unread symbols can be anywhere */
+  {
+    readPosition = producedString->begin();
+    readPositionRevision = producedStringRevision();
+  }
+
+  /* Cursor continues from the last read symbol before
+     the first unread one (if there is any). */
+  SymbolString::iterator position = readPosition;
+  Symbol *lastReadSymbol = 0;
+  if (position != producedString->begin())
+  {
+    SymbolString::iterator previous = position;
+    previous--;
+    lastReadSymbol = *previous;
+  }
+
+  while (position != producedString->end() && (*position)->isMarkedRead())
   /* Seek first unread symbol. */
   {
-    currentSymbol = *position;
-    if (!currentSymbol->isMarkedRead())
-    {
-      break;
-    }
-    else
-    {
-      loadCursorPositionForSymbol(currentSymbol);
-      position++;
-    }
+    lastReadSymbol = *position;
+    position++;
+  }
+  readPosition = position;
+
+  if (lastReadSymbol != 0)
+  {
+    loadCursorPositionForSymbol(lastReadSymbol);
   }
 
   if (position == producedString->end())
@@ -126,20 +126,22 @@ char GraphicLSystem::readNextSymbol()
 
     return '\0';
   }
-  else
+
+  Symbol *currentSymbol = *position;
+  char symbol = currentSymbol->getSymbol();
+
+  currentlyInterpretedSymbol = position;
+  interpretedSymbolRemoved = false;
+  interpretSymbol(symbol);
+
+  if (!interpretedSymbolRemoved)
   {
-//     debug("Interpreting: " << currentSymbol->getSymbol());
-//     debug("  Position before: " << cursor.getPosition().toString());
-//     debug("  Direction before: " << cursor.getDirection().toString());
-    currentlyInterpretedSymbol = position;
-    interpretSymbol(currentSymbol->getSymbol());
     currentSymbol->markAsRead();
-//     debug("  Position after: " << cursor.getPosition().toString());
-//     debug("  Direction after: " << cursor.getDirection().toString());
     saveCursorPositionForSymbol(currentSymbol);
-
-    return currentSymbol->getSymbol();
+    readPosition++;
   }
+
+  return symbol;
 }
 
 void GraphicLSystem::interpretSymbol(char symbol)
@@ -168,77 +170,56 @@ void GraphicLSystem::setInitialDirection(Vector const& direction)
   cursor.setDirection(direction);
 }
 
+/* **************************** */
+/* GraphicSymbol IMPLEMENTATION */
+GraphicLSystem::GraphicSymbol::GraphicSymbol(char character)
+  : Symbol(character), cursorAfterInterpretation()
+{}
+
 /* ********************* */
 /* Cursor IMPLEMENTATION */
 GraphicLSystem::Cursor::Cursor()
-  : position(0), direction(0)
-{
-  position  = new Point(0,0,0);
-  direction = new Vector(0,0,0);
-}
+  : position(0,0,0), direction(0,0,0)
+{}
 
 GraphicLSystem::Cursor::Cursor(Point const& inputPosition, Vector const& inputDirection)
-  : position(0), direction(0)
-{
-  position  = new Point(inputPosition);
-  direction = new Vector(inputDirection);
-}
-
-GraphicLSystem::Cursor::Cursor(Cursor const& source)
-{
-  position  = new Point(0,0,0);
-  direction = new Vector(0,0,0);
-
-  *position  = source.getPosition();
-  *direction = source.getDirection();
-}
-
-
-GraphicLSystem::Cursor& GraphicLSystem::Cursor::operator=(Cursor const& source)
-{
-  *position  = source.getPosition();
-  *direction = source.getDirection();
-
-  return *this;
-}
+  : position(inputPosition), direction(inputDirection)
+{}
 
 GraphicLSystem::Cursor::~Cursor()
-{
-  delete position;
-  delete direction;
-}
+{}
 
 Point GraphicLSystem::Cursor::getPosition() const
 {
-  return *position;
+  return position;
 }
 
 Vector GraphicLSystem::Cursor::getDirection() const
 {
-  return *direction;
+  return direction;
 }
 
 void GraphicLSystem::Cursor::setPosition(Point const& newPosition)
 {
-  *position = newPosition;
+  position = newPosition;
 }
 
 void GraphicLSystem::Cursor::setDirection(Vector const& newDirection)
 {
-  *direction = newDirection;
-  direction->normalize();
+  direction = newDirection;
+  direction.normalize();
 }
 
 void GraphicLSystem::Cursor::move(double distance)
 {
-  direction->normalize();
-  position->setX(position->x() + direction->x()*distance);
-  position->setY(position->y() + direction->y()*distance);
-  position->setZ(position->z() + direction->z()*distance);
+  direction.normalize();
+  position.setX(position.x() + direction.x()*distance);
+  position.setY(position.y() + direction.y()*distance);
+  position.setZ(position.z() + direction.z()*distance);
 }
 
 void GraphicLSystem::Cursor::turn(double angle)
 {
-  direction->rotateAroundZ(angle);
-  direction->normalize();
+  direction.rotateAroundZ(angle);
+  direction.normalize();
 }
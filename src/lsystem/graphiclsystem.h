@@ -25,9 +25,8 @@
 #include <vector>
 
 #include "lsystem.h"
-
-class Point;
-class Vector;
+#include "../geometry/point.h"
+#include "../geometry/vector.h"
 
 class GraphicLSystem : public LSystem
 {
@@ -51,9 +50,15 @@ class GraphicLSystem : public LSystem
     void loadCursorPositionForSymbol(Symbol *symbol);
     void saveCursorPositionForSymbol(Symbol *symbol);
 
-    /** Removes graphic representation for symbol as well. */
+    /**
+     * Keeps the read position valid. Subclasses must remove
+     * symbols only this way during interpretation.
+     */
     virtual void removeSymbol(SymbolString::iterator position);
 
+    /** Creates GraphicSymbols. */
+    virtual Symbol* createSymbol(char character);
+
     /**
      * Represents a drawing cursor in the LSystem
      */
@@ -63,9 +68,6 @@ class GraphicLSystem : public LSystem
         Cursor();
         Cursor(Point const& inputPosition, Vector const& inputDirection);
 
-        Cursor(Cursor const& source);
-        Cursor& operator=(Cursor const& source);
-
         ~Cursor();
 
         Point  getPosition() const;
@@ -77,26 +79,34 @@ class GraphicLSystem : public LSystem
         void move(double distance);
         void turn(double angle);
       private:
-        Point*  position;
-        Vector* direction;
+        Point  position;
+        Vector direction;
     };
 
     /**
-     *  Additional graphic information stored for
-     *  each symbol in SymbolString.
+     *  Symbol extended with the graphic information
+     *  stored for each symbol in SymbolString.
      */
-    class GraphicInformation
+    class GraphicSymbol : public Symbol
     {
       public:
+        GraphicSymbol(char character);
+
         Cursor cursorAfterInterpretation;
     };
 
     Cursor cursor; /**< Drawing cursor */
   private:
-    std::map<Symbol*, GraphicInformation*>* graphicInformationForSymbols;
-    void freeGraphicInformation();
-
     std::vector<Cursor> cursorStack; /**< Stack for pushing cursors */
+
+    /**
+     * Where to look for the next unread symbol. All the symbols
+     * before it are read, so each symbol is visited once per
+     * iteration instead of scanning from the begining each time.
+     */
+    SymbolString::iterator readPosition;
+    unsigned long readPositionRevision; /**< Produced string it belongs to */
+    bool interpretedSymbolRemoved;
 };
 
 #endif
@@ -12,10 +12,27 @@
 #include "lsystem.h"
 #include "../debug.h"
 #include "../random.h"
+#include "../threadpool.h"
+
+#include <climits>
+#include <functional>
+
+namespace
+{
+  size_t chunkBegining(int chunk, int chunks, size_t length)
+  {
+    return length * chunk / chunks;
+  }
+}
+
+const size_t LSystem::MINIMUM_CHUNK_LENGTH = 1 << 16;
 
 /* ************************** */
 /* *** LSystem IMPLEMENTATION */
 LSystem::LSystem()
+  : storage(LINKED_SYMBOLS), rewritingThreads(ThreadPool::hardwareThreads()),
+    rewritingPool(0), generatorEngine(0), useDerivationSeed(false),
+    derivationRandom(libcity::RANDOM_SEED), derivationIteration(0), revision(0)
 {
   initialize();
 }
@@ -24,6 +41,7 @@ LSystem::~LSystem()
 {
 
   freeProducedString();
+  delete rewritingPool;
 }
 
 void LSystem::freeProducedString()
@@ -42,6 +60,16 @@ void LSystem::removeSymbol(SymbolString::iterator symbolPosition)
   delete removedSymbol;
 }
 
+LSystem::Symbol* LSystem::createSymbol(char character)
+{
+  return new Symbol(character);
+}
+
+unsigned long LSystem::producedStringRevision() const
+{
+  return revision;
+}
+
 void LSystem::setAlphabet(std::string const& alphabetCharacters)
 {
   freeProducedString();
@@ -71,19 +99,113 @@ void LSystem::initialize()
   axiom = "";
   rules.clear();
   producedString = new SymbolString;
+  packedString.clear();
+  packedBuffer.clear();
+  revision++;
 }
 
 void LSystem::reset()
 {
   freeProducedString();
   producedString = new SymbolString;
+  packedString.clear();
+  derivationIteration = 0;
+  revision++;
 
   for (std::string::iterator position = axiom.begin();
        position != axiom.end();
        position++)
   {
-    producedString->push_back(new Symbol(*position));
+    if (storage == CONTIGUOUS_SYMBOLS)
+    {
+      PackedSymbol symbol = {*position, 0};
+      packedString.push_back(symbol);
+    }
+    else
+    {
+      producedString->push_back(createSymbol(*position));
+    }
+  }
+}
+
+void LSystem::setStorageMode(StorageMode mode)
+{
+  if (mode == storage)
+  {
+    return;
+  }
+
+  if (mode == CONTIGUOUS_SYMBOLS)
+  {
+    packedString.clear();
+    packedString.reserve(producedString->size());
+    for (SymbolString::const_iterator position = producedString->begin();
+         position != producedString->end();
+         position++)
+    {
+      PackedSymbol symbol = {(*position)->getSymbol(),
+                             (unsigned char)((*position)->isMarkedRead() ? READ_FLAG : 0)};
+      packedString.push_back(symbol);
+    }
+
+    while (!producedString->empty())
+    {
+      removeSymbol(--producedString->end());
+    }
+  }
+  else
+  {
+    for (PackedString::const_iterator position = packedString.begin();
+         position != packedString.end();
+         position++)
+    {
+      Symbol* symbol = createSymbol(position->symbol);
+      if (position->flags & READ_FLAG)
+      {
+        symbol->markAsRead();
+      }
+      producedString->push_back(symbol);
+    }
+
+    /* Release the memory, the buffers might be huge */
+    PackedString().swap(packedString);
+    PackedString().swap(packedBuffer);
+    std::vector<std::string const*>().swap(chosenSuccessors);
   }
+
+  storage = mode;
+  revision++;
+}
+
+LSystem::StorageMode LSystem::storageMode() const
+{
+  return storage;
+}
+
+void LSystem::setRewritingThreads(int threads)
+{
+  rewritingThreads = threads < 1 ? 1 : threads;
+}
+
+void LSystem::setDerivationSeed(unsigned long long seed)
+{
+  useDerivationSeed = true;
+  derivationRandom = CounterRandom(seed);
+}
+
+void LSystem::clearDerivationSeed()
+{
+  useDerivationSeed = false;
+}
+
+void LSystem::setRandomEngine(RandomEngine* engine)
+{
+  generatorEngine = engine;
+}
+
+RandomEngine* LSystem::randomEngine()
+{
+  return generatorEngine;
 }
 
 void LSystem::setAxiom(std::string const& startingSequence)
@@ -144,9 +266,27 @@ void LSystem::addRule(char predecessor, std::string const& successor)
 }
 
 int LSystem::doIteration()
+{
+  int rewritesMade;
+  if (storage == CONTIGUOUS_SYMBOLS)
+  {
+    rewritesMade = doContiguousIteration();
+  }
+  else
+  {
+    rewritesMade = doLinkedIteration();
+  }
+
+  derivationIteration++;
+  revision++;
+  return rewritesMade;
+}
+
+int LSystem::doLinkedIteration()
 {
   SymbolString::iterator position = producedString->begin();
   SymbolString::iterator nextPosition;
+  size_t index = 0;
 
   int rewritesMade = 0;
 
@@ -161,15 +301,169 @@ int LSystem::doIteration()
     if (!isTerminal((*position)->getSymbol()))
     {
       rewritesMade++;
-      rewrite(position);
+      rewrite(position, index);
     }
 
     position = nextPosition;
+    index++;
+  }
+
+  return rewritesMade;
+}
+
+int LSystem::doContiguousIteration()
+{
+  rulesTable.assign(UCHAR_MAX + 1, 0);
+  for (std::map<char, ProductionRule>::const_iterator rule = rules.begin();
+       rule != rules.end();
+       rule++)
+  {
+    rulesTable[(unsigned char)rule->first] = &(rule->second);
+  }
+
+  size_t length = packedString.size();
+  chosenSuccessors.resize(length);
+
+  int rewritesMade = 0;
+  if (!useDerivationSeed)
+  /* The generator has to be called from left to right, so
+     the stochastic rules draw the same numbers as in the
+     linked storage. */
+  {
+    for (size_t position = 0; position < length; position++)
+    {
+      ProductionRule const* rule = rulesTable[(unsigned char)packedString[position].symbol];
+      if (rule != 0)
+      {
+        chosenSuccessors[position] = &(rule->successor(generatorEngine));
+        rewritesMade++;
+      }
+      else
+      {
+        chosenSuccessors[position] = 0;
+      }
+    }
   }
 
+  /* More chunks than threads, the pool balances them */
+  int chunks = 1;
+  if (rewritingThreads > 1 && length >= 2 * MINIMUM_CHUNK_LENGTH)
+  {
+    size_t maximalChunks = length / MINIMUM_CHUNK_LENGTH;
+    chunks = maximalChunks < (size_t)(4 * rewritingThreads) ? maximalChunks : 4 * rewritingThreads;
+
+    if (rewritingPool == 0 || rewritingPool->size() != rewritingThreads)
+    {
+      delete rewritingPool;
+      rewritingPool = new ThreadPool(rewritingThreads);
+    }
+  }
+
+  /* Length of each chunk after rewriting, prefix sum of
+     them is where the chunk starts in the new buffer. */
+  std::vector<size_t> offsets(chunks + 1, 0);
+  std::vector<int> rewrites(chunks, 0);
+  ThreadPool::Task choose = std::bind(&LSystem::chooseSuccessors, this,
+                                      std::placeholders::_1, chunks, &offsets, &rewrites);
+  ThreadPool::Task write = std::bind(&LSystem::writeSuccessors, this,
+                                     std::placeholders::_1, chunks, &offsets);
+  if (chunks > 1)
+  {
+    rewritingPool->run(chunks, choose);
+  }
+  else
+  {
+    choose(0);
+  }
+
+  for (int chunk = 0; chunk < chunks; chunk++)
+  {
+    offsets[chunk + 1] += offsets[chunk];
+    rewritesMade += rewrites[chunk];
+  }
+
+  packedBuffer.resize(offsets[chunks]);
+  if (chunks > 1)
+  {
+    rewritingPool->run(chunks, write);
+  }
+  else
+  {
+    write(0);
+  }
+
+  packedString.swap(packedBuffer);
   return rewritesMade;
 }
 
+std::string const& LSystem::chooseSuccessor(ProductionRule const& rule, size_t index) const
+{
+  if (useDerivationSeed)
+  {
+    return rule.successor(derivationRandom, derivationIteration, index);
+  }
+
+  return rule.successor(generatorEngine);
+}
+
+void LSystem::chooseSuccessors(int chunk, int chunks, std::vector<size_t>* lengths,
+                               std::vector<int>* rewrites)
+{
+  size_t begining = chunkBegining(chunk, chunks, packedString.size()),
+         end      = chunkBegining(chunk + 1, chunks, packedString.size());
+
+  size_t length = 0;
+  for (size_t position = begining; position < end; position++)
+  {
+    if (useDerivationSeed)
+    /* Otherwise they were chosen serially */
+    {
+      ProductionRule const* rule = rulesTable[(unsigned char)packedString[position].symbol];
+      if (rule != 0)
+      {
+        chosenSuccessors[position] = &(chooseSuccessor(*rule, position));
+        (*rewrites)[chunk]++;
+      }
+      else
+      {
+        chosenSuccessors[position] = 0;
+      }
+    }
+
+    std::string const* successor = chosenSuccessors[position];
+    length += successor != 0 ? successor->size() : 1;
+  }
+
+  (*lengths)[chunk + 1] = length;
+}
+
+void LSystem::writeSuccessors(int chunk, int chunks, std::vector<size_t> const* offsets)
+{
+  size_t begining = chunkBegining(chunk, chunks, packedString.size()),
+         end      = chunkBegining(chunk + 1, chunks, packedString.size());
+
+  PackedSymbol* output = packedBuffer.data() + (*offsets)[chunk];
+  for (size_t position = begining; position < end; position++)
+  {
+    std::string const* successor = chosenSuccessors[position];
+    if (successor == 0)
+    /* Terminal symbols are copied with their flags */
+    {
+      *output++ = packedString[position];
+      continue;
+    }
+
+    for (std::string::const_iterator character = successor->begin();
+         character != successor->end();
+         character++)
+    {
+      output->symbol = *character;
+      output->flags  = 0;
+      output++;
+    }
+  }
+}
+
 int LSystem::doIterations(int howManyIterations)
 {
   int rewritesMade = 0;
@@ -181,7 +475,7 @@ int LSystem::doIterations(int howManyIterations)
   return rewritesMade;
 }
 
-void LSystem::rewrite(SymbolString::iterator position)
+void LSystem::rewrite(SymbolString::iterator position, size_t index)
 {
   Symbol predecessor = **position;
   std::string successor;
@@ -189,14 +483,14 @@ void LSystem::rewrite(SymbolString::iterator position)
   if (rules.find(predecessor) != rules.end())
   /* Not a constant symbol */
   {
-    successor = rules[predecessor].successor();
+    successor = chooseSuccessor(rules[predecessor], index);
 
     /* Insert the successor before the character at position */
     for (std::string::iterator character = successor.begin();
          character != successor.end();
          character++)
     {
-      producedString->insert(position, new Symbol(*character));
+      producedString->insert(position, createSymbol(*character));
     }
 
     /* And remove the rewrited character from the string */
@@ -211,6 +505,19 @@ std::string LSystem::getProducedString()
 {
   std::string outputString;
   outputString.clear();
+
+  if (storage == CONTIGUOUS_SYMBOLS)
+  {
+    outputString.reserve(packedString.size());
+    for (PackedString::const_iterator position = packedString.begin();
+         position != packedString.end();
+         position++)
+    {
+      outputString.push_back(position->symbol);
+    }
+    return outputString;
+  }
+
   for (SymbolString::const_iterator position = producedString->begin();
        position != producedString->end();
        position++)
@@ -256,12 +563,24 @@ char LSystem::ProductionRule::predecessor() const
   return leftSide;
 }
 
-std::string LSystem::ProductionRule::successor() const
+std::string const& LSystem::ProductionRule::successor(RandomEngine* engine) const
 {
-  Random generator;
+  Random generator(engine);
   return rightSide[generator.generateInteger(0, rightSide.size() - 1)];
 }
 
+std::string const& LSystem::ProductionRule::successor(CounterRandom const& generator,
+                                                      unsigned long long iteration,
+                                                      unsigned long long index) const
+{
+  if (rightSide.size() == 1)
+  {
+    return rightSide[0];
+  }
+
+  return rightSide[generator.generateInteger(iteration, index, 0, rightSide.size() - 1)];
+}
+
 /* ********************* */
 /* Symbol IMPLEMENTATION */
 LSystem::Symbol::Symbol(char character)
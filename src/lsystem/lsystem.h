@@ -13,6 +13,14 @@
  *
  * Implementation of this L-System is context-free and deterministic.
  * Stochastic behavior can be achieved as well (@see LSystem::ProductionRule).
+ *
+ * The produced string can be stored in two ways (@see LSystem::StorageMode).
+ * The default linked storage keeps every symbol as a separate object,
+ * so the symbols can carry additional data and the string can be
+ * modified during interpretation (GraphicLSystem needs that).
+ * The contiguous storage keeps the string in an array of packed
+ * symbols and each iteration streams it into a second preallocated
+ * buffer. It's meant for long strings that are only rewritten and read.
  */
 
 #ifndef _LSYSTEM_H_
@@ -23,10 +31,22 @@
 #include <list>
 #include <string>
 #include <vector>
+#include <cstddef>
+
+#include "../random.h"
+
+class ThreadPool;
 
 class LSystem
 {
   public:
+    /** How the produced string is stored. */
+    enum StorageMode
+    {
+      LINKED_SYMBOLS,    /**< List of Symbol objects (default). */
+      CONTIGUOUS_SYMBOLS /**< Double-buffered array of packed symbols. */
+    };
+
     LSystem();
     virtual ~LSystem();
 
@@ -64,6 +84,43 @@ class LSystem
 
     std::string getProducedString(); /**< Returns the whole produced string */
 
+    /**
+     * Switch storage of the produced string. The current
+     * string is converted (including the read marks).
+     * \WARNING: Subclasses that access producedString
+     *   directly (GraphicLSystem) work only with LINKED_SYMBOLS.
+     */
+    void setStorageMode(StorageMode mode);
+    StorageMode storageMode() const;
+
+    /**
+     * Number of threads used by the contiguous rewriting.
+     * The result doesn't depend on this setting.
+     */
+    void setRewritingThreads(int threads);
+
+    /**
+     * Draw stochastic successors from a counter-based stream
+     * keyed by (iteration, symbol index) instead of the shared
+     * Random generator. The derivation is then reproducible for
+     * the seed alone and the contiguous rewriting doesn't need
+     * the serial pass that chooses successors.
+     * The iteration counter restarts with the axiom.
+     */
+    void setDerivationSeed(unsigned long long seed);
+
+    /** Go back to the shared Random generator (default). */
+    void clearDerivationSeed();
+
+    /**
+     * Draw random numbers (successors without a derivation
+     * seed, subclass parameters) from the engine instead of
+     * the shared Random seed. The engine isn't owned by the
+     * LSystem and 0 goes back to the shared seed.
+     */
+    void setRandomEngine(RandomEngine* engine);
+    RandomEngine* randomEngine();
+
   protected:
     /** Internal representation of production rule of a LSystem.
         With one successor it's a deterministic rule,
@@ -76,7 +133,10 @@ class LSystem
         ProductionRule(char leftSide, std::string const& rightSide);
 
         char predecessor() const;
-        std::string successor() const;
+        std::string const& successor(RandomEngine* engine) const;
+        std::string const& successor(CounterRandom const& generator,
+                                     unsigned long long iteration,
+                                     unsigned long long index) const;
         void addSuccessor(std::string const& rightSideString);
 
       private:
@@ -128,8 +188,9 @@ class LSystem
 
     /** 
      * Attempts to rewrite character specified by
-     * the position iterator. */
-    void rewrite(SymbolString::iterator position);
+     * the position iterator. Index is the position of the
+     * symbol in the string before the current iteration. */
+    void rewrite(SymbolString::iterator position, size_t index);
 
     /**
      * Character must be in alphabet.
@@ -138,7 +199,60 @@ class LSystem
 
     virtual void removeSymbol(SymbolString::iterator symbolPosition);
 
+    /** Allocates symbols of the linked storage, override to extend them. */
+    virtual Symbol* createSymbol(char character);
+
+    /**
+     * Changes whenever the produced string is rewritten
+     * or replaced, so the iterators into it might be invalid.
+     */
+    unsigned long producedStringRevision() const;
+
   private:
+    /** Symbol of the contiguous storage. */
+    struct PackedSymbol
+    {
+      char symbol;
+      unsigned char flags;
+    };
+
+    enum PackedSymbolFlags
+    {
+      READ_FLAG = 1
+    };
+
+    typedef std::vector<PackedSymbol> PackedString;
+
+    /** Smallest part of the string worth a separate thread. */
+    static const size_t MINIMUM_CHUNK_LENGTH;
+
+    StorageMode storage;
+    int rewritingThreads;
+    ThreadPool* rewritingPool; /**< Created when it's needed */
+    RandomEngine* generatorEngine;
+
+    bool useDerivationSeed;
+    CounterRandom derivationRandom;
+    unsigned long long derivationIteration; /**< Iterations since reset() */
+    unsigned long revision;
+
+    PackedString packedString; /**< Produced string in contiguous mode */
+    PackedString packedBuffer; /**< Target of the next iteration */
+    std::vector<std::string const*> chosenSuccessors; /**< Per symbol, 0 for terminals */
+    std::vector<ProductionRule const*> rulesTable; /**< Rules indexed by the predecessor */
+
+    int doLinkedIteration();
+    int doContiguousIteration();
+
+    std::string const& chooseSuccessor(ProductionRule const& rule, size_t index) const;
+
+    /** @{ */
+    /** Parts of the contiguous iteration run for each chunk of the string. */
+    void chooseSuccessors(int chunk, int chunks, std::vector<size_t>* lengths,
+                          std::vector<int>* rewrites);
+    void writeSuccessors(int chunk, int chunks, std::vector<size_t> const* offsets);
+    /** @} */
+
     bool isInAlphabet(char checkedCharacter) const; /**< Check if character is in this LSystem's alphabet */
     bool isInAlphabet(std::string const& checkedString) const; /**< Checks the whole string */
 
@@ -23,6 +23,8 @@
 
 #include "../debug.h"
 
+#include <vector>
+
 const double RoadLSystem::MINIMAL_ROAD_LENGTH = 100;
 
 RoadLSystem::RoadLSystem()
@@ -47,7 +49,9 @@ RoadLSystem::RoadLSystem()
 }
 
 RoadLSystem::~RoadLSystem()
-{}
+{
+  freeAreaConstraints();
+}
 
 void RoadLSystem::interpretSymbol(char symbol)
 {
@@ -143,7 +147,7 @@ void RoadLSystem::cancelBranch()
   {
     removed = position;
     position++;
-    producedString->erase(removed);
+    removeSymbol(removed);
   }
 }
 
@@ -159,8 +163,15 @@ bool RoadLSystem::localConstraints(Path* proposedPath)
 
   Point intersection;
   double distance;
-  for (std::list<Road*>::iterator currentRoad = targetStreetGraph->begin();
-        currentRoad != targetStreetGraph->end();
+
+  /* Only roads within snapDistance from the path can
+     cross it, snap it or be too close to it. */
+  std::vector<Road*> nearbyRoads;
+  targetStreetGraph->getRoadsInRadius(proposedPath->begining(),
+                                      proposedPath->length() + snapDistance,
+                                      &nearbyRoads);
+  for (std::vector<Road*>::iterator currentRoad = nearbyRoads.begin();
+        currentRoad != nearbyRoads.end();
         currentRoad++)
   {
     // Check for intersection
@@ -263,8 +274,12 @@ bool RoadLSystem::localConstraints(Path* proposedPath)
     return false;
   }
 
-  for (std::list<Road*>::iterator currentRoad = targetStreetGraph->begin();
-        currentRoad != targetStreetGraph->end();
+  /* The end might have been snapped further away. */
+  targetStreetGraph->getRoadsInRadius(proposedPath->begining(),
+                                      proposedPath->length(),
+                                      &nearbyRoads);
+  for (std::vector<Road*>::iterator currentRoad = nearbyRoads.begin();
+        currentRoad != nearbyRoads.end();
         currentRoad++)
   {
     // Check for intersection
@@ -363,7 +378,9 @@ bool RoadLSystem::checkSnapPossibility(Path* proposedPath, Intersection* interse
   double distance = Vector(proposedPath->end(), intersection->position()).length();
   if (distance < snapDistance)
   {
-    if (targetStreetGraph->getIntersectionAtPosition(intersection->position())->numberOfWays() < 4)
+    /* Intersections of the graph are unique at their positions,
+       so there's no need to look it up again. */
+    if (intersection->numberOfWays() < 4)
     {
       /* Snap to intersection -- we need to check for
       intersections with adjacent roads of the intersection
@@ -372,10 +389,10 @@ bool RoadLSystem::checkSnapPossibility(Path* proposedPath, Intersection* interse
       Path snappedPath(*proposedPath);
       snappedPath.setEnd(intersection->position());
 
-      std::list<Road*> intersectionRoads = intersection->getRoads();
+      Intersection::RoadRange intersectionRoads = intersection->roadRange();
       LineSegment::Intersection intersectionResult;
       Point intersection;
-      for (std::list<Road*>::iterator adjacentRoad = intersectionRoads.begin();
+      for (Intersection::RoadRange::iterator adjacentRoad = intersectionRoads.begin();
            adjacentRoad != intersectionRoads.end();
            adjacentRoad++)
       {
@@ -486,13 +503,13 @@ void RoadLSystem::setTurnAngle(double min, double max)
 
 double RoadLSystem::getRoadSegmentLength()
 {
-  Random random;
+  Random random(randomEngine());
   return random.generateDouble(minRoadLength, maxRoadLength);
 }
 
 double RoadLSystem::getTurnAngle()
 {
-  Random random;
+  Random random(randomEngine());
   return random.generateDouble(minTurnAngle, maxTurnAngle);
 }
 
@@ -24,17 +24,23 @@ void Random::setSeed(int newSeed)
 }
 
 Random::Random()
-  : useOwnSeed(false), configuration(NONE)
+  : useOwnSeed(false), engine(0), configuration(NONE)
 {
   state = seed;
 }
 
 Random::Random(double ownSeed)
-  : useOwnSeed(true), configuration(NONE)
+  : useOwnSeed(true), engine(0), configuration(NONE)
 {
   state = ownSeed;
 }
 
+Random::Random(RandomEngine* randomEngine)
+  : useOwnSeed(false), engine(randomEngine), configuration(NONE)
+{
+  state = seed;
+}
+
 Random::~Random()
 {}
 
@@ -71,6 +77,11 @@ bool Random::generateBool(double chance)
 
 double Random::base()
 {
+  if (engine != 0)
+  {
+    return engine->nextDouble();
+  }
+
   state = 1103515245*state + 12345;
 
   if (!useOwnSeed)
@@ -129,3 +140,121 @@ Random Random::boolValue(double chance)
 
   return generator;
 }
+
+
+namespace
+{
+  /** SplitMix64 finalizer, a bijective 64-bit mixing function. */
+  unsigned long long mix(unsigned long long value)
+  {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  }
+}
+
+/* RandomEngine */
+
+namespace
+{
+  unsigned long long rotateLeft(unsigned long long value, int bits)
+  {
+    return (value << bits) | (value >> (64 - bits));
+  }
+
+  const unsigned long long JUMP[] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                     0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+}
+
+RandomEngine::RandomEngine(unsigned long long seed)
+{
+  /* SplitMix64 sequence, never gives the all-zero state */
+  for (int word = 0; word < 4; word++)
+  {
+    state[word] = mix(seed + word * 0x9e3779b97f4a7c15ULL);
+  }
+}
+
+unsigned long long RandomEngine::next()
+{
+  unsigned long long result = rotateLeft(state[1] * 5, 7) * 9,
+                     shifted = state[1] << 17;
+
+  state[2] ^= state[0];
+  state[3] ^= state[1];
+  state[1] ^= state[2];
+  state[0] ^= state[3];
+  state[2] ^= shifted;
+  state[3] = rotateLeft(state[3], 45);
+
+  return result;
+}
+
+double RandomEngine::nextDouble()
+{
+  return (next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void RandomEngine::jump()
+{
+  unsigned long long jumped[4] = {0, 0, 0, 0};
+  for (int word = 0; word < 4; word++)
+  {
+    for (int bit = 0; bit < 64; bit++)
+    {
+      if (JUMP[word] & (1ULL << bit))
+      {
+        for (int i = 0; i < 4; i++)
+        {
+          jumped[i] ^= state[i];
+        }
+      }
+      next();
+    }
+  }
+
+  for (int i = 0; i < 4; i++)
+  {
+    state[i] = jumped[i];
+  }
+}
+
+RandomEngine RandomEngine::split()
+{
+  RandomEngine child(*this);
+  jump();
+  return child;
+}
+
+/* CounterRandom */
+
+CounterRandom::CounterRandom(unsigned long long seed)
+  : key(mix(seed))
+{}
+
+unsigned long long CounterRandom::generate(unsigned long long first, unsigned long long second) const
+{
+  return mix(mix(key ^ first) + second);
+}
+
+double CounterRandom::generateDouble(unsigned long long first, unsigned long long second,
+                                     double lower, double higher) const
+{
+  /* Upper 53 bits fill the mantissa of [0, 1) */
+  double base = (generate(first, second) >> 11) * (1.0 / 9007199254740992.0);
+  return base * (higher - lower) + lower;
+}
+
+int CounterRandom::generateInteger(unsigned long long first, unsigned long long second,
+                                   int lower, int higher) const
+{
+  if (lower > higher)
+  {
+    int temporary = lower;
+    lower  = higher;
+    higher = temporary;
+  }
+
+  return lower + (int)generateDouble(first, second, 0, higher + 1.0 - lower);
+}
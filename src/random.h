@@ -7,6 +7,16 @@
  *
  * @brief Random number generator class.
  *
+ * Default constructed Random objects share a single static
+ * seed, so they draw one global sequence of numbers. That
+ * is simple, but not safe to use from more threads and any
+ * draw shifts all the following ones.
+ *
+ * RandomEngine is an independent generator that can be
+ * split into child engines. Objects that were given an engine
+ * (City, Area and LSystem) draw from it instead of the shared
+ * sequence, so their output depends only on the master seed
+ * and can be generated in parallel.
  */
 
 #ifndef _RANDOM_H_
@@ -17,6 +27,8 @@ namespace libcity
   const unsigned int RANDOM_SEED = 5;
 }
 
+class RandomEngine;
+
 class Random
 {
   private:
@@ -32,6 +44,9 @@ class Random
 
     Random();
     Random(double ownSeed);
+
+    /** Draw from the engine, or from the shared seed if it's 0. */
+    Random(RandomEngine* engine);
     ~Random();
 
     double generateDouble(double lower, double higher);
@@ -45,6 +60,7 @@ class Random
 
     bool   useOwnSeed;
     unsigned int state;
+    RandomEngine* engine;
 
     /* For value objects */
     enum values
@@ -60,4 +76,53 @@ class Random
     double probability;
 };
 
+/**
+ * Independent generator (xoshiro256**). Engines are cheap
+ * value objects, each one has to be used by one thread only.
+ */
+class RandomEngine
+{
+  public:
+    RandomEngine(unsigned long long seed = libcity::RANDOM_SEED);
+
+    unsigned long long next();
+    double nextDouble(); /**< Uniform in [0, 1) */
+
+    /** Advance by 2^128 numbers. */
+    void jump();
+
+    /**
+      Child engine for a subtask. The child continues with the
+      current sequence and this engine jumps ahead, so the two
+      never overlap. Splitting in the same order always gives
+      the same children.
+     */
+    RandomEngine split();
+
+  private:
+    unsigned long long state[4];
+};
+
+/**
+ * Counter-based generator. Each value is a pure function
+ * of the seed and a two-part counter (e.g. iteration and
+ * index of the item), so values can be drawn in any order
+ * and from any number of threads with the same result.
+ */
+class CounterRandom
+{
+  public:
+    CounterRandom(unsigned long long seed);
+
+    unsigned long long generate(unsigned long long first, unsigned long long second) const;
+
+    double generateDouble(unsigned long long first, unsigned long long second,
+                          double lower, double higher) const;
+    int generateInteger(unsigned long long first, unsigned long long second,
+                        int lower, int higher) const;
+
+  private:
+    unsigned long long key;
+};
+
 #endif
\ No newline at end of file
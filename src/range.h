@@ -0,0 +1,62 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file range.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Pair of iterators over a container owned by someone else.
+ *
+ * Accessors returning a Range let the caller go through the
+ * roads, intersections, blocks or lots without copying them:
+ *
+ *   for (Road* road : graph.roadRange()) ...
+ *
+ * The range is valid only until the owner is modified. Use the
+ * copying accessors (getRoads() etc.) when the owner is going
+ * to change during the iteration.
+ */
+
+#ifndef _RANGE_H_
+#define _RANGE_H_
+
+#include <iterator>
+
+template <typename Iterator>
+class Range
+{
+  public:
+    typedef Iterator iterator;
+    typedef Iterator const_iterator;
+
+    Range(Iterator first, Iterator last)
+      : first(first), last(last)
+    {}
+
+    Iterator begin() const
+    {
+      return first;
+    }
+
+    Iterator end() const
+    {
+      return last;
+    }
+
+    bool empty() const
+    {
+      return first == last;
+    }
+
+    /** Linear for lists. */
+    int size() const
+    {
+      return std::distance(first, last);
+    }
+
+  private:
+    Iterator first;
+    Iterator last;
+};
+
+#endif
@@ -11,6 +11,7 @@
 
 #include "areaextractor.h"
 #include "intersection.h"
+#include "planarfaces.h"
 #include "../area/zone.h"
 #include "../area/block.h"
 #include "../streetgraph/streetgraph.h"
@@ -19,9 +20,63 @@
 #include "../geometry/line.h"
 #include "../geometry/polygon.h"
 #include "../geometry/vector.h"
+#include "../geometry/predicates.h"
 #include "../debug.h"
 
 #include <cmath>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+  /** Compares vertices by x coordinate, then by y. */
+  struct LeftLower
+  {
+    LeftLower(std::vector<Point> const& vertexPositions)
+      : positions(vertexPositions)
+    {}
+
+    bool operator()(int first, int second) const
+    {
+      if (positions[first].x() != positions[second].x())
+      {
+        return positions[first].x() < positions[second].x();
+      }
+      return positions[first].y() < positions[second].y();
+    }
+
+    std::vector<Point> const& positions;
+  };
+
+  /**
+    Rotate a loop to start at its lower left vertex, where the minimal
+    cycle basis starts its cycles. The road widths are then subtracted
+    in the same order and both algorithms give the very same areas.
+   */
+  void startAtLowerLeft(std::vector<int>* loop, std::vector<Point> const& positions)
+  {
+    std::rotate(loop->begin(),
+                std::min_element(loop->begin(), loop->end(), LeftLower(positions)),
+                loop->end());
+  }
+
+  /** Position of a vertex. */
+  struct VertexPosition
+  {
+    VertexPosition(std::vector<Point> const& vertexPositions)
+      : positions(vertexPositions)
+    {}
+
+    Point const& operator()(int vertex) const
+    {
+      return positions[vertex];
+    }
+
+    std::vector<Point> const& positions;
+  };
+}
+
+const AreaExtractor::Vertex AreaExtractor::NO_VERTEX = -1;
 
 AreaExtractor::AreaExtractor()
 {
@@ -30,19 +85,24 @@ AreaExtractor::AreaExtractor()
 
 void AreaExtractor::initialize()
 {
-  vertices = new std::list<Intersection*>;
-  adjacentNodes = new std::map< Intersection*, std::vector<Intersection*> >;
-  cycleEdges = new std::set< std::pair<Intersection*, Intersection*> >;
   cycles = new std::list<Polygon>;
+  extractionAlgorithm = MINIMAL_CYCLE_BASIS;
 
   reset();
 }
 
 void AreaExtractor::reset()
 {
-  vertices->clear();
-  adjacentNodes->clear();
-  cycleEdges->clear();
+  intersections.clear();
+  positions.clear();
+  vertices.clear();
+  firstVertex = 0;
+  removedVertices.clear();
+  adjacencyOffsets.clear();
+  adjacencySizes.clear();
+  adjacency.clear();
+  visitedInCycle.clear();
+  cycleSearch = 0;
   cycles->clear();
   substractRoadWidthFromAreas = false;
 }
@@ -54,9 +114,6 @@ AreaExtractor::~AreaExtractor()
 
 void AreaExtractor::freeMemory()
 {
-  delete vertices;
-  delete adjacentNodes;
-  delete cycleEdges;
   delete cycles;
 }
 
@@ -64,20 +121,38 @@ AreaExtractor::AreaExtractor(AreaExtractor const& source)
 {
   initialize();
 
-  *vertices      = *(source.vertices);
-  *adjacentNodes = *(source.adjacentNodes);
-  *cycleEdges    = *(source.cycleEdges);
-  *cycles        = *(source.cycles);
+  intersections    = source.intersections;
+  positions        = source.positions;
+  vertices         = source.vertices;
+  firstVertex      = source.firstVertex;
+  removedVertices  = source.removedVertices;
+  adjacencyOffsets = source.adjacencyOffsets;
+  adjacencySizes   = source.adjacencySizes;
+  adjacency        = source.adjacency;
+  visitedInCycle   = source.visitedInCycle;
+  cycleSearch      = source.cycleSearch;
+  *cycles          = *(source.cycles);
+
+  extractionAlgorithm = source.extractionAlgorithm;
 }
 
 AreaExtractor& AreaExtractor::operator=(AreaExtractor const& source)
 {
   reset();
 
-  *vertices      = *(source.vertices);
-  *adjacentNodes = *(source.adjacentNodes);
-  *cycleEdges    = *(source.cycleEdges);
-  *cycles        = *(source.cycles);
+  intersections    = source.intersections;
+  positions        = source.positions;
+  vertices         = source.vertices;
+  firstVertex      = source.firstVertex;
+  removedVertices  = source.removedVertices;
+  adjacencyOffsets = source.adjacencyOffsets;
+  adjacencySizes   = source.adjacencySizes;
+  adjacency        = source.adjacency;
+  visitedInCycle   = source.visitedInCycle;
+  cycleSearch      = source.cycleSearch;
+  *cycles          = *(source.cycles);
+
+  extractionAlgorithm = source.extractionAlgorithm;
 
   return *this;
 }
@@ -86,16 +161,80 @@ void AreaExtractor::copyVertices(StreetGraph* map, Zone* zone)
 {
   reset();
 
+  /* Number the nodes. */
+  std::unordered_map<Intersection*, Vertex> vertexIds;
+  StreetGraph::IntersectionRange inputIntersections = map->intersectionRange();
+  std::vector<Intersection*> candidates(inputIntersections.begin(), inputIntersections.end());
+  std::vector<bool> isInside;
+  if (zone != 0)
+  {
+    zone->areIntersectionsInside(candidates, &isInside);
+  }
+
+  for (unsigned int candidate = 0; candidate < candidates.size(); candidate++)
+  {
+    Intersection* node = candidates[candidate];
+    if (zone != 0 && !isInside[candidate])
+    {
+      continue;
+    }
+
+    vertexIds[node] = intersections.size();
+    intersections.push_back(node);
+    positions.push_back(node->position());
+  }
+
   /* Add all nodes into adjacency list. */
-  StreetGraph::Intersections inputIntersections = map->getIntersections();
-  for (std::list<Intersection*>::iterator insertedIntersectionIterator = inputIntersections.begin();
-       insertedIntersectionIterator != inputIntersections.end();
-       insertedIntersectionIterator++)
+  int numberOfVertices = intersections.size();
+  adjacencyOffsets.reserve(numberOfVertices);
+  adjacencySizes.reserve(numberOfVertices);
+  for (Vertex node = 0; node < numberOfVertices; node++)
   {
-    addVertex(*insertedIntersectionIterator, zone);
+    adjacencyOffsets.push_back(adjacency.size());
+
+    Intersection::RoadRange roads = intersections[node]->roadRange();
+    for (Intersection::RoadRange::iterator road = roads.begin();
+         road != roads.end();
+         road++)
+    {
+      Intersection* adjacent = (*road)->begining() != intersections[node] ? (*road)->begining() : (*road)->end();
+      std::unordered_map<Intersection*, Vertex>::iterator adjacentId = vertexIds.find(adjacent);
+      if (adjacentId == vertexIds.end())
+      /* Nodes outside of the zone are left out. */
+      {
+        continue;
+      }
+
+      /* Roads of the types missing in the map are 0 wide. */
+      std::map<Road::Type, double>::iterator width = roadWidths.find((*road)->type());
+
+      Adjacency entry;
+      entry.node = adjacentId->second;
+      entry.roadWidth = width != roadWidths.end() ? width->second : 0;
+      entry.cycleEdge = false;
+      adjacency.push_back(entry);
+    }
+
+    adjacencySizes.push_back(adjacency.size() - adjacencyOffsets.back());
   }
+  removedVertices.assign(numberOfVertices, false);
+  visitedInCycle.assign(numberOfVertices, 0);
+
+  sortVertices();
 }
 
+void AreaExtractor::sortVertices()
+{
+  vertices.resize(intersections.size());
+  for (Vertex node = 0; node < static_cast<Vertex>(vertices.size()); node++)
+  {
+    vertices[node] = node;
+  }
+  /* The extraction always starts at the leftmost vertex and
+     takes the lowest one of those sharing its x coordinate,
+     otherwise the clockwise-most walk doesn't follow a face. */
+  std::stable_sort(vertices.begin(), vertices.end(), LeftLower(positions));
+}
 
 void AreaExtractor::setRoadWidth(Road::Type type, double width)
 {
@@ -107,6 +246,16 @@ void AreaExtractor::setRoadWidths(std::map<Road::Type, double> widths)
   roadWidths = widths;
 }
 
+void AreaExtractor::setAlgorithm(Algorithm algorithm)
+{
+  extractionAlgorithm = algorithm;
+}
+
+AreaExtractor::Algorithm AreaExtractor::algorithm() const
+{
+  return extractionAlgorithm;
+}
+
 std::list<Zone*> AreaExtractor::extractZones(StreetGraph* fromMap, Zone* zoneConstraints)
 {
   reset();
@@ -150,21 +299,26 @@ std::list<Block*> AreaExtractor::extractBlocks(StreetGraph* fromMap, Zone* zoneC
   return blocks;
 }
 
-std::vector<double> AreaExtractor::getSubstractDistances(std::vector<Intersection*> intersections)
+std::vector<double> AreaExtractor::getSubstractDistances(std::vector<Vertex> const& sequence)
 {
-  /* Get width of all edges */
+  /* Get width of all edges. The roads were looked up when
+     the graph was copied, so the map isn't searched again. */
   std::vector<double> edgeWidth;
-  int current, next;
-  Road* road;
-  for (unsigned int i = 0; i < intersections.size(); i++)
+  edgeWidth.reserve(sequence.size());
+  for (unsigned int i = 0; i < sequence.size(); i++)
   {
-    current = i;
-    next = (i+1) % intersections.size();
+    Vertex current = sequence[i],
+           next    = sequence[(i + 1) % sequence.size()];
 
-    road  = map->getRoadBetweenIntersections(intersections[current], intersections[next]);
-    assert(roadWidths.find(road->type()) != roadWidths.end());
+    int edge = adjacencyOffsets[current],
+        end  = adjacencyOffsets[current] + adjacencySizes[current];
+    while (edge < end && adjacency[edge].node != next)
+    {
+      edge++;
+    }
+    assert(edge < end);
 
-    edgeWidth.push_back(roadWidths[road->type()]);
+    edgeWidth.push_back(adjacency[edge].roadWidth);
   }
 
   return edgeWidth;
@@ -248,45 +402,48 @@ void AreaExtractor::substractRoadWidths(Polygon* minimalCycle, std::vector<doubl
 
 void AreaExtractor::getMinimalCycles()
 {
-  std::vector<Intersection*> adjacentNodes;
-  Intersection* current;
-  Intersection* next;
+  if (extractionAlgorithm == HALF_EDGE_FACES)
+  {
+    getFaces();
+    return;
+  }
+
+  Vertex current;
+  Vertex next;
 
   while (!empty())
   {
     current = first();
 
-    adjacentNodes = adjacent(current);
-
-    if (adjacentNodes.size() == 0)
+    if (numberOfAdjacentNodes(current) == 0)
     /* Isolated, no cycle possible. */
     {
       debug("AreaExtractor::getMinimalCycles(): Extracting isolated vertex.");
       extractIsolatedVertex(current);
     }
-    else if (adjacentNodes.size() == 1)
+    else if (numberOfAdjacentNodes(current) == 1)
     /* Remove filaments */
     {
       debug("AreaExtractor::getMinimalCycles(): Extracting filament.");
-      next = adjacentNodes[0];
+      next = firstAdjacentNode(current);
       extractFilament(current, next);
     }
     else
     /* Extract cycles. */
     {
       debug("AreaExtractor::getMinimalCycles(): Extracting minimal cycle.");
-      next = adjacentNodes[0];
+      next = firstAdjacentNode(current);
       extractMinimalCycle(current, next);
     }
   }
 }
 
-void AreaExtractor::extractIsolatedVertex(Intersection* vertex)
+void AreaExtractor::extractIsolatedVertex(Vertex vertex)
 {
   removeVertex(vertex);
 }
 
-void AreaExtractor::extractFilament(Intersection* v0, Intersection* v1)
+void AreaExtractor::extractFilament(Vertex v0, Vertex v1)
 {
   if (isCycleEdge(v0,v1))
   {
@@ -347,76 +504,59 @@ void AreaExtractor::extractFilament(Intersection* v0, Intersection* v1)
   }
 }
 
-void AreaExtractor::extractMinimalCycle(Intersection* current, Intersection* next)
+void AreaExtractor::extractMinimalCycle(Vertex current, Vertex next)
 {
-  std::set<Intersection*> visited;
-  std::list<Intersection*> sequence;
+  std::vector<Vertex> sequence;
+  cycleSearch++;
 
   sequence.push_back(current);
-  next = getClockwiseMost(0, current);
-
-  Intersection* previousVertex = current;
-  Intersection* currentVertex  = next;
-  Intersection* nextVertex  = 0;
-  while ((currentVertex != 0) &&
-         (currentVertex != current) &&
-         (visited.find(currentVertex) == visited.end()))
-  {
-    debug("AreaExtractor::extractMinimalCycle(): Next point in sequence is " << currentVertex->position().toString());
-    sequence.push_back(currentVertex);
-    visited.insert(currentVertex);
+  next = getClockwiseMost(NO_VERTEX, current);
+
+  Vertex previousVertex = current;
+  Vertex currentVertex  = next;
+  Vertex nextVertex  = NO_VERTEX;
+  while ((currentVertex != NO_VERTEX) &&
+         (currentVertex != current))
+  {
+    debug("AreaExtractor::extractMinimalCycle(): Next point in sequence is " << positions[currentVertex].toString());
+    if (visitedInCycle[currentVertex] == cycleSearch)
+    /* The walk went around a cycle touching it in a single
+       vertex (or back along a filament). The cycle is found
+       later on its own, here it's cut off the sequence. */
+    {
+      while (sequence.back() != currentVertex)
+      {
+        visitedInCycle[sequence.back()] = 0;
+        sequence.pop_back();
+      }
+    }
+    else
+    {
+      sequence.push_back(currentVertex);
+      visitedInCycle[currentVertex] = cycleSearch;
+    }
     nextVertex = getCounterclockwiseMost(previousVertex, currentVertex);
     previousVertex = currentVertex;
     currentVertex = nextVertex;
   }
 
-  if (currentVertex == 0)
+  if (currentVertex == NO_VERTEX)
   {
     // Filament found, not necessarily rooted at v0.
     extractFilament(previousVertex,firstAdjacentNode(previousVertex));
   }
-  else if (currentVertex == current)
+  else if (sequence.size() >= 3)
   {
     // Minimal cycle found.
-    Polygon minimalCycle;
-    std::vector<Intersection*> correspondingIntersections;
-
-    for (std::list<Intersection*>::iterator nodeInCycle = sequence.begin();
-          nodeInCycle != sequence.end();
-          nodeInCycle++)
+    for (unsigned int nodeInCycle = 0; nodeInCycle < sequence.size(); nodeInCycle++)
     {
-      minimalCycle.addVertex((*nodeInCycle)->position());
-      correspondingIntersections.push_back(*nodeInCycle);
-
-      std::list<Intersection*>::iterator nextNodeInCycle = nodeInCycle;
-      nextNodeInCycle++;
-      if (nextNodeInCycle == sequence.end())
       /* So we can mark the last edge */
-      {
-        nextNodeInCycle = sequence.begin();
-      }
-      markCycleEdge(*nodeInCycle, *nextNodeInCycle);
+      unsigned int nextNodeInCycle = (nodeInCycle + 1) % sequence.size();
+      markCycleEdge(sequence[nodeInCycle], sequence[nextNodeInCycle]);
     }
 
     debug("AreaExtractor::extractMinimalCycle(): Storing minimal cycle.");
-    if (substractRoadWidthFromAreas)
-    {
-      std::vector<double> distances = getSubstractDistances(correspondingIntersections);
-      Polygon boundaries(minimalCycle);
-      minimalizeCycle(&minimalCycle, &distances);
-      substractRoadWidths(&minimalCycle, distances);
-
-      // Discard wrong blocks
-      if (minimalCycle.isSubAreaOf(boundaries))
-      {
-        cycles->push_back(minimalCycle);
-      }
-        //cycles->push_back(minimalCycle);
-    }
-    else
-    {
-      cycles->push_back(minimalCycle);
-    }
+    storeCycle(sequence);
 
     removeEdge(current, next);
 
@@ -431,133 +571,216 @@ void AreaExtractor::extractMinimalCycle(Intersection* current, Intersection* nex
       extractFilament(next,firstAdjacentNode(next));
     }
   }
-  else   // vcurr was visited earlier
+  else   // the walk came back to v0 the way it left
   {
-    // A cycle has been found, but is not guaranteed to be a minimal
-    // cycle. This implies v0 is part of a filament. Locate the
+    // Everything found on the way were cycles hanging on a path
+    // from v0. This implies v0 is part of a filament. Locate the
     // starting point for the filament by traversing from v0 away
     // from the initial v1.
     while (numberOfAdjacentNodes(current) == 2)
     {
-      std::vector<Intersection*> adjacentNodes = adjacent(current);
-      if (adjacentNodes.front() != next)
+      Vertex front = adjacentNode(current, 0),
+             back  = adjacentNode(current, 1);
+      if (front != next)
       {
           next = current;
-          current = adjacentNodes.front();
+          current = front;
       }
       else
       {
           next = current;
-          current = adjacentNodes.back();
+          current = back;
       }
     }
     extractFilament(current,next);
   }
 }
 
-Intersection* AreaExtractor::getClockwiseMost(Intersection *previous, Intersection* current)
+void AreaExtractor::storeCycle(std::vector<Vertex> const& sequence)
 {
-  std::vector<Intersection*> adjacentNodes = adjacent(current);
-
-  Vector vCurrent = previous != 0 ? Vector(current->position(), previous->position()) : Vector(0, -1);
-  Vector vNext;
-  Intersection* next = 0;
-  double vCurrentIsConvex = false;
+  Polygon minimalCycle;
+  for (unsigned int nodeInCycle = 0; nodeInCycle < sequence.size(); nodeInCycle++)
+  {
+    minimalCycle.addVertex(positions[sequence[nodeInCycle]]);
+  }
 
-  Intersection* adjacent = 0;
-  Vector vAdjacent(0,0,0);
-  for (std::vector<Intersection*>::iterator adjacentNode = adjacentNodes.begin();
-       adjacentNode != adjacentNodes.end();
-       adjacentNode++)
+  if (substractRoadWidthFromAreas)
   {
-    adjacent = *adjacentNode;
+    std::vector<double> distances = getSubstractDistances(sequence);
+    Polygon boundaries(minimalCycle);
+    minimalizeCycle(&minimalCycle, &distances);
+    substractRoadWidths(&minimalCycle, distances);
 
-    if (adjacent == previous)
+    // Discard wrong blocks
+    if (minimalCycle.isSubAreaOf(boundaries))
     {
-      continue;
+      cycles->push_back(minimalCycle);
     }
+      //cycles->push_back(minimalCycle);
+  }
+  else
+  {
+    cycles->push_back(minimalCycle);
+  }
+}
 
-    vAdjacent.set(adjacent->position(), current->position());
-
-    if (!next)
+void AreaExtractor::getFaces()
+{
+  /* Half-edges leaving vertex v are the entries of its adjacency
+     range, sort them counterclockwise by the position of their node. */
+  struct AdjacentPosition
+  {
+    std::vector<Point> const* positions;
+    Point const& operator()(Adjacency const& entry) const
     {
-        next = adjacent;
-        vNext = vAdjacent;
-        vCurrentIsConvex = (vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON);
-        continue;
+      return (*positions)[entry.node];
     }
+  } adjacentPosition = {&positions};
 
-    if (vCurrentIsConvex)
+  std::vector<Adjacency> sorted;
+  for (Vertex node = 0; node < static_cast<Vertex>(intersections.size()); node++)
+  {
+    sorted.assign(adjacency.begin() + adjacencyOffsets[node],
+                  adjacency.begin() + adjacencyOffsets[node] + numberOfAdjacentNodes(node));
+    PlanarFaces::sortCounterclockwise(positions[node], &sorted, adjacentPosition);
+    std::copy(sorted.begin(), sorted.end(), adjacency.begin() + adjacencyOffsets[node]);
+  }
+
+  /* Opposite half-edge of each half-edge. */
+  std::vector<int> twins(adjacency.size(), -1);
+  for (Vertex node = 0; node < static_cast<Vertex>(intersections.size()); node++)
+  {
+    for (int i = 0; i < numberOfAdjacentNodes(node); i++)
     {
-      if (vCurrent.perpDotProduct(vAdjacent) < 0 || vNext.perpDotProduct(vAdjacent) < 0)
+      Vertex adjacent = adjacentNode(node, i);
+      for (int j = 0; j < numberOfAdjacentNodes(adjacent); j++)
       {
-          next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
+        int twin = adjacencyOffsets[adjacent] + j;
+        if (adjacency[twin].node == node && twins[twin] == -1 &&
+            twin != adjacencyOffsets[node] + i)
+        {
+          twins[adjacencyOffsets[node] + i] = twin;
+          twins[twin] = adjacencyOffsets[node] + i;
+          break;
+        }
       }
     }
-    else
+  }
+
+  /* The face continues by the half-edge next clockwise from the twin,
+     so bounded faces are walked counterclockwise. */
+  std::vector<Vertex> origins(adjacency.size());
+  for (Vertex node = 0; node < static_cast<Vertex>(intersections.size()); node++)
+  {
+    for (int i = 0; i < numberOfAdjacentNodes(node); i++)
     {
-      if (vCurrent.perpDotProduct(vAdjacent) < 0 && vNext.perpDotProduct(vAdjacent) < 0)
+      origins[adjacencyOffsets[node] + i] = node;
+    }
+  }
+
+  std::vector<bool> walked(adjacency.size(), false);
+  std::vector<int> positionInLoop(intersections.size(), -1);
+  std::vector<Vertex> loop, cycle;
+  for (int first = 0; first < static_cast<int>(adjacency.size()); first++)
+  {
+    if (walked[first])
+    {
+      continue;
+    }
+
+    /* Filaments and pinched parts make the walk visit some vertex
+       twice, the walk is split there into simple loops. Bounded
+       faces are the loops going counterclockwise, the outer face
+       and filaments (loops of zero area) are left out. */
+    loop.clear();
+    int halfEdge = first;
+    bool closed = true;
+    while (!walked[halfEdge])
+    {
+      walked[halfEdge] = true;
+
+      Vertex origin = origins[halfEdge];
+      if (positionInLoop[origin] != -1)
       {
-          next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
+        int begining = positionInLoop[origin];
+        cycle.assign(loop.begin() + begining, loop.end());
+        for (unsigned int i = begining; i < loop.size(); i++)
+        {
+          positionInLoop[loop[i]] = -1;
+        }
+        loop.resize(begining);
+
+        if (PlanarFaces::isCounterclockwise(cycle, VertexPosition(positions)))
+        {
+          startAtLowerLeft(&cycle, positions);
+          storeCycle(cycle);
+        }
       }
+      positionInLoop[origin] = loop.size();
+      loop.push_back(origin);
+
+      if (twins[halfEdge] == -1)
+      /* Adjacency is not symmetric, can't continue. */
+      {
+        closed = false;
+        break;
+      }
+      Vertex end = adjacency[halfEdge].node;
+      int twinIndex = twins[halfEdge] - adjacencyOffsets[end];
+      halfEdge = adjacencyOffsets[end] +
+                 (twinIndex + numberOfAdjacentNodes(end) - 1) % numberOfAdjacentNodes(end);
     }
-  }
 
-  return next;
+    for (unsigned int i = 0; i < loop.size(); i++)
+    {
+      positionInLoop[loop[i]] = -1;
+    }
+    if (closed && PlanarFaces::isCounterclockwise(loop, VertexPosition(positions)))
+    {
+      startAtLowerLeft(&loop, positions);
+      storeCycle(loop);
+    }
+  }
 }
 
-Intersection* AreaExtractor::getCounterclockwiseMost(Intersection *previous, Intersection* current)
+AreaExtractor::Vertex AreaExtractor::getClockwiseMost(Vertex previous, Vertex current)
 {
-  std::vector<Intersection*> adjacentNodes = adjacent(current);
-
-  Vector vCurrent = previous ? Vector(current->position(), previous->position()) : Vector(0, -1);
-  Vector vNext;
-  Intersection* next = 0;
-  double vCurrentIsConvex = false;
+  Vertex next = NO_VERTEX;
+  bool currentIsConvex = false;
 
-  Intersection* adjacent = 0;
-  Vector vAdjacent(0,0,0);
-  for (std::vector<Intersection*>::iterator adjacentNode = adjacentNodes.begin();
-       adjacentNode != adjacentNodes.end();
-       adjacentNode++)
+  Vertex adjacent = NO_VERTEX;
+  for (int adjacentIndex = 0; adjacentIndex < numberOfAdjacentNodes(current); adjacentIndex++)
   {
-    adjacent = *adjacentNode;
+    adjacent = adjacentNode(current, adjacentIndex);
 
     if (adjacent == previous)
     {
       continue;
     }
 
-    vAdjacent.set(adjacent->position(), current->position());
-
-    if (!next)
+    if (next == NO_VERTEX)
     {
         next = adjacent;
-        vNext = vAdjacent;
-        vCurrentIsConvex = (vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON);
+        currentIsConvex = turn(previous, current, next) > 0;
         continue;
     }
 
-    if (vCurrentIsConvex)
+    int adjacentTurn = turn(previous, current, adjacent),
+        adjacentSide = Predicates::orientation(positions[current], positions[next], positions[adjacent]);
+    if (currentIsConvex)
     {
-      if (vCurrent.perpDotProduct(vAdjacent) > 0 && vNext.perpDotProduct(vAdjacent) > 0)
+      if (adjacentTurn < 0 || adjacentSide < 0)
       {
           next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
+          currentIsConvex = turn(previous, current, next) > 0;
       }
     }
     else
     {
-      if (vCurrent.perpDotProduct(vAdjacent) > 0 || vNext.perpDotProduct(vAdjacent) > 0)
+      if (adjacentTurn < 0 && adjacentSide < 0)
       {
           next = adjacent;
-          vNext = vAdjacent;
-          vCurrentIsConvex = vNext.perpDotProduct(vCurrent) <= -libcity::EPSILON;
+          currentIsConvex = turn(previous, current, next) > 0;
       }
     }
   }
@@ -565,194 +788,195 @@ Intersection* AreaExtractor::getCounterclockwiseMost(Intersection *previous, Int
   return next;
 }
 
-int AreaExtractor::numberOfAdjacentNodes(Intersection* node)
-{
-  return (*adjacentNodes)[node].size();
-}
-
-void AreaExtractor::addVertex(Intersection* node, Zone* zone)
+AreaExtractor::Vertex AreaExtractor::getCounterclockwiseMost(Vertex previous, Vertex current)
 {
-  std::vector<Intersection*> adjacent = node->adjacentIntersections();
+  Vertex next = NO_VERTEX;
+  bool currentIsConvex = false;
 
-  if (zone != 0)
+  Vertex adjacent = NO_VERTEX;
+  for (int adjacentIndex = 0; adjacentIndex < numberOfAdjacentNodes(current); adjacentIndex++)
   {
-    if (!zone->isIntersectionInside(node))
-    {
-      return;
-    }
+    adjacent = adjacentNode(current, adjacentIndex);
 
-    std::vector<Intersection*> adjacentNodesInZone;
-    for (unsigned int i = 0; i < adjacent.size(); i++)
+    if (adjacent == previous)
     {
-      if (zone->isIntersectionInside(adjacent[i]))
-      {
-        adjacentNodesInZone.push_back(adjacent[i]);
-      }
+      continue;
     }
-    adjacent.clear();
-    adjacent.assign(adjacentNodesInZone.begin(), adjacentNodesInZone.end());
-  }
-
 
-  /* Insert adjacent intersections. */
-  adjacentNodes->insert(std::pair< Intersection*, std::vector<Intersection*> >(node, adjacent));
-
-  std::list<Intersection*>::iterator sequenceIterator;
-  Intersection* existing;
-
-  /* Determine where to sort current node. */
-  for (sequenceIterator  = vertices->begin();
-       sequenceIterator != vertices->end();
-       sequenceIterator++)
-  {
-    existing = *sequenceIterator;
-
-    if (node->position().x() < existing->position().x())
-    /* X coordinate of newly added intersection is smaller. Insert it before. */
+    if (next == NO_VERTEX)
     {
-      break;
+        next = adjacent;
+        currentIsConvex = turn(previous, current, next) > 0;
+        continue;
     }
-    else if (node->position().x() == existing->position().x())
-    /* X coordinates are the same. Y will be used to decide. */
+
+    int adjacentTurn = turn(previous, current, adjacent),
+        adjacentSide = Predicates::orientation(positions[current], positions[next], positions[adjacent]);
+    if (currentIsConvex)
     {
-      if (node->position().y() < existing->position().y())
-      /* Y of newly added intersection is smaller. Insert it before. */
-      {
-        break;
-      }
-      else
-      /* Y are greater or equal */
+      if (adjacentTurn > 0 && adjacentSide > 0)
       {
-        sequenceIterator++;
-        break;
+          next = adjacent;
+          currentIsConvex = turn(previous, current, next) > 0;
       }
     }
     else
-    /* Ckeck further points. */
     {
-      continue;
+      if (adjacentTurn > 0 || adjacentSide > 0)
+      {
+          next = adjacent;
+          currentIsConvex = turn(previous, current, next) > 0;
+      }
     }
   }
 
-  /* Insert into list. */
-  vertices->insert(sequenceIterator, node);
+  return next;
 }
 
-void AreaExtractor::removeVertex(Intersection* node)
+int AreaExtractor::turn(Vertex previous, Vertex current, Vertex next)
 {
-  vertices->remove(node);
-
-  for(std::vector<Intersection*>::iterator adjacentNode = (*adjacentNodes)[node].begin();
-      adjacentNode != (*adjacentNodes)[node].end();
-      adjacentNode++)
+  if (previous == NO_VERTEX)
   {
-    removeEdge(node, *adjacentNode);
+    double difference = positions[current].x() - positions[next].x();
+    return (difference > 0) - (difference < 0);
   }
+  return Predicates::orientation(positions[previous], positions[current], positions[next]);
+}
 
-  adjacentNodes->erase(node);
+int AreaExtractor::numberOfAdjacentNodes(Vertex node)
+{
+  return adjacencySizes[node];
 }
 
-void AreaExtractor::removeEdge(Intersection* begining, Intersection* end)
+void AreaExtractor::removeVertex(Vertex node)
 {
-  /* Remove second point from adjacency list of first point. */
-  for (std::vector<Intersection*>::iterator adjacentNode = (*adjacentNodes)[begining].begin();
-       adjacentNode != (*adjacentNodes)[begining].end();
-       adjacentNode++)
+  removedVertices[node] = true;
+
+  while (numberOfAdjacentNodes(node) > 0)
+  {
+    removeEdge(node, firstAdjacentNode(node));
+  }
+}
+
+void AreaExtractor::eraseAdjacentNode(Vertex node, Vertex adjacent)
+{
+  int begining = adjacencyOffsets[node],
+      end      = begining + adjacencySizes[node];
+  for (int i = begining; i < end; i++)
   {
-    if (*adjacentNode == end)
+    if (adjacency[i].node == adjacent)
     {
-      (*adjacentNodes)[begining].erase(adjacentNode);
+      for (int following = i + 1; following < end; following++)
+      {
+        adjacency[following - 1] = adjacency[following];
+      }
+      adjacencySizes[node]--;
       break;
     }
   }
+}
+
+void AreaExtractor::removeEdge(Vertex begining, Vertex end)
+{
+  /* Remove second point from adjacency list of first point. */
+  eraseAdjacentNode(begining, end);
 
   /* And vice versa. */
-  for (std::vector<Intersection*>::iterator adjacentNode = (*adjacentNodes)[end].begin();
-       adjacentNode != (*adjacentNodes)[end].end();
-       adjacentNode++)
+  eraseAdjacentNode(end, begining);
+
+  /* If edge was marked as cycle edge, remove the mark as well. */
+  for (int i = 0; i < numberOfAdjacentNodes(begining); i++)
   {
-    if (*adjacentNode == begining)
+    if (adjacentNode(begining, i) == end)
     {
-      (*adjacentNodes)[end].erase(adjacentNode);
-      break;
+      adjacency[adjacencyOffsets[begining] + i].cycleEdge = false;
+    }
+  }
+  for (int i = 0; i < numberOfAdjacentNodes(end); i++)
+  {
+    if (adjacentNode(end, i) == begining)
+    {
+      adjacency[adjacencyOffsets[end] + i].cycleEdge = false;
     }
   }
-
-  /* If edge was marked as cycle edge, remove the mark as well. */
-  cycleEdges->erase(std::make_pair(begining, end));
-  cycleEdges->erase(std::make_pair(end, begining));
 }
 
-Intersection* AreaExtractor::first()
+AreaExtractor::Vertex AreaExtractor::first()
 {
-  return vertices->front();
+  /* empty() skips the removed vertices. */
+  if (empty())
+  {
+    return NO_VERTEX;
+  }
+
+  return vertices[firstVertex];
 }
 
-std::vector<Intersection*> AreaExtractor::adjacent(Intersection* node)
+bool AreaExtractor::empty()
 {
-  if (adjacentNodes->find(node) == adjacentNodes->end())
+  while (firstVertex < vertices.size() && removedVertices[vertices[firstVertex]])
   {
-    std::vector<Intersection*> empty;
-    // FIXME exception not in graph
-    return empty;
+    firstVertex++;
   }
 
-  return (*adjacentNodes)[node];
+  return firstVertex == vertices.size();
 }
 
-bool AreaExtractor::empty()
+AreaExtractor::Vertex AreaExtractor::adjacentNode(Vertex node, int index)
 {
-  return vertices->empty();
+  assert(index >= 0 && index < numberOfAdjacentNodes(node));
+
+  return adjacency[adjacencyOffsets[node] + index].node;
 }
 
-Intersection* AreaExtractor::firstAdjacentNode(Intersection* node)
+AreaExtractor::Vertex AreaExtractor::firstAdjacentNode(Vertex node)
 {
   // FIXME throw exception when empty
   assert(numberOfAdjacentNodes(node) > 0);
 
-  return adjacent(node).front();
+  return adjacentNode(node, 0);
 }
 
-bool AreaExtractor::isCycleEdge(Intersection* begining, Intersection* end)
+bool AreaExtractor::isCycleEdge(Vertex begining, Vertex end)
 {
-  return cycleEdges->find(std::make_pair(begining, end)) != cycleEdges->end() ||
-         cycleEdges->find(std::make_pair(end, begining)) != cycleEdges->end();
-}
+  for (int i = 0; i < numberOfAdjacentNodes(begining); i++)
+  {
+    if (adjacentNode(begining, i) == end && adjacency[adjacencyOffsets[begining] + i].cycleEdge)
+    {
+      return true;
+    }
+  }
+  for (int i = 0; i < numberOfAdjacentNodes(end); i++)
+  {
+    if (adjacentNode(end, i) == begining && adjacency[adjacencyOffsets[end] + i].cycleEdge)
+    {
+      return true;
+    }
+  }
 
-void AreaExtractor::markCycleEdge(Intersection* begining, Intersection* end)
-{
-  cycleEdges->insert(std::make_pair(begining, end));
+  return false;
 }
 
-void AreaExtractor::dumpAdjacencyLists()
+void AreaExtractor::markCycleEdge(Vertex begining, Vertex end)
 {
-  for (std::map< Intersection*, std::vector<Intersection*> >::iterator nodeIterator = adjacentNodes->begin();
-       nodeIterator != adjacentNodes->end();
-       nodeIterator++)
+  for (int i = 0; i < numberOfAdjacentNodes(begining); i++)
   {
-    debug((*nodeIterator).first->position().toString() << " Has this adjacent nodes :");
-    for (std::vector<Intersection*>::iterator adjacentNodeIterator = (*nodeIterator).second.begin();
-         adjacentNodeIterator != (*nodeIterator).second.end();
-         adjacentNodeIterator++)
+    if (adjacentNode(begining, i) == end)
     {
-      debug("  " << (*adjacentNodeIterator)->position().toString());
+      adjacency[adjacencyOffsets[begining] + i].cycleEdge = true;
+      break;
     }
   }
 }
 
-void AreaExtractor::dumpAdjacenciesFromVertices()
+void AreaExtractor::dumpAdjacencyLists()
 {
-  for (std::list<Intersection*>::iterator nodeIterator = vertices->begin();
-       nodeIterator != vertices->end();
-       nodeIterator++)
+  for (Vertex node = 0; node < static_cast<Vertex>(intersections.size()); node++)
   {
-    debug((*nodeIterator)->position().toString() << " Has this adjacent nodes :");
-    std::vector<Intersection*> adjacent = (*nodeIterator)->adjacentIntersections();
-    for (std::vector<Intersection*>::iterator adjacentNodeIterator = adjacent.begin();
-         adjacentNodeIterator != adjacent.end();
-         adjacentNodeIterator++)
+    debug(positions[node].toString() << " Has this adjacent nodes :");
+    for (int i = 0; i < numberOfAdjacentNodes(node); i++)
     {
-      debug("  " << (*adjacentNodeIterator)->position().toString());
+      debug("  " << positions[adjacentNode(node, i)].toString());
     }
   }
-}
\ No newline at end of file
+}
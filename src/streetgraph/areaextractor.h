@@ -13,18 +13,29 @@
  * finds all minimal cycles in the graph using
  * David Eberly's algorithm for planar graphs.
  *
+ * The snapshot numbers the intersections densely and keeps
+ * the vertices in an array sorted once by x and y coordinate and
+ * the adjacency lists in a single flat array, so the whole
+ * extraction runs in O(n log n) for graphs of bounded degree.
+ *
+ * Alternatively, the areas can be found by walking the faces of
+ * the (planar) graph in a half-edge structure, see setAlgorithm().
+ *
  * @todo Might use some refactoring to make the class
  * more generic. Now it works with Intersection as a
  * node, which makes it unusable outside of a StreetGraph.
  * It could for example work with points as nodes.
  */
 
+#ifndef _AREAEXTRACTOR_H_
+#define _AREAEXTRACTOR_H_
+
 #include <list>
-#include <set>
 #include <map>
 #include <vector>
 
 #include "road.h"
+#include "../geometry/point.h"
 
 class Intersection;
 class Polygon;
@@ -35,6 +46,13 @@ class StreetGraph;
 class AreaExtractor
 {
   public:
+    /** How the closed areas are found. */
+    enum Algorithm
+    {
+      MINIMAL_CYCLE_BASIS, /**< Eberly's algorithm, peels filaments and cycles one by one. */
+      HALF_EDGE_FACES      /**< Single walk over faces of the planar graph. */
+    };
+
     /**
      * Creates a snapshot ofstreet graph from list of intersections.
      * Copying is neccessary, because the algorithm modifies
@@ -47,69 +65,127 @@ class AreaExtractor
     AreaExtractor(AreaExtractor const& source);
     AreaExtractor& operator=(AreaExtractor const& source);
 
+    /** Roads of the types without a width are 0 wide. */
     void setRoadWidth(Road::Type type, double width);
     void setRoadWidths(std::map<Road::Type, double> widths);
 
+    /**
+      Select the algorithm, MINIMAL_CYCLE_BASIS is the default.
+     @remarks
+       Both find the same areas (the outer face and filaments
+       are left out), each one starting at its lower left
+       vertex, but not necessarily in the same order.
+     */
+    void setAlgorithm(Algorithm algorithm);
+    Algorithm algorithm() const;
+
     std::list<Zone*> extractZones(StreetGraph* fromMap, Zone* zoneConstraints = 0);
     std::list<Block*> extractBlocks(StreetGraph* fromMap, Zone* zoneConstraints = 0);
 
   private:
-    Intersection* first(); /**< Get first node in sequence. */
+    /** Dense index of a vertex in the snapshot. */
+    typedef int Vertex;
+    static const Vertex NO_VERTEX;
+
+    /** Edge of the snapshot leading from a vertex to its neighbour. */
+    struct Adjacency
+    {
+      Vertex node;
+      double roadWidth; /**< Zero if the type isn't in roadWidths. */
+      bool   cycleEdge; /**< Marked as a part of a cycle. */
+    };
+
+    Vertex first(); /**< Get first node in sequence. */
     bool empty(); /**< Is graph empty? */
 
     /**
      * Find all minimal cycles and return them as polygons.
      */
     void getMinimalCycles();
+
+    /**
+     * Walk all faces of the graph and store the bounded ones.
+     */
+    void getFaces();
+    void storeCycle(std::vector<Vertex> const& sequence);
     
     void minimalizeCycle(Polygon* minimalCycle, std::vector<double>* distances);
-    std::vector<double> getSubstractDistances(std::vector<Intersection*> intersections);
+    std::vector<double> getSubstractDistances(std::vector<Vertex> const& sequence);
     void substractRoadWidths(Polygon* minimalCycle, std::vector<double> const& distances);
 
     void copyVertices(StreetGraph* map, Zone* zone = 0);
-    void addVertex(Intersection* node, Zone* zone = 0);
-    void removeVertex(Intersection* node);
+    void sortVertices();
+    void removeVertex(Vertex node);
 
     /* Adding edges not neccessary */
-    void removeEdge(Intersection* begining, Intersection* end);
+    void removeEdge(Vertex begining, Vertex end);
+    void eraseAdjacentNode(Vertex node, Vertex adjacent);
 
-    bool isCycleEdge(Intersection* begining, Intersection* end);
-    void markCycleEdge(Intersection* begining, Intersection* end);
+    bool isCycleEdge(Vertex begining, Vertex end);
+    void markCycleEdge(Vertex begining, Vertex end);
 
     /* Extracting methods. */
-    void extractIsolatedVertex(Intersection* vertex);
-    void extractFilament(Intersection* current, Intersection* next);
-    void extractMinimalCycle(Intersection* current, Intersection* next);
+    void extractIsolatedVertex(Vertex vertex);
+    void extractFilament(Vertex current, Vertex next);
+    void extractMinimalCycle(Vertex current, Vertex next);
+
+    Vertex getClockwiseMost(Vertex previous, Vertex current);
+    Vertex getCounterclockwiseMost(Vertex previous, Vertex current);
 
-    Intersection* getClockwiseMost(Intersection* previous, Intersection* current);
-    Intersection* getCounterclockwiseMost(Intersection* previous, Intersection* current);
+    /**
+      Exact orientation of the walk previous -> current -> next.
+      Without a previous vertex the walk comes from above.
+     @return 1 for a left turn, -1 for a right turn, 0 if straight.
+     */
+    int turn(Vertex previous, Vertex current, Vertex next);
 
     /* Adjacent nodes access methods. */
-    int numberOfAdjacentNodes(Intersection* node);
-    std::vector<Intersection*> adjacent(Intersection* node);
-    Intersection* firstAdjacentNode(Intersection* node);
+    int numberOfAdjacentNodes(Vertex node);
+    Vertex adjacentNode(Vertex node, int index);
+    Vertex firstAdjacentNode(Vertex node);
 
     void initialize();
     void reset();
     void freeMemory();
 
     void dumpAdjacencyLists();
-    void dumpAdjacenciesFromVertices();
 
   private:
-    /** Stores all vertices of the graph sorted by their x position. */
-    std::list<Intersection*>* vertices;
-
-    /** Graph description. List of adjacent nodes to each node. */
-    std::map< Intersection*, std::vector<Intersection*> >* adjacentNodes;
+    /** @{ */
+    /** Vertices of the snapshot, indexed by Vertex. */
+    std::vector<Intersection*> intersections;
+    std::vector<Point> positions;
+    /** @} */
+
+    /** Stores all vertices of the graph sorted by their x, then y position. */
+    std::vector<Vertex> vertices;
+    /** Vertices before this index in #vertices are removed. */
+    unsigned int firstVertex;
+    std::vector<bool> removedVertices;
+
+    /** @{ */
+    /**
+     * Graph description. Adjacent nodes of node v are stored
+     * at [adjacencyOffsets[v], adjacencyOffsets[v] + adjacencySizes[v]).
+     * Removed edges are erased by shifting the rest of the range,
+     * so the order of the adjacent nodes is kept.
+     */
+    std::vector<int> adjacencyOffsets;
+    std::vector<int> adjacencySizes;
+    std::vector<Adjacency> adjacency;
+    /** @} */
 
-    /** Edges marked as a part of a cycle. */
-    std::set< std::pair<Intersection*, Intersection*> > *cycleEdges;
+    /** Vertices visited by the current extractMinimalCycle() call. */
+    std::vector<unsigned int> visitedInCycle;
+    unsigned int cycleSearch;
 
     std::map<Road::Type, double> roadWidths;
     bool substractRoadWidthFromAreas;
+    Algorithm extractionAlgorithm;
 
     StreetGraph* map;
 
     std::list<Polygon>* cycles;
-};
\ No newline at end of file
+};
+
+#endif
@@ -0,0 +1,231 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/compactstreetgraph.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see compactstreetgraph.h
+ *
+ */
+
+#include "compactstreetgraph.h"
+#include "streetgraph.h"
+#include "intersection.h"
+#include "road.h"
+#include "../debug.h"
+
+#include <cmath>
+
+const CompactStreetGraph::Handle CompactStreetGraph::INVALID_HANDLE = -1;
+
+/* IntersectionView */
+
+CompactStreetGraph::IntersectionView::IntersectionView(CompactStreetGraph const* graph, Handle intersection)
+  : owner(graph), id(intersection)
+{}
+
+CompactStreetGraph::Handle CompactStreetGraph::IntersectionView::handle() const
+{
+  return id;
+}
+
+Point CompactStreetGraph::IntersectionView::position() const
+{
+  return Point(owner->x(id), owner->y(id));
+}
+
+int CompactStreetGraph::IntersectionView::numberOfWays() const
+{
+  return owner->lastWay(id) - owner->firstWay(id);
+}
+
+CompactStreetGraph::RoadView CompactStreetGraph::IntersectionView::road(int way) const
+{
+  assert(way >= 0 && way < numberOfWays());
+  return RoadView(owner, owner->wayRoad(owner->firstWay(id) + way));
+}
+
+CompactStreetGraph::IntersectionView CompactStreetGraph::IntersectionView::adjacentIntersection(int way) const
+{
+  assert(way >= 0 && way < numberOfWays());
+  return IntersectionView(owner, owner->wayTarget(owner->firstWay(id) + way));
+}
+
+Intersection* CompactStreetGraph::IntersectionView::original() const
+{
+  return owner->originalIntersections[id];
+}
+
+/* RoadView */
+
+CompactStreetGraph::RoadView::RoadView(CompactStreetGraph const* graph, Handle road)
+  : owner(graph), id(road)
+{}
+
+CompactStreetGraph::Handle CompactStreetGraph::RoadView::handle() const
+{
+  return id;
+}
+
+CompactStreetGraph::IntersectionView CompactStreetGraph::RoadView::begining() const
+{
+  return IntersectionView(owner, owner->roadBegining(id));
+}
+
+CompactStreetGraph::IntersectionView CompactStreetGraph::RoadView::end() const
+{
+  return IntersectionView(owner, owner->roadEnd(id));
+}
+
+Road::Type CompactStreetGraph::RoadView::type() const
+{
+  return owner->roadsTypes[id];
+}
+
+double CompactStreetGraph::RoadView::length() const
+{
+  Handle from = owner->roadBegining(id),
+         to   = owner->roadEnd(id);
+  double deltaX = owner->x(to) - owner->x(from),
+         deltaY = owner->y(to) - owner->y(from);
+  return std::sqrt(deltaX*deltaX + deltaY*deltaY);
+}
+
+Road* CompactStreetGraph::RoadView::original() const
+{
+  return owner->originalRoads[id];
+}
+
+/* CompactStreetGraph */
+
+CompactStreetGraph::CompactStreetGraph()
+{}
+
+CompactStreetGraph::CompactStreetGraph(StreetGraph* graph)
+{
+  build(graph);
+}
+
+CompactStreetGraph::~CompactStreetGraph()
+{}
+
+void CompactStreetGraph::build(StreetGraph* graph)
+{
+  clear();
+
+  StreetGraph::IntersectionRange intersections = graph->intersectionRange();
+  int inputIntersections = graph->numberOfIntersections();
+  positionX.reserve(inputIntersections);
+  positionY.reserve(inputIntersections);
+  originalIntersections.reserve(inputIntersections);
+  for (StreetGraph::IntersectionRange::iterator intersection = intersections.begin();
+       intersection != intersections.end();
+       intersection++)
+  {
+    Point position = (*intersection)->position();
+    intersectionHandles[*intersection] = originalIntersections.size();
+    originalIntersections.push_back(*intersection);
+    positionX.push_back(position.x());
+    positionY.push_back(position.y());
+  }
+
+  int numberOfRoads = graph->numberOfRoads();
+  roadsBeginings.reserve(numberOfRoads);
+  roadsEnds.reserve(numberOfRoads);
+  roadsTypes.reserve(numberOfRoads);
+  originalRoads.reserve(numberOfRoads);
+  for (StreetGraph::iterator road = graph->begin();
+       road != graph->end();
+       road++)
+  {
+    roadHandles[*road] = originalRoads.size();
+    originalRoads.push_back(*road);
+    roadsBeginings.push_back(handleOf((*road)->begining()));
+    roadsEnds.push_back(handleOf((*road)->end()));
+    roadsTypes.push_back((*road)->type());
+  }
+
+  /* Ways keep the order of Intersection::getRoads(). */
+  wayOffsets.reserve(originalIntersections.size() + 1);
+  waysRoads.reserve(2 * originalRoads.size());
+  waysTargets.reserve(2 * originalRoads.size());
+  wayOffsets.push_back(0);
+  for (Handle intersection = 0; intersection < numberOfIntersections(); intersection++)
+  {
+    Intersection::RoadRange ways = originalIntersections[intersection]->roadRange();
+    for (Intersection::RoadRange::iterator way = ways.begin();
+         way != ways.end();
+         way++)
+    {
+      Handle road = handleOf(*way);
+      waysRoads.push_back(road);
+      waysTargets.push_back(roadsBeginings[road] == intersection ? roadsEnds[road] : roadsBeginings[road]);
+    }
+    wayOffsets.push_back(waysRoads.size());
+  }
+}
+
+void CompactStreetGraph::clear()
+{
+  positionX.clear();
+  positionY.clear();
+  wayOffsets.clear();
+  waysRoads.clear();
+  waysTargets.clear();
+
+  roadsBeginings.clear();
+  roadsEnds.clear();
+  roadsTypes.clear();
+
+  originalIntersections.clear();
+  originalRoads.clear();
+  intersectionHandles.clear();
+  roadHandles.clear();
+}
+
+int CompactStreetGraph::numberOfIntersections() const
+{
+  return positionX.size();
+}
+
+int CompactStreetGraph::numberOfRoads() const
+{
+  return roadsTypes.size();
+}
+
+CompactStreetGraph::IntersectionView CompactStreetGraph::intersection(Handle intersection) const
+{
+  assert(intersection >= 0 && intersection < numberOfIntersections());
+  return IntersectionView(this, intersection);
+}
+
+CompactStreetGraph::RoadView CompactStreetGraph::road(Handle road) const
+{
+  assert(road >= 0 && road < numberOfRoads());
+  return RoadView(this, road);
+}
+
+CompactStreetGraph::Handle CompactStreetGraph::handleOf(Intersection* intersection) const
+{
+  std::unordered_map<Intersection*, Handle>::const_iterator found = intersectionHandles.find(intersection);
+  return found == intersectionHandles.end() ? INVALID_HANDLE : found->second;
+}
+
+CompactStreetGraph::Handle CompactStreetGraph::handleOf(Road* road) const
+{
+  std::unordered_map<Road*, Handle>::const_iterator found = roadHandles.find(road);
+  return found == roadHandles.end() ? INVALID_HANDLE : found->second;
+}
+
+size_t CompactStreetGraph::memoryUsage() const
+{
+  return positionX.capacity()   * sizeof(double) +
+         positionY.capacity()   * sizeof(double) +
+         wayOffsets.capacity()  * sizeof(Handle) +
+         waysRoads.capacity()   * sizeof(Handle) +
+         waysTargets.capacity() * sizeof(Handle) +
+         roadsBeginings.capacity() * sizeof(Handle) +
+         roadsEnds.capacity()      * sizeof(Handle) +
+         roadsTypes.capacity()     * sizeof(Road::Type);
+}
@@ -0,0 +1,198 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/compactstreetgraph.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Contiguous read-only storage of a StreetGraph
+ *
+ * StreetGraph keeps every road and intersection as a separate
+ * heap object and the traversals have to chase pointers all
+ * over the memory. CompactStreetGraph is a snapshot of the
+ * graph stored in flat arrays:
+ *
+ *  - intersections and roads are identified by integer handles
+ *    (indices in the order of StreetGraph iteration),
+ *  - positions and road endpoints are stored as separate arrays
+ *    (struct of arrays),
+ *  - adjacency is stored in compressed sparse row format, i.e. ways
+ *    of intersection i are at [offset(i), offset(i + 1)).
+ *
+ * The snapshot is not updated when the original graph changes,
+ * build() it again after modifications. Handles are only valid
+ * for the snapshot they come from: build() numbers everything
+ * again, so keep pointers to the originals across rebuilds and
+ * translate them with handleOf().
+ *
+ * Only x and y coordinates are stored. Positions of the views
+ * have z = 0 and lengths are measured in the XY plane.
+ *
+ * IntersectionView and RoadView provide the familiar
+ * Intersection and Road interface on top of the arrays.
+ *
+ */
+
+#ifndef _COMPACTSTREETGRAPH_H_
+#define _COMPACTSTREETGRAPH_H_
+
+#include <vector>
+#include <cstddef>
+#include <unordered_map>
+
+#include "road.h"
+#include "../geometry/point.h"
+
+class StreetGraph;
+class Intersection;
+
+class CompactStreetGraph
+{
+  public:
+    typedef int Handle;
+    static const Handle INVALID_HANDLE;
+
+    class RoadView;
+
+    /** Intersection interface over the compact storage. */
+    class IntersectionView
+    {
+      public:
+        IntersectionView(CompactStreetGraph const* graph, Handle intersection);
+
+        Handle handle() const;
+        Point position() const; /**< The z coordinate is always 0. */
+        int numberOfWays() const;
+
+        RoadView road(int way) const;
+        IntersectionView adjacentIntersection(int way) const;
+
+        Intersection* original() const;
+
+      private:
+        CompactStreetGraph const* owner;
+        Handle id;
+    };
+
+    /** Road interface over the compact storage. */
+    class RoadView
+    {
+      public:
+        RoadView(CompactStreetGraph const* graph, Handle road);
+
+        Handle handle() const;
+        IntersectionView begining() const;
+        IntersectionView end() const;
+        Road::Type type() const;
+        double length() const; /**< Straight distance of the ends in XY. */
+
+        Road* original() const;
+
+      private:
+        CompactStreetGraph const* owner;
+        Handle id;
+    };
+
+    CompactStreetGraph();
+    CompactStreetGraph(StreetGraph* graph);
+    ~CompactStreetGraph();
+
+    /**
+      Take a new snapshot of the graph.
+     @remarks
+       Invalidates all handles and views of the previous snapshot.
+     */
+    void build(StreetGraph* graph);
+    void clear();
+
+    int numberOfIntersections() const;
+    int numberOfRoads() const;
+
+    IntersectionView intersection(Handle intersection) const;
+    RoadView road(Handle road) const;
+
+    /** @{ */
+    /** Raw access to the arrays. */
+    double x(Handle intersection) const;
+    double y(Handle intersection) const;
+    Handle firstWay(Handle intersection) const; /**< Index into wayRoad()/wayTarget(). */
+    Handle lastWay(Handle intersection) const;  /**< One past the last way. */
+    Handle wayRoad(Handle way) const;
+    Handle wayTarget(Handle way) const;
+
+    Handle roadBegining(Handle road) const;
+    Handle roadEnd(Handle road) const;
+    /** @} */
+
+    /**
+      Translate pointers of the original graph to handles.
+     @return Handle or INVALID_HANDLE when the object isn't in the snapshot.
+     */
+    Handle handleOf(Intersection* intersection) const;
+    Handle handleOf(Road* road) const;
+
+    /** Bytes occupied by the arrays (without the maps to the originals). */
+    size_t memoryUsage() const;
+
+  private:
+    /* Intersections */
+    std::vector<double> positionX;
+    std::vector<double> positionY;
+    std::vector<Handle> wayOffsets; /**< numberOfIntersections() + 1 items. */
+    std::vector<Handle> waysRoads;
+    std::vector<Handle> waysTargets;
+
+    /* Roads */
+    std::vector<Handle> roadsBeginings;
+    std::vector<Handle> roadsEnds;
+    std::vector<Road::Type> roadsTypes;
+
+    /* Link to the original graph */
+    std::vector<Intersection*> originalIntersections;
+    std::vector<Road*> originalRoads;
+    std::unordered_map<Intersection*, Handle> intersectionHandles;
+    std::unordered_map<Road*, Handle> roadHandles;
+};
+
+/* Inlines */
+inline double CompactStreetGraph::x(Handle intersection) const
+{
+  return positionX[intersection];
+}
+
+inline double CompactStreetGraph::y(Handle intersection) const
+{
+  return positionY[intersection];
+}
+
+inline CompactStreetGraph::Handle CompactStreetGraph::firstWay(Handle intersection) const
+{
+  return wayOffsets[intersection];
+}
+
+inline CompactStreetGraph::Handle CompactStreetGraph::lastWay(Handle intersection) const
+{
+  return wayOffsets[intersection + 1];
+}
+
+inline CompactStreetGraph::Handle CompactStreetGraph::wayRoad(Handle way) const
+{
+  return waysRoads[way];
+}
+
+inline CompactStreetGraph::Handle CompactStreetGraph::wayTarget(Handle way) const
+{
+  return waysTargets[way];
+}
+
+inline CompactStreetGraph::Handle CompactStreetGraph::roadBegining(Handle road) const
+{
+  return roadsBeginings[road];
+}
+
+inline CompactStreetGraph::Handle CompactStreetGraph::roadEnd(Handle road) const
+{
+  return roadsEnds[road];
+}
+
+#endif
@@ -0,0 +1,45 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/face.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see face.h
+ *
+ */
+
+#include "face.h"
+#include "intersection.h"
+#include "../geometry/polygon.h"
+
+Face::Face()
+  : faceId(-1), intersections()
+{}
+
+Face::Face(int id, std::vector<Intersection*> const& boundary)
+  : faceId(id), intersections(boundary)
+{}
+
+int Face::id() const
+{
+  return faceId;
+}
+
+std::vector<Intersection*> const& Face::boundary() const
+{
+  return intersections;
+}
+
+Polygon Face::polygon() const
+{
+  Polygon outline;
+  for (std::vector<Intersection*>::const_iterator intersection = intersections.begin();
+       intersection != intersections.end();
+       intersection++)
+  {
+    outline.addVertex((*intersection)->position());
+  }
+
+  return outline;
+}
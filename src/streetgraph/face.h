@@ -0,0 +1,49 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/face.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Bounded face of the planar StreetGraph
+ *
+ * Closed area surrounded by roads with no roads crossing
+ * it, i.e. the same area as the zones found by AreaExtractor
+ * (dead ends leading into the face are not part of its boundary).
+ *
+ * @see FaceTracker
+ */
+
+#ifndef _FACE_H_
+#define _FACE_H_
+
+#include <vector>
+
+class Intersection;
+class Polygon;
+
+class Face
+{
+  public:
+    Face();
+    Face(int id, std::vector<Intersection*> const& boundary);
+
+    /**
+      Identifier of the face.
+     @remarks
+       Unique within a StreetGraph. A face keeps its id while
+       edits of the graph don't change its boundary.
+     */
+    int id() const;
+
+    /** Intersections on the boundary in counterclockwise order. */
+    std::vector<Intersection*> const& boundary() const;
+
+    Polygon polygon() const;
+
+  private:
+    int faceId;
+    std::vector<Intersection*> intersections;
+};
+
+#endif
@@ -0,0 +1,312 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/facetracker.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see facetracker.h
+ *
+ */
+
+#include "facetracker.h"
+#include "streetgraphlistener.h"
+#include "intersection.h"
+#include "road.h"
+#include "planarfaces.h"
+#include "../geometry/point.h"
+#include "../debug.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace
+{
+  /** Position of the intersection. */
+  struct IntersectionPosition
+  {
+    Point operator()(Intersection* intersection) const
+    {
+      return intersection->position();
+    }
+  };
+
+  /** Position of the other end of a road leaving the intersection. */
+  struct OtherEnd
+  {
+    OtherEnd(Intersection* from)
+      : intersection(from)
+    {}
+
+    Point operator()(Road* road) const
+    {
+      return (road->begining() == intersection ? road->end() : road->begining())->position();
+    }
+
+    Intersection* intersection;
+  };
+
+  /** The loop rotated to start at the lowest pointer, to compare loops. */
+  std::vector<Intersection*> canonical(std::vector<Intersection*> const& loop)
+  {
+    std::vector<Intersection*> rotated(loop);
+    std::rotate(rotated.begin(),
+                std::min_element(rotated.begin(), rotated.end(), std::less<Intersection*>()),
+                rotated.end());
+    return rotated;
+  }
+}
+
+bool FaceTracker::HalfEdge::operator==(HalfEdge const& another) const
+{
+  return road == another.road && forward == another.forward;
+}
+
+size_t FaceTracker::HalfEdgeHash::operator()(HalfEdge const& halfEdge) const
+{
+  return std::hash<Road*>()(halfEdge.road) * 2 + (halfEdge.forward ? 1 : 0);
+}
+
+FaceTracker::FaceTracker()
+  : nextWalkId(0), nextFaceId(0)
+{}
+
+FaceTracker::~FaceTracker()
+{}
+
+void FaceTracker::clear()
+{
+  halfEdgeWalks.clear();
+  walks.clear();
+  currentFaces.clear();
+  removedFaces.clear();
+  touched.clear();
+  touchedSet.clear();
+  roadOrders.clear();
+  sortedRoadPool.clear();
+}
+
+Intersection* FaceTracker::origin(HalfEdge const& halfEdge) const
+{
+  return halfEdge.forward ? halfEdge.road->begining() : halfEdge.road->end();
+}
+
+Intersection* FaceTracker::target(HalfEdge const& halfEdge) const
+{
+  return halfEdge.forward ? halfEdge.road->end() : halfEdge.road->begining();
+}
+
+FaceTracker::RoadOrder FaceTracker::sortedRoads(Intersection* intersection)
+{
+  std::unordered_map<Intersection*, RoadOrder>::iterator cached = roadOrders.find(intersection);
+  if (cached != roadOrders.end())
+  {
+    return cached->second;
+  }
+
+  RoadOrder order;
+  order.first = sortedRoadPool.size();
+  Intersection::RoadRange roads = intersection->roadRange();
+  sortedRoadPool.insert(sortedRoadPool.end(), roads.begin(), roads.end());
+  order.count = sortedRoadPool.size() - order.first;
+
+  roadsToSort.assign(sortedRoadPool.begin() + order.first, sortedRoadPool.end());
+  PlanarFaces::sortCounterclockwise(intersection->position(), &roadsToSort, OtherEnd(intersection));
+  std::copy(roadsToSort.begin(), roadsToSort.end(), sortedRoadPool.begin() + order.first);
+
+  roadOrders[intersection] = order;
+  return order;
+}
+
+FaceTracker::HalfEdge FaceTracker::next(HalfEdge const& halfEdge)
+{
+  /* Continue by the road next clockwise from the one we came by,
+     so bounded faces are walked counterclockwise. */
+  Intersection* end = target(halfEdge);
+  RoadOrder order = sortedRoads(end);
+  Road* const* roads = &sortedRoadPool[order.first];
+  int position = std::find(roads, roads + order.count, halfEdge.road) - roads;
+  assert(position < order.count);
+
+  HalfEdge following;
+  following.road = roads[(position + order.count - 1) % order.count];
+  following.forward = following.road->begining() == end;
+  return following;
+}
+
+void FaceTracker::invalidate(Intersection* intersection)
+{
+  Intersection::RoadRange roads = intersection->roadRange();
+  for (Intersection::RoadRange::iterator road = roads.begin();
+       road != roads.end();
+       road++)
+  {
+    HalfEdge both[] = {{*road, true}, {*road, false}};
+    for (int i = 0; i < 2; i++)
+    {
+      std::unordered_map<HalfEdge, int, HalfEdgeHash>::iterator owner = halfEdgeWalks.find(both[i]);
+      if (owner != halfEdgeWalks.end())
+      {
+        removeWalk(owner->second);
+      }
+    }
+  }
+
+  if (touchedSet.insert(intersection).second)
+  {
+    touched.push_back(intersection);
+  }
+}
+
+void FaceTracker::removeWalk(int walk)
+{
+  Walk& removed = walks[walk];
+  for (std::vector<HalfEdge>::iterator halfEdge = removed.halfEdges.begin();
+       halfEdge != removed.halfEdges.end();
+       halfEdge++)
+  {
+    halfEdgeWalks.erase(*halfEdge);
+  }
+  for (std::vector<int>::iterator face = removed.faces.begin();
+       face != removed.faces.end();
+       face++)
+  {
+    removedFaces.push_back(currentFaces[*face]);
+    currentFaces.erase(*face);
+  }
+
+  walks.erase(walk);
+}
+
+void FaceTracker::update(std::list<StreetGraphListener*> const& listeners)
+{
+  std::vector<Face> removed, added;
+  removed.swap(removedFaces);
+  roadOrders.reserve(touched.size());
+
+  for (std::vector<Intersection*>::iterator intersection = touched.begin();
+       intersection != touched.end();
+       intersection++)
+  {
+    Intersection::RoadRange roads = (*intersection)->roadRange();
+    for (Intersection::RoadRange::iterator road = roads.begin();
+         road != roads.end();
+         road++)
+    {
+      HalfEdge both[] = {{*road, true}, {*road, false}};
+      for (int i = 0; i < 2; i++)
+      {
+        if (halfEdgeWalks.find(both[i]) == halfEdgeWalks.end())
+        {
+          walk(both[i], &removed, &added);
+        }
+      }
+    }
+  }
+  touched.clear();
+  touchedSet.clear();
+  /* Clearing costs the number of buckets, which stays large after
+     the first update of a whole graph, release the map instead. */
+  std::unordered_map<Intersection*, RoadOrder>().swap(roadOrders);
+  sortedRoadPool.clear();
+
+  for (std::list<StreetGraphListener*>::const_iterator listener = listeners.begin();
+       listener != listeners.end();
+       listener++)
+  {
+    for (std::vector<Face>::iterator face = removed.begin(); face != removed.end(); face++)
+    {
+      (*listener)->faceRemoved(*face);
+    }
+    for (std::vector<Face>::iterator face = added.begin(); face != added.end(); face++)
+    {
+      (*listener)->faceAdded(*face);
+    }
+  }
+}
+
+void FaceTracker::walk(HalfEdge const& first, std::vector<Face>* removed, std::vector<Face>* added)
+{
+  int id = nextWalkId++;
+  Walk& newWalk = walks[id];
+
+  /* Dead ends and parts touching in a single intersection make
+     the walk visit some intersection twice, the walk is split
+     there into simple loops. Faces are the counterclockwise loops,
+     the outer face and dead ends (loops of zero area) are not. */
+  std::vector<Intersection*> loop;
+  std::unordered_map<Intersection*, int> positionInLoop;
+  HalfEdge current = first;
+  do
+  {
+    newWalk.halfEdges.push_back(current);
+    halfEdgeWalks[current] = id;
+
+    Intersection* start = origin(current);
+    std::unordered_map<Intersection*, int>::iterator visited = positionInLoop.find(start);
+    if (visited != positionInLoop.end())
+    {
+      int begining = visited->second;
+      std::vector<Intersection*> closed(loop.begin() + begining, loop.end());
+      for (unsigned int i = begining; i < loop.size(); i++)
+      {
+        positionInLoop.erase(loop[i]);
+      }
+      loop.resize(begining);
+      storeLoop(closed, &newWalk, removed, added);
+    }
+    positionInLoop[start] = loop.size();
+    loop.push_back(start);
+
+    current = next(current);
+  } while (!(current == first));
+
+  storeLoop(loop, &newWalk, removed, added);
+}
+
+void FaceTracker::storeLoop(std::vector<Intersection*> const& loop, Walk* owner,
+                            std::vector<Face>* removed, std::vector<Face>* added)
+{
+  if (!PlanarFaces::isCounterclockwise(loop, IntersectionPosition()))
+  {
+    return;
+  }
+
+  std::vector<Intersection*> key = canonical(loop);
+  for (std::vector<Face>::iterator face = removed->begin();
+       face != removed->end();
+       face++)
+  {
+    if (canonical(face->boundary()) == key)
+    /* The edit didn't change this face after all. */
+    {
+      currentFaces[face->id()] = *face;
+      owner->faces.push_back(face->id());
+      removed->erase(face);
+      return;
+    }
+  }
+
+  Face newFace(nextFaceId++, loop);
+  currentFaces[newFace.id()] = newFace;
+  owner->faces.push_back(newFace.id());
+  added->push_back(newFace);
+}
+
+std::vector<Face> FaceTracker::faces() const
+{
+  std::vector<Face> result;
+  for (std::map<int, Face>::const_iterator face = currentFaces.begin();
+       face != currentFaces.end();
+       face++)
+  {
+    result.push_back(face->second);
+  }
+
+  return result;
+}
+
+int FaceTracker::numberOfFaces() const
+{
+  return currentFaces.size();
+}
@@ -0,0 +1,146 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/facetracker.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Faces of a StreetGraph maintained during edits
+ *
+ * Every road is split into two half-edges (one for each
+ * direction) and the half-edges are grouped into walks
+ * around the faces of the planar graph, the same way
+ * AreaExtractor::HALF_EDGE_FACES does it at once.
+ *
+ * An edit changes only the order of roads around the
+ * intersections it touches. Walks passing through those
+ * intersections are invalidated before the edit and walked
+ * again after it, the rest of the faces stays. The cost
+ * of an edit is proportional to the size of the faces
+ * around it instead of the size of the graph.
+ *
+ * @see StreetGraph::setFaceTracking()
+ */
+
+#ifndef _FACETRACKER_H_
+#define _FACETRACKER_H_
+
+#include <list>
+#include <cstddef>
+#include <map>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "face.h"
+
+class Road;
+class Intersection;
+class StreetGraphListener;
+
+class FaceTracker
+{
+  public:
+    FaceTracker();
+    ~FaceTracker();
+
+    /**
+      Forget faces passing through an intersection.
+     @remarks
+       Call before roads of the intersection change (a road
+       is connected, disconnected or moved to other intersection).
+     */
+    void invalidate(Intersection* intersection);
+
+    /**
+      Walk the faces around invalidated intersections again.
+     @remarks
+       Listeners are notified about the faces that are gone
+       and then about the new ones. Faces with the same boundary
+       as before the edit keep their ids and are not reported.
+     */
+    void update(std::list<StreetGraphListener*> const& listeners);
+
+    void clear();
+
+    /** Current faces ordered by id. */
+    std::vector<Face> faces() const;
+    int numberOfFaces() const;
+
+  private:
+    struct HalfEdge
+    {
+      Road* road;
+      bool forward; /**< From the begining of the road to its end. */
+
+      bool operator==(HalfEdge const& another) const;
+    };
+
+    struct HalfEdgeHash
+    {
+      size_t operator()(HalfEdge const& halfEdge) const;
+    };
+
+    struct Walk
+    {
+      std::vector<HalfEdge> halfEdges;
+      std::vector<int> faces;
+    };
+
+    Intersection* origin(HalfEdge const& halfEdge) const;
+    Intersection* target(HalfEdge const& halfEdge) const;
+
+    /** Range of an intersection's roads in sortedRoadPool. */
+    struct RoadOrder
+    {
+      int first;
+      int count;
+    };
+
+    /**
+      Roads of the intersection counterclockwise.
+     @remarks
+       Sorted once per update() and reused by the following
+       steps of the walks passing through the intersection.
+     */
+    RoadOrder sortedRoads(Intersection* intersection);
+
+    /** Half-edge following this one along its face. */
+    HalfEdge next(HalfEdge const& halfEdge);
+
+    void removeWalk(int walk);
+
+    /**
+      Walk a face starting with a half-edge.
+     @param[in,out] removed Faces removed by this update, matching
+                            ones are reused and taken out of the list.
+     @param[out]    added   New faces.
+     */
+    void walk(HalfEdge const& first, std::vector<Face>* removed, std::vector<Face>* added);
+
+    /** Store a loop of a walk if it bounds a face. */
+    void storeLoop(std::vector<Intersection*> const& loop, Walk* owner,
+                   std::vector<Face>* removed, std::vector<Face>* added);
+
+  private:
+    std::unordered_map<HalfEdge, int, HalfEdgeHash> halfEdgeWalks;
+    std::unordered_map<int, Walk> walks;
+    std::map<int, Face> currentFaces;
+
+    /** Faces removed since the last update(). */
+    std::vector<Face> removedFaces;
+
+    /** Intersections invalidated since the last update(). */
+    std::vector<Intersection*> touched;
+    std::unordered_set<Intersection*> touchedSet;
+
+    /** Roads sorted by sortedRoads() during the current update(). */
+    std::unordered_map<Intersection*, RoadOrder> roadOrders;
+    std::vector<Road*> sortedRoadPool;
+    std::vector<Road*> roadsToSort;
+
+    int nextWalkId;
+    int nextFaceId;
+};
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/gridcell.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Cell of an uniform grid used by the spatial indices.
+ *
+ * @see IntersectionGrid
+ * @see RoadGrid
+ */
+
+#ifndef _GRIDCELL_H_
+#define _GRIDCELL_H_
+
+#include <cstddef>
+#include <cmath>
+
+struct GridCell
+{
+  long long x;
+  long long y;
+
+  GridCell() : x(0), y(0) {}
+  GridCell(long long cellX, long long cellY) : x(cellX), y(cellY) {}
+
+  /** Cell that contains point [x,y] in grid with cells of size cellSize. */
+  static GridCell containing(double x, double y, double cellSize);
+
+  bool operator==(GridCell const& another) const;
+};
+
+/** Hash functor so GridCell can key std::unordered_map. */
+struct GridCellHash
+{
+  size_t operator()(GridCell const& cell) const;
+};
+
+/* Inlines */
+inline GridCell GridCell::containing(double x, double y, double cellSize)
+{
+  return GridCell(static_cast<long long>(std::floor(x / cellSize)),
+                  static_cast<long long>(std::floor(y / cellSize)));
+}
+
+inline bool GridCell::operator==(GridCell const& another) const
+{
+  return x == another.x && y == another.y;
+}
+
+inline size_t GridCellHash::operator()(GridCell const& cell) const
+{
+  /* Mix both coordinates so neighbouring cells don't collide. */
+  unsigned long long hash = static_cast<unsigned long long>(cell.x) * 0x9E3779B97F4A7C15ULL;
+  hash ^= static_cast<unsigned long long>(cell.y) + 0x632BE59BD9B4E019ULL + (hash << 6) + (hash >> 2);
+  return static_cast<size_t>(hash);
+}
+
+#endif
@@ -15,24 +15,18 @@
 #include "../geometry/point.h"
 
 Intersection::Intersection()
-  : roads(0), geometrical_position(0)
+  : roads(0), geometrical_position()
 {
 }
 
 Intersection::Intersection(Point coordinates)
-  : roads(0), geometrical_position(0)
+  : roads(0), geometrical_position(coordinates)
 {
-  geometrical_position = new Point(coordinates);
   roads = new std::list<Road*>;
 }
 
 Intersection::~Intersection()
 {
-  if (geometrical_position != 0)
-  {
-    delete geometrical_position;
-  }
-
   if (roads != 0)
   {
     delete roads;
@@ -65,8 +59,8 @@ std::vector<Intersection*> Intersection::adjacentIntersections()
 
 void Intersection::connectRoad(Road* road) throw()
 {
-  if (road->begining()->position() == *geometrical_position ||
-      road->end()->position()      == *geometrical_position)
+  if (road->begining()->position() == geometrical_position ||
+      road->end()->position()      == geometrical_position)
   {
     roads->push_back(road);
   }
@@ -84,12 +78,12 @@ void Intersection::disconnectRoad(Road* road)
 
 Point Intersection::position() const
 {
-  return *geometrical_position;
+  return geometrical_position;
 }
 
 void Intersection::setPosition(Point const& coordinates)
 {
-  *geometrical_position = coordinates;
+  geometrical_position = coordinates;
 }
 
 int Intersection::numberOfWays() const
@@ -102,6 +96,54 @@ std::list<Road*> Intersection::getRoads()
   return *roads;
 }
 
+Intersection::RoadRange Intersection::roadRange() const
+{
+  return RoadRange(roads->begin(), roads->end());
+}
+
+Intersection::AdjacentRange Intersection::adjacentRange() const
+{
+  return AdjacentRange(AdjacentIterator(roads->begin(), this),
+                       AdjacentIterator(roads->end(), this));
+}
+
+Intersection::AdjacentIterator::AdjacentIterator()
+  : road(), from(0)
+{}
+
+Intersection::AdjacentIterator::AdjacentIterator(std::list<Road*>::const_iterator road,
+                                                 Intersection const* from)
+  : road(road), from(from)
+{}
+
+Intersection* Intersection::AdjacentIterator::operator*() const
+{
+  return (*road)->begining() != from ? (*road)->begining() : (*road)->end();
+}
+
+Intersection::AdjacentIterator& Intersection::AdjacentIterator::operator++()
+{
+  road++;
+  return *this;
+}
+
+Intersection::AdjacentIterator Intersection::AdjacentIterator::operator++(int)
+{
+  AdjacentIterator previous(*this);
+  road++;
+  return previous;
+}
+
+bool Intersection::AdjacentIterator::operator==(AdjacentIterator const& another) const
+{
+  return road == another.road;
+}
+
+bool Intersection::AdjacentIterator::operator!=(AdjacentIterator const& another) const
+{
+  return road != another.road;
+}
+
 bool Intersection::hasRoad(Road* road)
 {
   for (std::list<Road*>::iterator roadIterator = roads->begin();
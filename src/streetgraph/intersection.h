@@ -15,8 +15,12 @@
 
 #include <list>
 #include <vector>
+#include <cstddef>
+#include <iterator>
+
+#include "../geometry/point.h"
+#include "../range.h"
 
-class Point;
 class Road;
 
 class Intersection
@@ -31,9 +35,50 @@ class Intersection
     Point position() const;
     void  setPosition(Point const& coordinates);
 
+    /**
+      Iterates over the far ends of the roads of an intersection.
+     */
+    class AdjacentIterator
+    {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Intersection*             value_type;
+        typedef std::ptrdiff_t            difference_type;
+        typedef Intersection* const*      pointer;
+        typedef Intersection*             reference;
+
+        AdjacentIterator();
+        AdjacentIterator(std::list<Road*>::const_iterator road, Intersection const* from);
+
+        Intersection* operator*() const;
+        AdjacentIterator& operator++();
+        AdjacentIterator  operator++(int);
+
+        bool operator==(AdjacentIterator const& another) const;
+        bool operator!=(AdjacentIterator const& another) const;
+
+      private:
+        std::list<Road*>::const_iterator road;
+        Intersection const* from;
+    };
+
+    typedef Range<std::list<Road*>::const_iterator> RoadRange;
+    typedef Range<AdjacentIterator> AdjacentRange;
+
     std::vector<Intersection*> adjacentIntersections();
     int  numberOfWays() const; /**< Number of ways of the intersection */
 
+    /** @{ */
+    /**
+      Roads and adjacent intersections without copying.
+     @remarks
+       Both are in the same order as getRoads() and become
+       invalid when a road is connected or disconnected.
+     */
+    AdjacentRange adjacentRange() const;
+    RoadRange roadRange() const;
+    /** @} */
+
     void connectRoad(Road* road) throw();
     void disconnectRoad(Road* road);
 
@@ -43,7 +88,7 @@ class Intersection
 
   private:
     std::list<Road*>* roads;     /**< Topological information */
-    Point* geometrical_position; /**< Geometrical information */
+    Point geometrical_position; /**< Geometrical information */
 };
 
 
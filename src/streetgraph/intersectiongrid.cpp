@@ -0,0 +1,176 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/intersectiongrid.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see intersectiongrid.h
+ *
+ */
+
+#include "intersectiongrid.h"
+#include "intersection.h"
+#include "../geometry/point.h"
+#include "../geometry/units.h"
+#include "../debug.h"
+
+#include <algorithm>
+
+namespace
+{
+  struct EarlierEntry
+  {
+    template <typename EntryType>
+    bool operator()(EntryType const& first, EntryType const& second) const
+    {
+      return first.order < second.order;
+    }
+  };
+}
+
+const double IntersectionGrid::DEFAULT_CELL_SIZE = 200;
+
+IntersectionGrid::IntersectionGrid(double size)
+  : cellSize(size), cells(), insertedIntersections(0), numberOfIntersections(0)
+{
+  assert(cellSize > libcity::COORDINATES_EPSILON);
+}
+
+IntersectionGrid::~IntersectionGrid()
+{}
+
+void IntersectionGrid::insert(Intersection* intersection)
+{
+  Point position = intersection->position();
+
+  Entry entry;
+  entry.intersection = intersection;
+  entry.order = insertedIntersections++;
+
+  cells[GridCell::containing(position.x(), position.y(), cellSize)].push_back(entry);
+  numberOfIntersections++;
+}
+
+void IntersectionGrid::remove(Intersection* intersection)
+{
+  Point position = intersection->position();
+  Cells::iterator cell = cells.find(GridCell::containing(position.x(), position.y(), cellSize));
+  if (cell == cells.end())
+  {
+    return;
+  }
+
+  Bucket& bucket = cell->second;
+  for (Bucket::iterator entry = bucket.begin();
+       entry != bucket.end();
+       entry++)
+  {
+    if (entry->intersection == intersection)
+    {
+      bucket.erase(entry);
+      numberOfIntersections--;
+      break;
+    }
+  }
+
+  if (bucket.empty())
+  {
+    cells.erase(cell);
+  }
+}
+
+void IntersectionGrid::clear()
+{
+  cells.clear();
+  numberOfIntersections = 0;
+}
+
+Intersection* IntersectionGrid::find(Point const& position) const
+{
+  GridCell lowest  = GridCell::containing(position.x() - libcity::COORDINATES_EPSILON,
+                                         position.y() - libcity::COORDINATES_EPSILON, cellSize);
+  GridCell highest = GridCell::containing(position.x() + libcity::COORDINATES_EPSILON,
+                                         position.y() + libcity::COORDINATES_EPSILON, cellSize);
+
+  Point searched(position);
+  Intersection* found = 0;
+  unsigned long foundOrder = 0;
+
+  /* The tolerance neighbourhood is much smaller than a cell,
+     so this is at most 2x2 cells. */
+  GridCell cell;
+  for (cell.x = lowest.x; cell.x <= highest.x; cell.x++)
+  {
+    for (cell.y = lowest.y; cell.y <= highest.y; cell.y++)
+    {
+      Cells::const_iterator bucket = cells.find(cell);
+      if (bucket == cells.end())
+      {
+        continue;
+      }
+
+      for (Bucket::const_iterator entry = bucket->second.begin();
+           entry != bucket->second.end();
+           entry++)
+      {
+        if ((found == 0 || entry->order < foundOrder) &&
+            searched == entry->intersection->position())
+        {
+          found = entry->intersection;
+          foundOrder = entry->order;
+        }
+      }
+    }
+  }
+
+  return found;
+}
+
+void IntersectionGrid::query(double minX, double minY, double maxX, double maxY,
+                             std::vector<Intersection*>* output) const
+{
+  output->clear();
+
+  GridCell lowest  = GridCell::containing(minX, minY, cellSize),
+           highest = GridCell::containing(maxX, maxY, cellSize);
+
+  std::vector<Entry> found;
+  GridCell cell;
+  for (cell.x = lowest.x; cell.x <= highest.x; cell.x++)
+  {
+    for (cell.y = lowest.y; cell.y <= highest.y; cell.y++)
+    {
+      Cells::const_iterator bucket = cells.find(cell);
+      if (bucket == cells.end())
+      {
+        continue;
+      }
+
+      for (Bucket::const_iterator entry = bucket->second.begin();
+           entry != bucket->second.end();
+           entry++)
+      {
+        Point position = entry->intersection->position();
+        if (position.x() >= minX && position.x() <= maxX &&
+            position.y() >= minY && position.y() <= maxY)
+        {
+          found.push_back(*entry);
+        }
+      }
+    }
+  }
+
+  std::sort(found.begin(), found.end(), EarlierEntry());
+  for (std::vector<Entry>::iterator entry = found.begin();
+       entry != found.end();
+       entry++)
+  {
+    output->push_back(entry->intersection);
+  }
+}
+
+int IntersectionGrid::size() const
+{
+  return numberOfIntersections;
+}
@@ -0,0 +1,92 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/intersectiongrid.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Uniform grid index of intersections
+ *
+ * Intersections are hashed into square cells according to
+ * their quantized X and Y coordinates. Lookup of an intersection
+ * at a certain position then needs to look only into cells
+ * that overlap with the libcity::COORDINATES_EPSILON neighbourhood
+ * of the position (usually a single cell) instead of scanning
+ * all the intersections of the StreetGraph.
+ *
+ */
+
+#ifndef _INTERSECTIONGRID_H_
+#define _INTERSECTIONGRID_H_
+
+#include <vector>
+#include <unordered_map>
+
+#include "gridcell.h"
+
+class Point;
+class Intersection;
+
+class IntersectionGrid
+{
+  public:
+    /** Default size of a single cell side. */
+    static const double DEFAULT_CELL_SIZE;
+
+    IntersectionGrid(double cellSize = DEFAULT_CELL_SIZE);
+    ~IntersectionGrid();
+
+    /**
+      Put intersection into the index.
+     @note
+       The intersection must not change its position while
+       it's indexed. Remove it first and insert it again
+       if it's neccessary to move it.
+     */
+    void insert(Intersection* intersection);
+    void remove(Intersection* intersection);
+    void clear();
+
+    /**
+      Find intersection at certain position.
+     @remarks
+       Positions are compared by Point::operator==, so the
+       tolerance is libcity::COORDINATES_EPSILON. If there are
+       more candidates, the one inserted first is returned
+       (the same one a linear scan would find).
+
+     @param[in] position Where to look.
+     @return Intersection or 0 (NULL).
+     */
+    Intersection* find(Point const& position) const;
+
+    /**
+      Find intersections inside a rectangle.
+     @remarks
+       Output is sorted by the order in which the intersections
+       were inserted (which is the order of StreetGraph::intersections).
+
+     @param[out] output Found intersections, the vector is cleared first.
+     */
+    void query(double minX, double minY, double maxX, double maxY,
+               std::vector<Intersection*>* output) const;
+
+    int size() const;
+
+  private:
+    struct Entry
+    {
+      Intersection* intersection;
+      unsigned long order; /**< Insertion order to break ties. */
+    };
+
+    typedef std::vector<Entry> Bucket;
+    typedef std::unordered_map<GridCell, Bucket, GridCellHash> Cells;
+
+    double cellSize;
+    Cells cells;
+    unsigned long insertedIntersections;
+    int numberOfIntersections;
+};
+
+#endif
@@ -20,50 +20,34 @@
 #include "../geometry/vector.h"
 
 Path::Path()
-{
-  representation = new LineSegment();
-}
+  : representation()
+{}
 
 Path::Path(LineSegment const& line)
-{
-  representation = new LineSegment(line);
-}
-
-Path::Path(Path const& source)
-{
-  representation = new LineSegment(*(source.representation));
-}
-
-Path& Path::operator=(Path const& source)
-{
-  *representation = *(source.representation);
-
-  return *this;
-}
+  : representation(line)
+{}
 
 Path::~Path()
-{
-  delete representation;
-}
+{}
 
 Point Path::begining() const
 {
-  return representation->begining();
+  return representation.begining();
 }
 
 Point Path::end() const
 {
-  return representation->end();
+  return representation.end();
 }
 
 void Path::setBegining(Point const& begining)
 {
-  representation->setBegining(begining);
+  representation.setBegining(begining);
 }
 
 void Path::setEnd(Point const& end)
 {
-  representation->setEnd(end);
+  representation.setEnd(end);
 }
 
 bool Path::isInside(Polygon const& certainArea) const
@@ -74,44 +58,44 @@ bool Path::isInside(Polygon const& certainArea) const
 
 bool Path::goesThrough(Point const& certainPoint) const
 {
-  return representation->hasPoint2D(certainPoint);
+  return representation.hasPoint2D(certainPoint);
 }
 
 LineSegment::Intersection Path::crosses(Path const& anotherPath, Point* intersection)
 {
-  return representation->intersection2D(*(anotherPath.representation), intersection);
+  return representation.intersection2D(anotherPath.representation, intersection);
 }
 
 Point Path::nearestPoint(Point const& point)
 {
-  return representation->nearestPoint(point);
+  return representation.nearestPoint(point);
 }
 
 double Path::distance(Point const& point)
 {
-  return representation->distance(point);
+  return representation.distance(point);
 }
 
 void Path::shorten(Point const& newBegining, Point const& newEnd)
 {
-  if (!representation->hasPoint2D(newBegining) ||
-      !representation->hasPoint2D(newEnd))
+  if (!representation.hasPoint2D(newBegining) ||
+      !representation.hasPoint2D(newEnd))
   {
     // FIXME throw exception
   }
 
-  representation->setBegining(newBegining);
-  representation->setBegining(newEnd);
+  representation.setBegining(newBegining);
+  representation.setBegining(newEnd);
 }
 
 std::string Path::toString()
 {
-  return "Path(" + representation->toString() + ")";
+  return "Path(" + representation.toString() + ")";
 }
 
 double Path::length()
 {
-  return representation->length();
+  return representation.length();
 }
 
 Vector Path::beginingDirectionVector()
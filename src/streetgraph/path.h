@@ -27,9 +27,6 @@ class Path
     Path();
     Path(LineSegment const& line);
 
-    Path(Path const& source);
-    Path& operator=(Path const& source);
-
     ~Path();
 
     Point begining() const;
@@ -77,7 +74,7 @@ class Path
 
     std::string toString();
   private:
-   LineSegment *representation;
+   LineSegment representation;
 };
 
 
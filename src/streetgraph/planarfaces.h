@@ -0,0 +1,108 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/planarfaces.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Helpers for walking the faces of a planar graph
+ *
+ * Shared by AreaExtractor::HALF_EDGE_FACES and FaceTracker,
+ * so both of them order the roads and pick the bounded faces
+ * the same way. The vertices are anything the Position functor
+ * maps to a Point, only x and y coordinates are used.
+ */
+
+#ifndef _PLANARFACES_H_
+#define _PLANARFACES_H_
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "../geometry/point.h"
+#include "../geometry/predicates.h"
+
+namespace PlanarFaces
+{
+  /**
+    Is the direction from center to a point below the x axis?
+   @remarks
+     The negative x axis counts as above, the positive one as below.
+   */
+  inline bool isInLowerHalf(Point const& center, Point const& point)
+  {
+    return point.y() < center.y() || (point.y() == center.y() && point.x() >= center.x());
+  }
+
+  /**
+    Sort the neighbours of a vertex counterclockwise.
+   @remarks
+     The order starts at the direction of negative x axis.
+     Neighbours in the same direction keep their order.
+     Directions are compared with exact orientation tests,
+     so even nearly parallel roads are ordered reliably.
+   @param[in,out] neighbours Elements leading to the neighbours.
+   @param[in]     position   Position of the neighbour of an element.
+   */
+  template <typename Element, typename Position>
+  void sortCounterclockwise(Point const& center, std::vector<Element>* neighbours,
+                            Position const& position)
+  {
+    std::vector< std::pair<Point, int> > directions;
+    directions.reserve(neighbours->size());
+    for (unsigned int i = 0; i < neighbours->size(); i++)
+    {
+      directions.push_back(std::make_pair(position((*neighbours)[i]), i));
+    }
+    std::sort(directions.begin(), directions.end(),
+              [&center](std::pair<Point, int> const& first, std::pair<Point, int> const& second)
+              {
+                bool firstLower  = isInLowerHalf(center, first.first),
+                     secondLower = isInLowerHalf(center, second.first);
+                if (firstLower != secondLower)
+                {
+                  return firstLower;
+                }
+                int side = Predicates::orientation(center, first.first, second.first);
+                if (side != 0)
+                {
+                  return side > 0;
+                }
+                return first.second < second.second;
+              });
+
+    std::vector<Element> sorted;
+    sorted.reserve(neighbours->size());
+    for (unsigned int i = 0; i < directions.size(); i++)
+    {
+      sorted.push_back((*neighbours)[directions[i].second]);
+    }
+    neighbours->swap(sorted);
+  }
+
+  /**
+    Is the closed loop a counterclockwise polygon?
+   @return False for loops of less than 3 vertices or of zero area.
+   */
+  template <typename Vertex, typename Position>
+  bool isCounterclockwise(std::vector<Vertex> const& loop, Position const& position)
+  {
+    if (loop.size() < 3)
+    {
+      return false;
+    }
+
+    double doubleArea = 0;
+    for (unsigned int i = 0; i < loop.size(); i++)
+    {
+      Point current = position(loop[i]),
+            next    = position(loop[(i + 1) % loop.size()]);
+      doubleArea += current.x() * next.y() - next.x() * current.y();
+    }
+
+    return doubleArea > 0;
+  }
+}
+
+#endif
@@ -31,49 +31,32 @@ Road::Type Road::defineNewRoadType()
 }
 
 Road::Road()
-  : from(0), to(0), geometrical_path(0)
-{
-  geometrical_path = new Path;
-}
+  : from(0), to(0), geometrical_path()
+{}
 
 Road::Road(Intersection *first, Intersection *second)
-  : from(first), to(second), geometrical_path(0)
-{
-  geometrical_path = new Path(LineSegment(from->position(), to->position()));
-}
+  : from(first), to(second), geometrical_path(LineSegment(first->position(), second->position()))
+{}
 
 Road::Road(Path const& path)
-  : from(0), to(0), geometrical_path(0)
-{
-  geometrical_path = new Path(path);
-}
+  : from(0), to(0), geometrical_path(path)
+{}
 
 Road::~Road()
 {
   /* "from", "to" are NOT free'd here,
      because they were not allocated by this object. */
-
-  if (geometrical_path != 0)
-  {
-    delete geometrical_path;
-  }
 }
 
 void Road::setPath(Path const& roadPath) throw()
 {
   //TODO: check if the path start and end matches the intersections
-  delete geometrical_path;
-  geometrical_path = new Path(roadPath);
+  geometrical_path = roadPath;
 }
 
 void Road::estimatePath()
 {
-  if (geometrical_path != 0)
-  {
-    delete geometrical_path;
-  }
-
-  geometrical_path = new Path(LineSegment(from->position(), to->position()));
+  geometrical_path = Path(LineSegment(from->position(), to->position()));
 }
 
 Road::Type Road::type()
@@ -89,18 +72,23 @@ void Road::setType(Road::Type type)
 void Road::setBegining(Intersection* intersection)
 {
   from = intersection;
-  geometrical_path->setBegining(from->position());
+  geometrical_path.setBegining(from->position());
 }
 
 void Road::setEnd(Intersection* intersection)
 {
   to = intersection;
-  geometrical_path->setEnd(to->position());
+  geometrical_path.setEnd(to->position());
+}
+
+Path* Road::path()
+{
+  return &geometrical_path;
 }
 
-Path* Road::path() const
+Path const* Road::path() const
 {
-  return geometrical_path;
+  return &geometrical_path;
 }
 
 
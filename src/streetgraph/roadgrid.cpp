@@ -0,0 +1,225 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/roadgrid.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see roadgrid.h
+ *
+ */
+
+#include "roadgrid.h"
+#include "road.h"
+#include "path.h"
+#include "../geometry/point.h"
+#include "../geometry/units.h"
+#include "../debug.h"
+
+#include <algorithm>
+
+namespace
+{
+  /** Roads are registered with a little margin, because
+      the geometric tests use tolerances as well. */
+  const double BOUNDING_BOX_MARGIN = 10 * libcity::COORDINATES_EPSILON;
+
+  struct EarlierEntry
+  {
+    template <typename EntryType>
+    bool operator()(EntryType const& first, EntryType const& second) const
+    {
+      return first.order < second.order;
+    }
+  };
+}
+
+const double RoadGrid::DEFAULT_CELL_SIZE = 400;
+
+RoadGrid::RoadGrid(double size)
+  : cellSize(size), cells(), records(), insertedRoads(0)
+{
+  assert(cellSize > libcity::COORDINATES_EPSILON);
+}
+
+RoadGrid::~RoadGrid()
+{}
+
+void RoadGrid::insert(Road* road)
+{
+  registerRoad(road, insertedRoads++);
+}
+
+void RoadGrid::remove(Road* road)
+{
+  Records::iterator record = records.find(road);
+  if (record == records.end())
+  {
+    return;
+  }
+
+  unregisterRoad(road, record->second);
+  records.erase(record);
+}
+
+void RoadGrid::update(Road* road)
+{
+  Records::iterator record = records.find(road);
+  if (record == records.end())
+  {
+    insert(road);
+    return;
+  }
+
+  unsigned long order = record->second.order;
+  unregisterRoad(road, record->second);
+  registerRoad(road, order);
+}
+
+void RoadGrid::clear()
+{
+  cells.clear();
+  records.clear();
+}
+
+void RoadGrid::registerRoad(Road* road, unsigned long order)
+{
+  Point begining = road->path()->begining(),
+        end      = road->path()->end();
+
+  if (begining.x() > end.x())
+  {
+    std::swap(begining, end);
+  }
+
+  Record& record = records[road];
+  record.order = order;
+  record.cells.clear();
+
+  Entry entry;
+  entry.road  = road;
+  entry.order = order;
+
+  /* Walk the columns of the grid the path goes through and
+     register just the cells around the path in each column. */
+  double deltaX = end.x() - begining.x(),
+         deltaY = end.y() - begining.y();
+  long long firstColumn = GridCell::containing(begining.x() - BOUNDING_BOX_MARGIN, 0, cellSize).x,
+            lastColumn  = GridCell::containing(end.x() + BOUNDING_BOX_MARGIN, 0, cellSize).x;
+
+  GridCell cell;
+  for (cell.x = firstColumn; cell.x <= lastColumn; cell.x++)
+  {
+    double columnBegining = std::max(begining.x(), cell.x * cellSize - BOUNDING_BOX_MARGIN),
+           columnEnd      = std::min(end.x(), (cell.x + 1) * cellSize + BOUNDING_BOX_MARGIN);
+    double y1 = begining.y(),
+           y2 = end.y();
+
+    if (deltaX > libcity::COORDINATES_EPSILON)
+    {
+      y1 = begining.y() + deltaY * (columnBegining - begining.x()) / deltaX;
+      y2 = begining.y() + deltaY * (columnEnd - begining.x()) / deltaX;
+    }
+
+    long long lowestRow  = GridCell::containing(0, std::min(y1, y2) - BOUNDING_BOX_MARGIN, cellSize).y,
+              highestRow = GridCell::containing(0, std::max(y1, y2) + BOUNDING_BOX_MARGIN, cellSize).y;
+
+    for (cell.y = lowestRow; cell.y <= highestRow; cell.y++)
+    {
+      cells[cell].push_back(entry);
+      record.cells.push_back(cell);
+    }
+  }
+}
+
+void RoadGrid::unregisterRoad(Road* road, Record const& record)
+{
+  for (std::vector<GridCell>::const_iterator cell = record.cells.begin();
+       cell != record.cells.end();
+       cell++)
+  {
+    Cells::iterator bucket = cells.find(*cell);
+    if (bucket == cells.end())
+    {
+      continue;
+    }
+
+    for (Bucket::iterator entry = bucket->second.begin();
+         entry != bucket->second.end();
+         entry++)
+    {
+      if (entry->road == road)
+      {
+        bucket->second.erase(entry);
+        break;
+      }
+    }
+
+    if (bucket->second.empty())
+    {
+      cells.erase(bucket);
+    }
+  }
+}
+
+void RoadGrid::query(double minX, double minY, double maxX, double maxY,
+                     std::vector<Road*>* output) const
+{
+  output->clear();
+
+  GridCell lowest  = GridCell::containing(minX, minY, cellSize),
+           highest = GridCell::containing(maxX, maxY, cellSize);
+
+  std::vector<Entry> found;
+  double queriedCells = static_cast<double>(highest.x - lowest.x + 1) *
+                        static_cast<double>(highest.y - lowest.y + 1);
+  if (queriedCells > cells.size())
+  /* Huge rectangle, it's cheaper to go through the occupied cells. */
+  {
+    for (Cells::const_iterator bucket = cells.begin();
+         bucket != cells.end();
+         bucket++)
+    {
+      if (bucket->first.x >= lowest.x && bucket->first.x <= highest.x &&
+          bucket->first.y >= lowest.y && bucket->first.y <= highest.y)
+      {
+        found.insert(found.end(), bucket->second.begin(), bucket->second.end());
+      }
+    }
+  }
+  else
+  {
+    GridCell cell;
+    for (cell.x = lowest.x; cell.x <= highest.x; cell.x++)
+    {
+      for (cell.y = lowest.y; cell.y <= highest.y; cell.y++)
+      {
+        Cells::const_iterator bucket = cells.find(cell);
+        if (bucket != cells.end())
+        {
+          found.insert(found.end(), bucket->second.begin(), bucket->second.end());
+        }
+      }
+    }
+  }
+
+  /* Long roads are registered in more cells. */
+  std::sort(found.begin(), found.end(), EarlierEntry());
+
+  Road* previous = 0;
+  for (std::vector<Entry>::iterator entry = found.begin();
+       entry != found.end();
+       entry++)
+  {
+    if (entry->road != previous)
+    {
+      output->push_back(entry->road);
+      previous = entry->road;
+    }
+  }
+}
+
+int RoadGrid::size() const
+{
+  return records.size();
+}
@@ -0,0 +1,95 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/roadgrid.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Uniform grid index of road segments
+ *
+ * Each road is registered in all the cells its path
+ * passes through (with a small tolerance). A query for a rectangle returns only roads
+ * from the overlapping cells, so the geometric tests (such
+ * as crossing of two paths) can be done just with roads
+ * in the neighbourhood instead of the whole StreetGraph.
+ * The grid is two-dimensional, z coordinates of the paths
+ * are ignored.
+ *
+ */
+
+#ifndef _ROADGRID_H_
+#define _ROADGRID_H_
+
+#include <vector>
+#include <unordered_map>
+
+#include "gridcell.h"
+
+class Road;
+
+class RoadGrid
+{
+  public:
+    /** Default size of a single cell side. */
+    static const double DEFAULT_CELL_SIZE;
+
+    RoadGrid(double cellSize = DEFAULT_CELL_SIZE);
+    ~RoadGrid();
+
+    void insert(Road* road);
+    void remove(Road* road);
+
+    /**
+      Reindex road after its path changed.
+     @remarks
+       The road keeps its position in the insertion order,
+       so the query results are ordered as before.
+     */
+    void update(Road* road);
+
+    void clear();
+
+    /**
+      Find roads that may intersect a rectangle.
+     @remarks
+       The result is conservative: it contains all roads passing
+       through the grid cells overlapped by the rectangle.
+       Output is sorted by the order in which the roads were
+       inserted (which is the order of StreetGraph::roads).
+       There are no duplicates in the output.
+
+     @param[out] output Found roads, the vector is cleared first.
+     */
+    void query(double minX, double minY, double maxX, double maxY,
+               std::vector<Road*>* output) const;
+
+    int size() const;
+
+  private:
+    struct Entry
+    {
+      Road* road;
+      unsigned long order; /**< Insertion order of the road. */
+    };
+
+    /** Where the road is registered. */
+    struct Record
+    {
+      unsigned long order;
+      std::vector<GridCell> cells;
+    };
+
+    typedef std::vector<Entry> Bucket;
+    typedef std::unordered_map<GridCell, Bucket, GridCellHash> Cells;
+    typedef std::unordered_map<Road*, Record> Records;
+
+    void registerRoad(Road* road, unsigned long order);
+    void unregisterRoad(Road* road, Record const& record);
+
+    double cellSize;
+    Cells cells;
+    Records records;
+    unsigned long insertedRoads;
+};
+
+#endif
@@ -12,12 +12,17 @@
 #include "streetgraph.h"
 #include "road.h"
 #include "intersection.h"
+#include "intersectiongrid.h"
+#include "roadgrid.h"
+#include "facetracker.h"
+#include "streetgraphlistener.h"
 #include "../area/zone.h"
 #include "path.h"
 #include "areaextractor.h"
 #include "../lsystem/roadlsystem.h"
 #include "../geometry/polygon.h"
 #include "../geometry/linesegment.h"
+#include "../geometry/segmentsweep.h"
 #include "../geometry/point.h"
 #include "../geometry/vector.h"
 #include "../geometry/units.h"
@@ -26,6 +31,55 @@
 #include <set>
 #include <string>
 #include <sstream>
+#include <algorithm>
+
+namespace
+{
+  /** Slack for the spatial queries, geometric tests use tolerances. */
+  const double QUERY_MARGIN = 10 * libcity::COORDINATES_EPSILON;
+
+  /** Split points of a path, ends of the path don't split it. */
+  void addSplit(LineSegment const& segment, Point const& point, std::vector<Point>* splits)
+  {
+    if (!(point == segment.begining()) && !(point == segment.end()))
+    {
+      splits->push_back(point);
+    }
+  }
+
+  /** Ends of a collinear segment lying inside a path split it. */
+  void addOverlapSplits(LineSegment const& segment, LineSegment const& collinear, std::vector<Point>* splits)
+  {
+    if (segment.hasPoint2D(collinear.begining()))
+    {
+      addSplit(segment, collinear.begining(), splits);
+    }
+    if (segment.hasPoint2D(collinear.end()))
+    {
+      addSplit(segment, collinear.end(), splits);
+    }
+  }
+
+  /** Orders points along a path by their distance from its begining. */
+  struct CloserTo
+  {
+    CloserTo(Point const& origin) : origin(origin) {}
+
+    bool operator()(Point const& first, Point const& second) const
+    {
+      return squaredDistance(first) < squaredDistance(second);
+    }
+
+    double squaredDistance(Point const& point) const
+    {
+      double dx = point.x() - origin.x(),
+             dy = point.y() - origin.y();
+      return dx * dx + dy * dy;
+    }
+
+    Point origin;
+  };
+}
 
 StreetGraph::StreetGraph()
 {
@@ -36,6 +90,9 @@ void StreetGraph::initialize()
 {
   roads = new std::list<Road*>;
   intersections = new std::list<Intersection*>;
+  intersectionIndex = new IntersectionGrid();
+  roadIndex = new RoadGrid();
+  faceTracker = 0;
 }
 
 StreetGraph::~StreetGraph()
@@ -55,6 +112,9 @@ void StreetGraph::freeMemory()
     intersections->pop_back();
   }
   delete intersections;
+  delete intersectionIndex;
+  delete roadIndex;
+  delete faceTracker;
 
   while (!roads->empty())
   {
@@ -65,18 +125,19 @@ void StreetGraph::freeMemory()
   delete roads;
 }
 
-std::list<Zone*> StreetGraph::findZones()
+std::list<Zone*> StreetGraph::findZones(AreaExtractor::Algorithm algorithm)
 {
   debug("StreetGraph::findZones() passing " << intersections->size() << " intersections to MCB.");
   AreaExtractor graph;
+  graph.setAlgorithm(algorithm);
   return graph.extractZones(this);
 }
 
 Road* StreetGraph::getRoadBetweenIntersections(Intersection* first, Intersection* second)
 {
-  std::list<Road*> roadsOfFirst = first->getRoads();
+  Intersection::RoadRange roadsOfFirst = first->roadRange();
 
-  for (std::list<Road*>::iterator road = roadsOfFirst.begin();
+  for (Intersection::RoadRange::iterator road = roadsOfFirst.begin();
        road != roadsOfFirst.end();
        road++)
   {
@@ -91,30 +152,65 @@ Road* StreetGraph::getRoadBetweenIntersections(Intersection* first, Intersection
 }
 
 
+void StreetGraph::getRoadsNearPath(Path const& path, std::vector<Road*>* output)
+{
+  Point begining = path.begining(),
+        end      = path.end();
+
+  roadIndex->query(std::min(begining.x(), end.x()) - QUERY_MARGIN,
+                   std::min(begining.y(), end.y()) - QUERY_MARGIN,
+                   std::max(begining.x(), end.x()) + QUERY_MARGIN,
+                   std::max(begining.y(), end.y()) + QUERY_MARGIN,
+                   output);
+}
+
 void StreetGraph::addRoad(Path const& path, Road::Type roadType)
+{
+  insertRoad(path, roadType);
+  updateFaces();
+}
+
+void StreetGraph::insertRoad(Path const& path, Road::Type roadType)
 {
   Path roadPath(path);
   Point intersection;
-  for (StreetGraph::iterator currentRoad = begin();
-        currentRoad != end();
+  std::vector<Road*> nearbyRoads;
+  getRoadsNearPath(roadPath, &nearbyRoads);
+  for (std::vector<Road*>::iterator currentRoad = nearbyRoads.begin();
+        currentRoad != nearbyRoads.end();
         currentRoad++)
   {
     // Check for intersection
     LineSegment::Intersection intersectionResult = roadPath.crosses(*(*currentRoad)->path(), &intersection);
     if (intersectionResult == LineSegment::CONTAINED ||
         intersectionResult == LineSegment::IDENTICAL)
+    /* The road is there already, creating it only
+       splits the existing one at the ends of the path. */
     {
-      assert(false);
-    }
-    else if (intersectionResult == LineSegment::CONTAINING)
-    {
-      assert(false);
+      createRoad(roadPath.begining(), roadPath.end(), roadType);
+      return;
     }
-    else if (intersectionResult == LineSegment::OVERLAPING)
+    else if (intersectionResult == LineSegment::CONTAINING ||
+             intersectionResult == LineSegment::OVERLAPING)
+    /* Split the path at an end of the existing road, the
+       parts are then contained in it or just touch it. */
     {
-      assert(false);
+      Point ends[] = {(*currentRoad)->path()->begining(), (*currentRoad)->path()->end()};
+      for (int i = 0; i < 2; i++)
+      {
+        if (roadPath.goesThrough(ends[i]) &&
+            !(ends[i] == roadPath.begining()) && !(ends[i] == roadPath.end()))
+        {
+          Path firstPart(LineSegment(roadPath.begining(), ends[i])),
+               secondPart(LineSegment(ends[i], roadPath.end()));
+          insertRoad(firstPart, roadType);
+          insertRoad(secondPart, roadType);
+
+          return;
+        }
+      }
     }
-    if (intersectionResult == LineSegment::INTERSECTING)
+    else if (intersectionResult == LineSegment::INTERSECTING)
     {
 
       if (intersection == roadPath.begining() ||
@@ -126,74 +222,232 @@ void StreetGraph::addRoad(Path const& path, Road::Type roadType)
       {
         Path firstPart(LineSegment(roadPath.begining(), intersection)),
               secondPart(LineSegment(intersection, roadPath.end()));
-        addRoad(firstPart, roadType);
-        addRoad(secondPart, roadType);
+        insertRoad(firstPart, roadType);
+        insertRoad(secondPart, roadType);
 
         return;
       }
     }
   }
 
-  Intersection *begining = addIntersection(roadPath.begining());
-  Intersection *end = addIntersection(roadPath.end());
+  createRoad(roadPath.begining(), roadPath.end(), roadType);
+}
+
+void StreetGraph::addRoads(std::vector<Path> const& paths, Road::Type roadType)
+{
+  addRoads(paths, std::vector<Road::Type>(paths.size(), roadType));
+}
+
+void StreetGraph::addRoads(std::vector<Path> const& paths, std::vector<Road::Type> const& roadTypes)
+{
+  assert(paths.size() == roadTypes.size());
+
+  std::vector<LineSegment> segments;
+  segments.reserve(paths.size());
+  for (std::vector<Path>::const_iterator path = paths.begin();
+       path != paths.end();
+       path++)
+  {
+    segments.push_back(LineSegment(path->begining(), path->end()));
+  }
+
+  /* Find all the crossings before the graph changes. */
+  std::vector< std::vector<Point> > splits(paths.size());
+  std::vector<SegmentSweep::Crossing> crossings;
+  SegmentSweep(segments).findCrossings(&crossings);
+  for (std::vector<SegmentSweep::Crossing>::iterator crossing = crossings.begin();
+       crossing != crossings.end();
+       crossing++)
+  {
+    LineSegment const& first  = segments[crossing->first],
+                     & second = segments[crossing->second];
+    if (crossing->type == LineSegment::INTERSECTING)
+    {
+      addSplit(first, crossing->point, &splits[crossing->first]);
+      addSplit(second, crossing->point, &splits[crossing->second]);
+    }
+    else
+    /* Collinear, ends of each of them split the other one. */
+    {
+      addOverlapSplits(first, second, &splits[crossing->first]);
+      addOverlapSplits(second, first, &splits[crossing->second]);
+    }
+  }
+
+  std::vector<Road*> nearbyRoads;
+  Point intersection;
+  for (unsigned int i = 0; i < paths.size(); i++)
+  {
+    Path roadPath(paths[i]);
+    getRoadsNearPath(roadPath, &nearbyRoads);
+    for (std::vector<Road*>::iterator road = nearbyRoads.begin();
+         road != nearbyRoads.end();
+         road++)
+    {
+      LineSegment::Intersection result = roadPath.crosses(*(*road)->path(), &intersection);
+      if (result == LineSegment::INTERSECTING)
+      {
+        addSplit(segments[i], intersection, &splits[i]);
+      }
+      else if (result == LineSegment::CONTAINING || result == LineSegment::OVERLAPING)
+      {
+        addOverlapSplits(segments[i], LineSegment((*road)->path()->begining(), (*road)->path()->end()),
+                         &splits[i]);
+      }
+    }
+  }
+
+  /* Connect the parts of each path in order. */
+  for (unsigned int i = 0; i < paths.size(); i++)
+  {
+    Point begining = segments[i].begining();
+    std::sort(splits[i].begin(), splits[i].end(), CloserTo(begining));
+
+    Point previous = begining;
+    for (std::vector<Point>::iterator split = splits[i].begin();
+         split != splits[i].end();
+         split++)
+    {
+      if (*split == previous)
+      /* Crossed by more paths at once */
+      {
+        continue;
+      }
+      createRoad(previous, *split, roadTypes[i]);
+      previous = *split;
+    }
+    createRoad(previous, segments[i].end(), roadTypes[i]);
+  }
+
+  updateFaces();
+}
+
+void StreetGraph::addPlanarRoads(std::vector<Point> const& positions,
+                                 std::vector<int> const& beginings, std::vector<int> const& ends,
+                                 std::vector<Road::Type> const& roadTypes)
+{
+  assert(beginings.size() == ends.size() && beginings.size() == roadTypes.size());
+
+  std::vector<Intersection*> graphIntersections(positions.size());
+  for (unsigned int i = 0; i < positions.size(); i++)
+  {
+    Intersection* existing = intersectionIndex->find(positions[i]);
+    if (existing == 0)
+    {
+      existing = new Intersection(positions[i]);
+      intersections->push_back(existing);
+      intersectionIndex->insert(existing);
+    }
+    graphIntersections[i] = existing;
+  }
+
+  for (unsigned int i = 0; i < roadTypes.size(); i++)
+  {
+    Intersection *begining = graphIntersections[beginings[i]],
+                 *end = graphIntersections[ends[i]];
+
+    Road *newRoad = new Road(begining, end);
+    newRoad->setType(roadTypes[i]);
+
+    invalidateFaces(begining);
+    invalidateFaces(end);
+    begining->connectRoad(newRoad);
+    end->connectRoad(newRoad);
+
+    roads->push_back(newRoad);
+    roadIndex->insert(newRoad);
+  }
+
+  updateFaces();
+}
+
+void StreetGraph::createRoad(Point const& beginingPosition, Point const& endPosition, Road::Type roadType)
+{
+  Intersection *begining = addIntersection(beginingPosition);
+  Intersection *end = addIntersection(endPosition);
+
+  if (begining != end && getRoadBetweenIntersections(begining, end) != 0)
+  /* Road along an existing one, adding the intersections
+     was enough to split it. */
+  {
+    return;
+  }
 
   Road *newRoad = new Road(begining, end);
   newRoad->setType(roadType);
   //newRoad->setPath(roadPath);
 
   // Connect road to intersections
+  invalidateFaces(begining);
+  invalidateFaces(end);
   begining->connectRoad(newRoad);
   end->connectRoad(newRoad);
 
   roads->push_back(newRoad);
-  return;
+  roadIndex->insert(newRoad);
 }
 
 void StreetGraph::removeRoad(Road* road)
 {
   Intersection* begining = road->begining();
   Intersection* end = road->end();
+  std::vector<Intersection*> unused;
+
+  invalidateFaces(begining);
+  invalidateFaces(end);
 
   begining->disconnectRoad(road);
   if (begining->numberOfWays() == 0)
   {
+    intersectionIndex->remove(begining);
     intersections->remove(begining);
-    delete begining;
+    unused.push_back(begining);
   }
 
   end->disconnectRoad(road);
   if (end->numberOfWays() == 0)
   {
+    intersectionIndex->remove(end);
     intersections->remove(end);
-    delete end;
+    unused.push_back(end);
   }
 
-  
+  roadIndex->remove(road);
   roads->remove(road);
+
+  /* Listeners get the removed faces with valid intersections. */
+  updateFaces();
+  for (std::vector<Intersection*>::iterator intersection = unused.begin();
+       intersection != unused.end();
+       intersection++)
+  {
+    delete *intersection;
+  }
 }
 
 Intersection* StreetGraph::addIntersection(Point const& position)
 {
   /* Search for existing intersection. */
-  for (std::list<Intersection*>::iterator intersection = intersections->begin();
-       intersection != intersections->end();
-       intersection++)
+  Intersection *existing = intersectionIndex->find(position);
+  if (existing != 0)
   {
-    if ((*intersection)->position() == position)
-    {
-      return *intersection;
-    }
+    return existing;
   }
 
   /* There's no existing intersection at position. Create one */
   Intersection *newIntersection = new Intersection(position);
   intersections->push_back(newIntersection);
+  intersectionIndex->insert(newIntersection);
 
   //debug("StreetGraph::addIntersection(): Adding intersection Intersection " << newIntersection->position().toString());
 
   /* Check if the existing intersection crosses any existing road. */
-  for (std::list<Road*>::iterator road = roads->begin();
-       road != roads->end();
+  std::vector<Road*> nearbyRoads;
+  roadIndex->query(position.x() - QUERY_MARGIN, position.y() - QUERY_MARGIN,
+                   position.x() + QUERY_MARGIN, position.y() + QUERY_MARGIN,
+                   &nearbyRoads);
+  for (std::vector<Road*>::iterator road = nearbyRoads.begin();
+       road != nearbyRoads.end();
        road++)
   {
     if ((*road)->path()->goesThrough(position))
@@ -202,15 +456,19 @@ Intersection* StreetGraph::addIntersection(Point const& position)
       //debug("StreetGraph::addIntersection(): Splitting road for Intersection " << newIntersection->position().toString());
 
       Intersection *end = (*road)->end();
+      invalidateFaces((*road)->begining());
+      invalidateFaces(end);
       assert(!(LineSegment((*road)->begining()->position(), end->position()) == LineSegment(Point(-3000, -2509.3, 0), Point(-3000, -2244.59, 0))));
       end->disconnectRoad(*road);
 
       (*road)->setEnd(newIntersection);
       newIntersection->connectRoad(*road);
+      roadIndex->update(*road);
 
       Road* secondPart = new Road(newIntersection, end);
       secondPart->setType((*road)->type());
       roads->push_back(secondPart);
+      roadIndex->insert(secondPart);
 
       newIntersection->connectRoad(secondPart);
       end->connectRoad(secondPart);
@@ -235,36 +493,63 @@ StreetGraph::iterator StreetGraph::end()
   return roads->end();
 }
 
+StreetGraph::const_iterator StreetGraph::begin() const
+{
+  return roads->begin();
+}
+
+StreetGraph::const_iterator StreetGraph::end() const
+{
+  return roads->end();
+}
+
 bool StreetGraph::isIntersectionAtPosition(Point const& position)
 {
-  /* Search for existing intersection. */
-  for (std::list<Intersection*>::iterator intersection = intersections->begin();
-       intersection != intersections->end();
-       intersection++)
+  return intersectionIndex->find(position) != 0;
+}
+
+Intersection* StreetGraph::getIntersectionAtPosition(Point const& position)
+{
+  return intersectionIndex->find(position);
+}
+
+void StreetGraph::getRoadsInRadius(Point const& center, double radius, std::vector<Road*>* output)
+{
+  std::vector<Road*> candidates;
+  roadIndex->query(center.x() - radius - QUERY_MARGIN, center.y() - radius - QUERY_MARGIN,
+                   center.x() + radius + QUERY_MARGIN, center.y() + radius + QUERY_MARGIN,
+                   &candidates);
+
+  output->clear();
+  for (std::vector<Road*>::iterator road = candidates.begin();
+       road != candidates.end();
+       road++)
   {
-    if ((*intersection)->position() == position)
+    if ((*road)->path()->distance(center) <= radius)
     {
-      return true;
+      output->push_back(*road);
     }
   }
-
-  return false;
 }
 
-Intersection* StreetGraph::getIntersectionAtPosition(Point const& position)
+void StreetGraph::getIntersectionsInRadius(Point const& center, double radius,
+                                           std::vector<Intersection*>* output)
 {
-  /* Search for existing intersection. */
-  for (std::list<Intersection*>::iterator intersection = intersections->begin();
-       intersection != intersections->end();
+  std::vector<Intersection*> candidates;
+  intersectionIndex->query(center.x() - radius, center.y() - radius,
+                           center.x() + radius, center.y() + radius,
+                           &candidates);
+
+  output->clear();
+  for (std::vector<Intersection*>::iterator intersection = candidates.begin();
+       intersection != candidates.end();
        intersection++)
   {
-    if ((*intersection)->position() == position)
+    if (Vector(center, (*intersection)->position()).length() <= radius)
     {
-      return (*intersection);
+      output->push_back(*intersection);
     }
   }
-
-  return 0;
 }
 
 int StreetGraph::numberOfRoads()
@@ -272,6 +557,11 @@ int StreetGraph::numberOfRoads()
   return roads->size();
 }
 
+int StreetGraph::numberOfIntersections() const
+{
+  return intersections->size();
+}
+
 
 StreetGraph::Intersections StreetGraph::getIntersections()
 {
@@ -283,6 +573,16 @@ StreetGraph::Roads StreetGraph::getRoads()
   return *roads;
 }
 
+StreetGraph::IntersectionRange StreetGraph::intersectionRange() const
+{
+  return IntersectionRange(intersections->begin(), intersections->end());
+}
+
+StreetGraph::RoadRange StreetGraph::roadRange() const
+{
+  return RoadRange(roads->begin(), roads->end());
+}
+
 void StreetGraph::checkConsistence()
 {
   Point intersection;
@@ -359,6 +659,71 @@ void StreetGraph::removeFilamentRoads()
   }
 }
 
+void StreetGraph::setFaceTracking(bool enabled)
+{
+  if (enabled == (faceTracker != 0))
+  {
+    return;
+  }
+
+  if (!enabled)
+  {
+    delete faceTracker;
+    faceTracker = 0;
+    return;
+  }
+
+  faceTracker = new FaceTracker();
+  for (Intersections::iterator intersection = intersections->begin();
+       intersection != intersections->end();
+       intersection++)
+  {
+    faceTracker->invalidate(*intersection);
+  }
+  faceTracker->update(listeners);
+}
+
+bool StreetGraph::faceTracking()
+{
+  return faceTracker != 0;
+}
+
+std::vector<Face> StreetGraph::getFaces()
+{
+  if (faceTracker == 0)
+  {
+    return std::vector<Face>();
+  }
+
+  return faceTracker->faces();
+}
+
+void StreetGraph::addListener(StreetGraphListener* listener)
+{
+  listeners.push_back(listener);
+}
+
+void StreetGraph::removeListener(StreetGraphListener* listener)
+{
+  listeners.remove(listener);
+}
+
+void StreetGraph::invalidateFaces(Intersection* intersection)
+{
+  if (faceTracker != 0)
+  {
+    faceTracker->invalidate(intersection);
+  }
+}
+
+void StreetGraph::updateFaces()
+{
+  if (faceTracker != 0)
+  {
+    faceTracker->update(listeners);
+  }
+}
+
 std::string StreetGraph::toString()
 {
   std::stringstream output;
@@ -380,8 +745,8 @@ std::string StreetGraph::toString()
     output << "  " << (*intersection) << "\n";
     output << "    at " + (*intersection)->position().toString() + "\n";
 
-    Roads intersectionRoads = (*intersection)->getRoads();
-    for (Roads::iterator road = intersectionRoads.begin();
+    Intersection::RoadRange intersectionRoads = (*intersection)->roadRange();
+    for (Intersection::RoadRange::iterator road = intersectionRoads.begin();
       road != intersectionRoads.end();
       road++)
     {
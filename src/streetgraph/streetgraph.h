@@ -35,8 +35,15 @@ class Point;
 class Polygon;
 class Path;
 class LineSegment;
+class IntersectionGrid;
+class RoadGrid;
+class FaceTracker;
+class StreetGraphListener;
 
 #include "road.h"
+#include "face.h"
+#include "../range.h"
+#include "areaextractor.h"
 
 class StreetGraph
 {
@@ -48,15 +55,38 @@ class StreetGraph
     /** @{ */
     /** For iterating through the roads of StreetGraph. */
     typedef std::list<Road*>::iterator iterator;
+    typedef std::list<Road*>::const_iterator const_iterator;
     iterator begin();
     iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
     /** @} */
 
     typedef std::list<Intersection*> Intersections;
     typedef std::list<Road*> Roads;
 
+    typedef Range<Intersections::const_iterator> IntersectionRange;
+    typedef Range<Roads::const_iterator> RoadRange;
+
+    /** @{ */
+    /**
+      Copies of the intersections and roads.
+     @remarks
+       Safe to iterate while the graph is being modified.
+     */
     Intersections getIntersections();
     Roads getRoads();
+    /** @} */
+
+    /** @{ */
+    /**
+      Intersections and roads without copying.
+     @remarks
+       The ranges become invalid once the graph is modified.
+     */
+    IntersectionRange intersectionRange() const;
+    RoadRange roadRange() const;
+    /** @} */
 
     /**
       Find closed loops in the graph and form zones inside them.
@@ -70,9 +100,11 @@ class StreetGraph
        http://www.mpi-inf.mpg.de/~mehlhorn/ftp/MFCS07.pdf
        @see MinimalCycleBasis
 
+     @param[in] algorithm AreaExtractor::HALF_EDGE_FACES finds the
+                          same zones in a single walk over the faces.
      @return List of pointers to all zones found.
      */
-    std::list<Zone*> findZones();
+    std::list<Zone*> findZones(AreaExtractor::Algorithm algorithm = AreaExtractor::MINIMAL_CYCLE_BASIS);
 
     /**
       Add road that follows certain path into the StreetGraph.
@@ -80,12 +112,53 @@ class StreetGraph
        This method makes sure that the graph is planar so
        more than one road may be added at a time. If an
        intersection with an existing road is detected,
-       the new road is split into two.
+       the new road is split into two. Parts of the path
+       running along existing roads are not added again.
+     @note
+       Only roads near the new path are tested for crossing
+       (see RoadGrid), so the cost depends on the local density
+       of the graph rather than on its size.
 
      @param[in] path Path of the new road (low level part of the graph).
     */
     void addRoad(Path const& path, Road::Type roadTypes = Road::PRIMARY_ROAD);
 
+    /**
+      Add many roads at once.
+     @remarks
+       The resulting graph is the same as if the paths were
+       added one by one with addRoad(), only the order of the
+       roads in the graph may differ. Crossings of the new
+       paths among themselves are found by a single sweep
+       (see SegmentSweep) and crossings with the roads already
+       in the graph by the spatial index. Each path is then
+       split at all its crossings and the parts are connected
+       in one pass, without testing them again.
+
+     @param[in] paths     Paths of the new roads.
+     @param[in] roadTypes Type of each of the roads.
+    */
+    void addRoads(std::vector<Path> const& paths, std::vector<Road::Type> const& roadTypes);
+    void addRoads(std::vector<Path> const& paths, Road::Type roadType = Road::PRIMARY_ROAD);
+
+    /**
+      Add roads of a graph that is planar already.
+     @remarks
+       Nothing is tested for crossing, each road connects the
+       two given intersections directly. Positions where the
+       graph has an intersection reuse it. Meant for graphs
+       built by StreetGraph before (see CityFile), the new
+       roads must not cross each other or the existing roads.
+
+     @param[in] positions Positions of the intersections.
+     @param[in] beginings Index of the first intersection of each road.
+     @param[in] ends      Index of the second intersection of each road.
+     @param[in] roadTypes Type of each of the roads.
+    */
+    void addPlanarRoads(std::vector<Point> const& positions,
+                        std::vector<int> const& beginings, std::vector<int> const& ends,
+                        std::vector<Road::Type> const& roadTypes);
+
     /**
       Erase road from the StreetGraph.
      @remarks
@@ -105,10 +178,39 @@ class StreetGraph
        for statistical/debugging purposes only.
      */
     int numberOfRoads();
+    int numberOfIntersections() const;
 
+    /**
+      Look up intersection at certain position.
+     @remarks
+       Intersections are kept in a uniform grid index, so
+       the lookup takes constant expected time regardless
+       of the size of the graph. Positions are compared with
+       libcity::COORDINATES_EPSILON tolerance.
+     */
     bool isIntersectionAtPosition(Point const& position);
     Intersection* getIntersectionAtPosition(Point const& position);
 
+    /**
+      Get roads passing within a distance of a point.
+     @remarks
+       Roads are looked up in a spatial index, so only
+       the neighbourhood of the point is examined. The output
+       is in the same order as the roads are iterated over.
+
+     @param[in]  center Point of interest.
+     @param[in]  radius Maximal distance of a road path from the center.
+     @param[out] output Found roads, the vector is cleared first.
+     */
+    void getRoadsInRadius(Point const& center, double radius, std::vector<Road*>* output);
+
+    /**
+      Get intersections within a distance of a point.
+     @see getRoadsInRadius()
+     */
+    void getIntersectionsInRadius(Point const& center, double radius,
+                                  std::vector<Intersection*>* output);
+
     /**
       Get road that connects two intersections.
       If there's no such a road 0 is returned.
@@ -121,6 +223,28 @@ class StreetGraph
 
     void removeFilamentRoads();
 
+    /**
+      Maintain faces of the graph while it's edited.
+     @remarks
+       The faces are the same areas findZones() finds with
+       AreaExtractor::HALF_EDGE_FACES. With face tracking enabled,
+       addRoad() and removeRoad() update only the faces around
+       the edited roads and notify the listeners about them.
+       Enabling reports all current faces as added.
+     @see FaceTracker
+     */
+    void setFaceTracking(bool enabled);
+    bool faceTracking();
+
+    /** Current faces ordered by id, empty without face tracking. */
+    std::vector<Face> getFaces();
+
+    /** @{ */
+    /** Listeners are not owned by the graph. */
+    void addListener(StreetGraphListener* listener);
+    void removeListener(StreetGraphListener* listener);
+    /** @} */
+
     std::string toString();
 
   private:
@@ -130,6 +254,37 @@ class StreetGraph
     /** All roads in the street graph. */
     Roads* roads;
 
+    /** Spatial index of the intersections for fast lookup by position. */
+    IntersectionGrid* intersectionIndex;
+
+    /** Spatial index of the roads for crossing tests. */
+    RoadGrid* roadIndex;
+
+    /** Faces of the graph, 0 when face tracking is off. */
+    FaceTracker* faceTracker;
+    std::list<StreetGraphListener*> listeners;
+
+    /** Roads of the intersection are going to change. */
+    void invalidateFaces(Intersection* intersection);
+    void updateFaces();
+
+    /** addRoad() without updating the faces. */
+    void insertRoad(Path const& path, Road::Type roadType);
+
+    /**
+      Connect two points with a road that doesn't cross anything.
+     @remarks
+       Roads the points lie on are split by addIntersection().
+     */
+    void createRoad(Point const& begining, Point const& end, Road::Type roadType);
+
+    /**
+      Get roads that can cross a path.
+     @param[in]  path   Tested path.
+     @param[out] output Candidates in the order of roads list.
+     */
+    void getRoadsNearPath(Path const& path, std::vector<Road*>* output);
+
     /**
       Method for adding new intersections to the graph.
      @remarks
@@ -0,0 +1,34 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file streetgraph/streetgraphlistener.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Notifications about changes of StreetGraph faces
+ *
+ * Register the listener with StreetGraph::addListener() and
+ * enable StreetGraph::setFaceTracking(). After every addRoad()
+ * or removeRoad() the listener is told which faces disappeared
+ * and which were created. Faces that the edit didn't change
+ * are not reported.
+ *
+ * Removed faces are reported first, their boundary intersections
+ * are still valid during the call.
+ */
+
+#ifndef _STREETGRAPHLISTENER_H_
+#define _STREETGRAPHLISTENER_H_
+
+class Face;
+
+class StreetGraphListener
+{
+  public:
+    virtual ~StreetGraphListener() {}
+
+    virtual void faceAdded(Face const& /*face*/) {}
+    virtual void faceRemoved(Face const& /*face*/) {}
+};
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file threadpool.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see threadpool.h
+ *
+ */
+
+#include "threadpool.h"
+
+int ThreadPool::hardwareThreads()
+{
+  int threads = std::thread::hardware_concurrency();
+  return threads < 1 ? 1 : threads;
+}
+
+ThreadPool::ThreadPool(int numberOfThreads)
+  : ranges(new Range[numberOfThreads < 1 ? 1 : numberOfThreads]),
+    currentTask(0), runningWorkers(0), batch(0), busy(false), stopping(false)
+{
+  for (int slot = 1; slot < numberOfThreads; slot++)
+  {
+    workers.push_back(std::thread(&ThreadPool::workerLoop, this, slot));
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    stopping = true;
+  }
+  batchStarted.notify_all();
+
+  for (std::vector<std::thread>::iterator worker = workers.begin();
+       worker != workers.end();
+       worker++)
+  {
+    worker->join();
+  }
+}
+
+int ThreadPool::size() const
+{
+  return workers.size() + 1;
+}
+
+void ThreadPool::run(int count, Task const& task)
+{
+  std::unique_lock<std::mutex> guard(lock);
+  if (workers.empty() || busy || count < 2)
+  /* Nothing to share or nested batch, do it here */
+  {
+    guard.unlock();
+    for (int index = 0; index < count; index++)
+    {
+      task(index);
+    }
+    return;
+  }
+
+  busy = true;
+  currentTask = &task;
+  for (int slot = 0; slot < size(); slot++)
+  {
+    std::lock_guard<std::mutex> rangeGuard(ranges[slot].lock);
+    ranges[slot].next = (long long)count * slot / size();
+    ranges[slot].end  = (long long)count * (slot + 1) / size();
+  }
+  runningWorkers = workers.size();
+  batch++;
+  guard.unlock();
+  batchStarted.notify_all();
+
+  work(0);
+
+  guard.lock();
+  while (runningWorkers > 0)
+  {
+    batchFinished.wait(guard);
+  }
+  currentTask = 0;
+  busy = false;
+}
+
+void ThreadPool::workerLoop(int slot)
+{
+  unsigned long finishedBatch = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      while (!stopping && batch == finishedBatch)
+      {
+        batchStarted.wait(guard);
+      }
+
+      if (stopping)
+      {
+        return;
+      }
+      finishedBatch = batch;
+    }
+
+    work(slot);
+
+    std::lock_guard<std::mutex> guard(lock);
+    if (--runningWorkers == 0)
+    {
+      batchFinished.notify_one();
+    }
+  }
+}
+
+void ThreadPool::work(int slot)
+{
+  int task;
+  do
+  {
+    while (takeTask(slot, &task))
+    {
+      (*currentTask)(task);
+    }
+  }
+  while (stealTasks(slot));
+}
+
+bool ThreadPool::takeTask(int slot, int* task)
+{
+  std::lock_guard<std::mutex> guard(ranges[slot].lock);
+  if (ranges[slot].next >= ranges[slot].end)
+  {
+    return false;
+  }
+
+  *task = ranges[slot].next++;
+  return true;
+}
+
+bool ThreadPool::stealTasks(int slot)
+{
+  /* Victim with the most work left. Ranges only shrink until the
+     batch ends, so a stale size is just a worse choice. */
+  int victim = -1, mostLeft = 0;
+  for (int other = 0; other < size(); other++)
+  {
+    if (other == slot)
+    {
+      continue;
+    }
+
+    std::lock_guard<std::mutex> guard(ranges[other].lock);
+    int left = ranges[other].end - ranges[other].next;
+    if (left > mostLeft)
+    {
+      victim = other;
+      mostLeft = left;
+    }
+  }
+
+  if (victim < 0)
+  {
+    return false;
+  }
+
+  int begining, end;
+  {
+    std::lock_guard<std::mutex> guard(ranges[victim].lock);
+    int left = ranges[victim].end - ranges[victim].next;
+    if (left <= 0)
+    /* Someone was faster, look again */
+    {
+      return true;
+    }
+
+    end = ranges[victim].end;
+    begining = end - (left + 1) / 2;
+    ranges[victim].end = begining;
+  }
+
+  std::lock_guard<std::mutex> guard(ranges[slot].lock);
+  ranges[slot].next = begining;
+  ranges[slot].end = end;
+  return true;
+}
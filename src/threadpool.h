@@ -0,0 +1,84 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file threadpool.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Fixed set of worker threads for data parallel loops
+ *
+ * ThreadPool runs a batch of indexed tasks, task(0) ... task(n - 1),
+ * and returns when all of them are done. The calling thread takes
+ * part in the work, so a pool of N threads starts only N - 1
+ * workers.
+ *
+ * The indices are split into a contiguous range per thread. Each
+ * thread takes tasks from the front of its own range and when it
+ * runs out, it steals the back half of the largest range left.
+ * Neighbouring tasks thus mostly run on the same thread and uneven
+ * tasks (zones with many blocks, ...) are still balanced.
+ *
+ * The tasks must not depend on the order in which they are run
+ * or on the thread that runs them. A batch started while the
+ * pool is busy (e.g. from inside of a task) is run serially by
+ * the calling thread.
+ */
+
+#ifndef _THREADPOOL_H_
+#define _THREADPOOL_H_
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <functional>
+#include <condition_variable>
+
+class ThreadPool
+{
+  public:
+    typedef std::function<void (int)> Task;
+
+    /** Number of threads the hardware runs concurrently (at least 1). */
+    static int hardwareThreads();
+
+    ThreadPool(int numberOfThreads = hardwareThreads());
+    ~ThreadPool();
+
+    int size() const; /**< Number of threads including the caller */
+
+    /** Run task for indices 0 .. count - 1 and wait for them. */
+    void run(int count, Task const& task);
+
+  private:
+    ThreadPool(ThreadPool const&);
+    ThreadPool& operator=(ThreadPool const&);
+
+    /** Not yet started tasks of one thread, [next, end). */
+    struct Range
+    {
+      std::mutex lock;
+      int next;
+      int end;
+    };
+
+    void workerLoop(int slot);
+    void work(int slot);
+    bool takeTask(int slot, int* task);
+    bool stealTasks(int slot);
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<Range[]> ranges; /**< One for each thread, the caller is 0 */
+
+    std::mutex lock;
+    std::condition_variable batchStarted;
+    std::condition_variable batchFinished;
+
+    Task const* currentTask;
+    int runningWorkers;
+    unsigned long batch; /**< Number of started batches */
+    bool busy;
+    bool stopping;
+};
+
+#endif
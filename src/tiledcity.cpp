@@ -0,0 +1,304 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file tiledcity.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @see tiledcity.h
+ *
+ */
+
+#include "tiledcity.h"
+
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+
+#include "city.h"
+#include "random.h"
+#include "threadpool.h"
+#include "streetgraph/streetgraph.h"
+#include "streetgraph/path.h"
+#include "geometry/polygon.h"
+#include "geometry/linesegment.h"
+#include "geometry/point.h"
+#include "geometry/units.h"
+#include "io/cityfile.h"
+
+namespace
+{
+  /** Ports are placed in the middle of their slots on the edge. */
+  const double PORT_JITTER_MIN = 0.3;
+  const double PORT_JITTER_MAX = 0.7;
+
+  bool onLine(double coordinate, double line)
+  {
+    return std::fabs(coordinate - line) < libcity::COORDINATES_EPSILON;
+  }
+}
+
+TiledCity::TiledCity(int numberOfColumns, int numberOfRows, double tileSize, CityFactory const& cityFactory)
+  : columns(numberOfColumns), rows(numberOfRows), size(tileSize), factory(cityFactory),
+    seed(libcity::RANDOM_SEED), haloWidth(tileSize / 20), portSpacing(tileSize / 5), threads(1)
+{}
+
+TiledCity::~TiledCity()
+{}
+
+void TiledCity::setSeed(unsigned long long masterSeed)
+{
+  seed = masterSeed;
+}
+
+void TiledCity::setHalo(double width)
+{
+  haloWidth = std::min(std::max(width, 0.0), size / 4);
+}
+
+double TiledCity::halo() const
+{
+  return haloWidth;
+}
+
+void TiledCity::setPortSpacing(double spacing)
+{
+  portSpacing = std::max(spacing, libcity::SNAP_DISTANCE);
+}
+
+void TiledCity::setNumberOfThreads(int numberOfThreads)
+{
+  threads = numberOfThreads < 1 ? 1 : numberOfThreads;
+}
+
+int TiledCity::numberOfThreads() const
+{
+  return threads;
+}
+
+int TiledCity::numberOfColumns() const
+{
+  return columns;
+}
+
+int TiledCity::numberOfRows() const
+{
+  return rows;
+}
+
+double TiledCity::tileSize() const
+{
+  return size;
+}
+
+Polygon TiledCity::tileArea(int column, int row) const
+{
+  double left = column * size, bottom = row * size,
+         right = (column + 1) * size, top = (row + 1) * size;
+  return Polygon(Point(left, bottom), Point(right, bottom), Point(right, top), Point(left, top));
+}
+
+Polygon TiledCity::innerArea(int column, int row) const
+{
+  double left = column * size + haloWidth, bottom = row * size + haloWidth,
+         right = (column + 1) * size - haloWidth, top = (row + 1) * size - haloWidth;
+  return Polygon(Point(left, bottom), Point(right, bottom), Point(right, top), Point(left, top));
+}
+
+unsigned long long TiledCity::tileSeed(int column, int row) const
+{
+  return CounterRandom(seed).generate(column, row);
+}
+
+void TiledCity::edgePoints(Orientation orientation, int column, int row, std::vector<Point>* output) const
+{
+  output->clear();
+
+  /* Both neighbors compute the points with the same expressions */
+  double x = column * size, y = row * size;
+  output->push_back(Point(x, y));
+
+  bool shared = orientation == VERTICAL ? column > 0 && column < columns
+                                        : row > 0 && row < rows;
+  if (shared)
+  {
+    CounterRandom generator(seed);
+    unsigned long long edge = (static_cast<unsigned long long>(orientation + 1) << 40) |
+                              (static_cast<unsigned long long>(column) << 20) | row;
+    int numberOfPorts = std::max(static_cast<int>(size / portSpacing), 1);
+    for (int port = 0; port < numberOfPorts; port++)
+    {
+      double offset = (port + generator.generateDouble(edge, port, PORT_JITTER_MIN, PORT_JITTER_MAX))
+                      * size / numberOfPorts;
+      output->push_back(orientation == VERTICAL ? Point(x, y + offset) : Point(x + offset, y));
+    }
+  }
+
+  output->push_back(orientation == VERTICAL ? Point(x, y + size) : Point(x + size, y));
+}
+
+void TiledCity::ports(int column, int row, std::vector<Point>* output) const
+{
+  output->clear();
+
+  std::vector<Point> points;
+  Orientation orientations[] = {VERTICAL, VERTICAL, HORIZONTAL, HORIZONTAL};
+  int edgeColumns[] = {column, column + 1, column, column};
+  int edgeRows[] = {row, row, row, row + 1};
+  for (int edge = 0; edge < 4; edge++)
+  {
+    edgePoints(orientations[edge], edgeColumns[edge], edgeRows[edge], &points);
+    output->insert(output->end(), points.begin() + 1, points.end() - 1);
+  }
+}
+
+void TiledCity::createSeams(int column, int row, StreetGraph* graph) const
+{
+  std::vector<Path> paths;
+  std::vector<Point> connectorEnds;
+  seams(column, row, &paths, &connectorEnds);
+  graph->addRoads(paths, Road::PRIMARY_ROAD);
+}
+
+void TiledCity::seams(int column, int row, std::vector<Path>* paths, std::vector<Point>* connectorEnds) const
+{
+  paths->clear();
+  connectorEnds->clear();
+  std::vector<Point> points;
+
+  /* West, east, south and north edge with the direction into the tile */
+  Orientation orientations[] = {VERTICAL, VERTICAL, HORIZONTAL, HORIZONTAL};
+  int edgeColumns[] = {column, column + 1, column, column};
+  int edgeRows[] = {row, row, row, row + 1};
+  double inwardX[] = {1, -1, 0, 0};
+  double inwardY[] = {0, 0, 1, -1};
+  for (int edge = 0; edge < 4; edge++)
+  {
+    edgePoints(orientations[edge], edgeColumns[edge], edgeRows[edge], &points);
+    for (unsigned int i = 0; i + 1 < points.size(); i++)
+    {
+      paths->push_back(Path(LineSegment(points[i], points[i + 1])));
+    }
+
+    for (unsigned int i = 1; i + 1 < points.size(); i++)
+    {
+      Point inside(points[i].x() + inwardX[edge] * haloWidth, points[i].y() + inwardY[edge] * haloWidth);
+      paths->push_back(Path(LineSegment(points[i], inside)));
+      connectorEnds->push_back(inside);
+    }
+  }
+}
+
+bool TiledCity::generateTile(int column, int row, std::string const& fileName)
+{
+  std::vector<Path> paths;
+  std::vector<Point> connectorEnds;
+  seams(column, row, &paths, &connectorEnds);
+
+  City* city = factory(innerArea(column, row));
+  city->setSeed(tileSeed(column, row));
+  city->streetGraph()->addRoads(paths, Road::PRIMARY_ROAD);
+  city->setConnections(connectorEnds);
+  city->generate();
+
+  bool saved = city->save(fileName);
+  delete city;
+  return saved;
+}
+
+bool TiledCity::generate(std::string const& directory)
+{
+  int numberOfTiles = columns * rows;
+  std::vector<char> saved(numberOfTiles, false);
+  ThreadPool::Task task = [&](int tile)
+  {
+    int column = tile % columns, row = tile / columns;
+    saved[tile] = generateTile(column, row, tileFileName(directory, column, row));
+  };
+
+  if (threads < 2)
+  {
+    for (int tile = 0; tile < numberOfTiles; tile++)
+    {
+      task(tile);
+    }
+  }
+  else
+  {
+    ThreadPool pool(threads);
+    pool.run(numberOfTiles, task);
+  }
+
+  for (int tile = 0; tile < numberOfTiles; tile++)
+  {
+    if (!saved[tile])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string TiledCity::tileFileName(std::string const& directory, int column, int row)
+{
+  std::stringstream name;
+  name << directory << "/tile_" << column << "_" << row << ".city";
+  return name.str();
+}
+
+bool TiledCity::loadStreetGraph(std::string const& directory, StreetGraph* graph) const
+{
+  std::vector<Path> seamPaths;
+  std::vector<Road::Type> seamTypes;
+
+  for (int row = 0; row < rows; row++)
+  {
+    for (int column = 0; column < columns; column++)
+    {
+      CityFile file;
+      if (!file.open(tileFileName(directory, column, row)))
+      {
+        return false;
+      }
+
+      std::vector<Point> positions;
+      positions.reserve(file.numberOfIntersections());
+      for (int intersection = 0; intersection < file.numberOfIntersections(); intersection++)
+      {
+        positions.push_back(Point(file.intersectionsX()[intersection],
+                                  file.intersectionsY()[intersection],
+                                  file.intersectionsZ()[intersection]));
+      }
+
+      double left = column * size, bottom = row * size,
+             right = (column + 1) * size, top = (row + 1) * size;
+      std::vector<int> beginings, ends;
+      std::vector<Road::Type> types;
+      for (int road = 0; road < file.numberOfRoads(); road++)
+      {
+        Point const& begining = positions[file.roadsBeginings()[road]];
+        Point const& end = positions[file.roadsEnds()[road]];
+        bool seam = (onLine(begining.x(), left)   && onLine(end.x(), left))   ||
+                    (onLine(begining.x(), right)  && onLine(end.x(), right))  ||
+                    (onLine(begining.y(), bottom) && onLine(end.y(), bottom)) ||
+                    (onLine(begining.y(), top)    && onLine(end.y(), top));
+        if (seam)
+        {
+          seamPaths.push_back(Path(LineSegment(begining, end)));
+          seamTypes.push_back(file.roadsTypes()[road]);
+        }
+        else
+        {
+          beginings.push_back(file.roadsBeginings()[road]);
+          ends.push_back(file.roadsEnds()[road]);
+          types.push_back(file.roadsTypes()[road]);
+        }
+      }
+
+      graph->addPlanarRoads(positions, beginings, ends, types);
+    }
+  }
+
+  graph->addRoads(seamPaths, seamTypes);
+  return true;
+}
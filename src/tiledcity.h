@@ -0,0 +1,163 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file tiledcity.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief City generated tile by tile
+ *
+ * The world is a grid of square tiles and each of them is an
+ * independent City created by a factory. A finished tile is saved
+ * to a CityFile and freed, so the memory used depends on the size
+ * of a tile and the number of threads, not on the size of the
+ * whole city.
+ *
+ * Tiles are stitched by construction. Every tile gets seam roads
+ * along its border and connectors, short roads leading from ports
+ * on the border into the tile. Positions of the ports depend only
+ * on the master seed and the edge, so both neighbors of an edge
+ * put them to the very same places. The city of a tile grows its
+ * roads in the tile shrunk by the halo, the strip along the border
+ * is left to the connectors and the roads can't reach the seam.
+ * The inner end of each connector is joined to the nearest
+ * intersection of the primary roads (see City::setConnections()),
+ * so the roads of neighboring tiles are connected through the
+ * ports.
+ *
+ * Each tile has its own seed derived from the master seed and its
+ * position. Tiles can be generated in any order, in parallel or in
+ * separate processes (see generateTile()), the result is the same.
+ *
+ * @code
+ *   TiledCity city(8, 8, 5000, [](Polygon const& area) { return new MyCity(area); });
+ *   city.setNumberOfThreads(4);
+ *   city.generate("tiles");
+ * @endcode
+ */
+
+#ifndef _TILEDCITY_H_
+#define _TILEDCITY_H_
+
+#include <string>
+#include <vector>
+#include <functional>
+
+class City;
+class StreetGraph;
+class Polygon;
+class Point;
+class Path;
+
+class TiledCity
+{
+  public:
+    /**
+      Creates the city of a tile.
+     @param[in] area Where the city may grow its roads. The seam
+                     roads and connectors will be in its street
+                     graph and the connector ends set as its
+                     connections before City::generate() is called.
+     */
+    typedef std::function<City* (Polygon const& area)> CityFactory;
+
+    /** Tile (column, row) covers [column, column + 1] x [row, row + 1] times tileSize. */
+    TiledCity(int columns, int rows, double tileSize, CityFactory const& factory);
+    ~TiledCity();
+
+    void setSeed(unsigned long long masterSeed);
+
+    /** Width of the strip along the border kept for connectors, a twentieth of a tile by default. */
+    void setHalo(double width);
+    double halo() const;
+
+    /**
+      Average distance of the ports on an edge, a fifth of a tile by default.
+      At least libcity::SNAP_DISTANCE, nearer ports would snap together.
+     */
+    void setPortSpacing(double spacing);
+
+    /** Number of tiles generated at once by generate(), 1 by default. */
+    void setNumberOfThreads(int threads);
+    int numberOfThreads() const;
+
+    int numberOfColumns() const;
+    int numberOfRows() const;
+    double tileSize() const;
+
+    Polygon tileArea(int column, int row) const;
+
+    /** Tile without the halo, where the city of the tile grows. */
+    Polygon innerArea(int column, int row) const;
+
+    /** Ports on the border of the tile, none on the border of the world. */
+    void ports(int column, int row, std::vector<Point>* output) const;
+
+    /** Add the seam roads and the connectors of the tile to the graph. */
+    void createSeams(int column, int row, StreetGraph* graph) const;
+
+    /**
+      Generate a single tile and save it.
+     @return False if the file couldn't be written.
+     */
+    bool generateTile(int column, int row, std::string const& fileName);
+
+    /**
+      Generate all the tiles into files named by tileFileName().
+     @remarks
+       The directory must exist. Up to numberOfThreads() tiles
+       are generated at once, each one is freed once it's saved.
+     @return False if any of the files couldn't be written.
+     */
+    bool generate(std::string const& directory);
+
+    static std::string tileFileName(std::string const& directory, int column, int row);
+
+    /**
+      Merge the saved tiles into one street graph.
+     @remarks
+       Roads inside the tiles are added as they are (see
+       StreetGraph::addPlanarRoads()). Seam roads are saved by
+       both neighbors, possibly split at different places, so
+       they are added together by StreetGraph::addRoads() at
+       the end and each piece of a seam appears once.
+     @return False if a file couldn't be read.
+     */
+    bool loadStreetGraph(std::string const& directory, StreetGraph* graph) const;
+
+  private: /* Copying not allowed */
+    TiledCity(TiledCity const& source);
+    TiledCity& operator=(TiledCity const& source);
+
+    int columns;
+    int rows;
+    double size;
+    CityFactory factory;
+
+    unsigned long long seed;
+    double haloWidth;
+    double portSpacing;
+    int threads;
+
+    enum Orientation
+    {
+      VERTICAL,   /**< Edge at x = column * size, left of the tile. */
+      HORIZONTAL  /**< Edge at y = row * size, below the tile. */
+    };
+
+    /**
+      Points of an edge from its lower or left corner to the other
+      one, the ports between them if the edge is shared by two tiles.
+     */
+    void edgePoints(Orientation orientation, int column, int row, std::vector<Point>* output) const;
+
+    /**
+      Seam roads and connectors of a tile.
+     @param[out] connectorEnds Inner ends of the connectors, on the border of the inner area.
+     */
+    void seams(int column, int row, std::vector<Path>* paths, std::vector<Point>* connectorEnds) const;
+
+    unsigned long long tileSeed(int column, int row) const;
+};
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/temporary.h
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Temporary files and directories for the unit tests
+ *
+ * Both are created in /tmp and removed when they go out
+ * of scope, together with whatever a test wrote in them.
+ */
+
+#ifndef _TEMPORARY_H_
+#define _TEMPORARY_H_
+
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <dirent.h>
+
+/** Temporary file, removed at the end of the test. */
+class TemporaryFile
+{
+  public:
+    /** @param[in] text Initial contents of the file. */
+    TemporaryFile(std::string const& text = "")
+    {
+      char name[] = "/tmp/libcityXXXXXX";
+      descriptor = mkstemp(name);
+      fileName = name;
+      if (write(descriptor, text.data(), text.size()) != static_cast<ssize_t>(text.size()))
+      {
+        fileName.clear();
+      }
+    }
+
+    ~TemporaryFile()
+    {
+      close(descriptor);
+      std::remove(fileName.c_str());
+    }
+
+    /** Everything written to the file so far. */
+    std::string contents()
+    {
+      std::string text;
+      char buffer[4096];
+      ssize_t length;
+      lseek(descriptor, 0, SEEK_SET);
+      while ((length = read(descriptor, buffer, sizeof(buffer))) > 0)
+      {
+        text.append(buffer, length);
+      }
+      return text;
+    }
+
+    int descriptor;
+    std::string fileName; /**< Empty if the initial text wasn't written. */
+
+  private: /* Copying not allowed */
+    TemporaryFile(TemporaryFile const& source);
+    TemporaryFile& operator=(TemporaryFile const& source);
+};
+
+/** Temporary directory, removed with the files in it. */
+class TemporaryDirectory
+{
+  public:
+    TemporaryDirectory()
+    {
+      char name[] = "/tmp/libcityXXXXXX";
+      path = mkdtemp(name);
+    }
+
+    ~TemporaryDirectory()
+    {
+      DIR* directory = opendir(path.c_str());
+      if (directory != 0)
+      {
+        struct dirent* entry;
+        while ((entry = readdir(directory)) != 0)
+        {
+          std::string name = entry->d_name;
+          if (name != "." && name != "..")
+          {
+            std::remove((path + "/" + name).c_str());
+          }
+        }
+        closedir(directory);
+      }
+      rmdir(path.c_str());
+    }
+
+    std::string path;
+
+  private: /* Copying not allowed */
+    TemporaryDirectory(TemporaryDirectory const& source);
+    TemporaryDirectory& operator=(TemporaryDirectory const& source);
+};
+
+#endif
@@ -23,6 +23,9 @@
 #include "../src/streetgraph/streetgraph.h"
 #include "../src/streetgraph/areaextractor.h"
 #include "../src/streetgraph/rasterroadpattern.h"
+#include "../src/streetgraph/organicroadpattern.h"
+#include "../src/streetgraph/planarfaces.h"
+#include "../src/random.h"
 #include "../src/geometry/polygon.h"
 #include "../src/area/block.h"
 #include "../src/area/zone.h"
@@ -32,6 +35,67 @@
 #include "../src/geometry/linesegment.h"
 #include "../src/debug.h"
 
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  typedef std::vector< std::pair<double, double> > Outline;
+
+  /** Outlines of areas starting at their lowest vertex, sorted. */
+  template <typename AreaType>
+  std::vector<Outline> outlines(std::list<AreaType*> const& areas)
+  {
+    std::vector<Outline> result;
+    for (typename std::list<AreaType*>::const_iterator area = areas.begin();
+         area != areas.end();
+         area++)
+    {
+      Polygon constraints = (*area)->areaConstraints();
+      Outline outline;
+      for (unsigned int i = 0; i < constraints.numberOfVertices(); i++)
+      {
+        outline.push_back(std::make_pair(constraints.vertex(i).x(), constraints.vertex(i).y()));
+      }
+      std::rotate(outline.begin(), std::min_element(outline.begin(), outline.end()), outline.end());
+      result.push_back(outline);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  /** Neighbours given directly by their positions. */
+  struct Itself
+  {
+    Point const& operator()(Point const& point) const
+    {
+      return point;
+    }
+  };
+
+  /** Compare areas found by both algorithms. */
+  void checkHalfEdgeFaces(StreetGraph* sg, Zone* zone, int expectedZones)
+  {
+    AreaExtractor mcb;
+    AreaExtractor faces;
+    faces.setAlgorithm(AreaExtractor::HALF_EDGE_FACES);
+    mcb.setRoadWidth(Road::PRIMARY_ROAD, 10);
+    faces.setRoadWidth(Road::PRIMARY_ROAD, 10);
+
+    std::list<Zone*> mcbZones = mcb.extractZones(sg, zone),
+                     faceZones = faces.extractZones(sg, zone);
+    if (expectedZones >= 0)
+    {
+      CHECK_EQUAL(expectedZones, static_cast<int>(faceZones.size()));
+    }
+    CHECK(outlines(mcbZones) == outlines(faceZones));
+
+    std::list<Block*> mcbBlocks = mcb.extractBlocks(sg, zone),
+                      faceBlocks = faces.extractBlocks(sg, zone);
+    CHECK(outlines(mcbBlocks) == outlines(faceBlocks));
+  }
+}
+
 SUITE(MCBClass)
 {
   TEST(OneCycle)
@@ -153,4 +217,160 @@ SUITE(MCBClass)
     std::list<Block*> cycles = mcb->extractBlocks(sg, zone);
     CHECK(2 == cycles.size());
   }
-}
\ No newline at end of file
+
+  TEST(UnknownRoadWidth)
+  {
+    StreetGraph sg;
+    Road::Type imported = Road::defineNewRoadType();
+    sg.addRoad(Path(LineSegment(Point(0,0), Point(200,0))), imported);
+    sg.addRoad(Path(LineSegment(Point(200,0), Point(200,200))), imported);
+    sg.addRoad(Path(LineSegment(Point(200,200), Point(0,200))), imported);
+    sg.addRoad(Path(LineSegment(Point(0,200), Point(0,0))), Road::PRIMARY_ROAD);
+
+    /* The imported roads have no width, they must not grow the block. */
+    AreaExtractor extractor;
+    extractor.setRoadWidth(Road::PRIMARY_ROAD, 10);
+    std::list<Block*> blocks = extractor.extractBlocks(&sg);
+    CHECK_EQUAL(1u, blocks.size());
+    if (!blocks.empty())
+    {
+      CHECK_CLOSE(190 * 200, blocks.front()->areaConstraints().area(), 1);
+    }
+
+    AreaExtractor zeroWidth;
+    zeroWidth.setRoadWidth(Road::PRIMARY_ROAD, 10);
+    zeroWidth.setRoadWidth(imported, 0);
+    CHECK(outlines(blocks) == outlines(zeroWidth.extractBlocks(&sg)));
+  }
+
+  TEST(ExtractionOrder)
+  {
+    StreetGraph *sg = new StreetGraph();
+
+    /* 3x3 square lattice, vertices share x coordinates. */
+    for (int i = 0; i <= 3; i++)
+    {
+      sg->addRoad(Path(LineSegment(Point(i*100,0), Point(i*100,300))));
+      sg->addRoad(Path(LineSegment(Point(0,i*100), Point(300,i*100))));
+    }
+
+    AreaExtractor mcb;
+    std::list<Zone*> cycles = mcb.extractZones(sg);
+    CHECK(9 == cycles.size());
+
+    /* Zones are found column by column from the bottom,
+       each one starting at its lower left vertex. */
+    Point expected[] = {Point(0,0), Point(0,100), Point(0,200),
+                        Point(100,0), Point(100,100), Point(100,200)};
+    std::list<Zone*>::iterator zone = cycles.begin();
+    for (unsigned int i = 0; i < sizeof(expected)/sizeof(expected[0]); i++, zone++)
+    {
+      CHECK(expected[i] == (*zone)->areaConstraints().vertex(0));
+    }
+  }
+
+  TEST(HalfEdgeFaces)
+  {
+    StreetGraph *sg = new StreetGraph();
+
+    /* 2x2 squares */
+    for (int i = 0; i <= 2; i++)
+    {
+      sg->addRoad(Path(LineSegment(Point(i*100,0), Point(i*100,200))));
+      sg->addRoad(Path(LineSegment(Point(0,i*100), Point(200,i*100))));
+    }
+
+    /* Dead ends inside a square and outside of the grid. */
+    sg->addRoad(Path(LineSegment(Point(0,50), Point(30,50))));
+    sg->addRoad(Path(LineSegment(Point(200,50), Point(260,50))));
+    sg->addRoad(Path(LineSegment(Point(260,50), Point(260,80))));
+
+    /* Square hanging on a bridge, detached square */
+    sg->addRoad(Path(LineSegment(Point(200,150), Point(300,150))));
+    sg->addRoad(Path(LineSegment(Point(300,150), Point(300,250))));
+    sg->addRoad(Path(LineSegment(Point(300,250), Point(400,250))));
+    sg->addRoad(Path(LineSegment(Point(400,250), Point(400,150))));
+    sg->addRoad(Path(LineSegment(Point(400,150), Point(300,150))));
+
+    sg->addRoad(Path(LineSegment(Point(-300,0), Point(-200,0))));
+    sg->addRoad(Path(LineSegment(Point(-200,0), Point(-200,100))));
+    sg->addRoad(Path(LineSegment(Point(-200,100), Point(-300,0))));
+
+    checkHalfEdgeFaces(sg, 0, 6);
+
+    Polygon constraints;
+    constraints.addVertex(Point(-1,-1));
+    constraints.addVertex(Point(201,-1));
+    constraints.addVertex(Point(201,201));
+    constraints.addVertex(Point(-1,201));
+    Zone zone(sg);
+    zone.setAreaConstraints(constraints);
+    checkHalfEdgeFaces(sg, &zone, 4);
+  }
+
+  TEST(HalfEdgeFacesOfGeneratedRoads)
+  {
+    StreetGraph *sg = new StreetGraph();
+    RasterRoadPattern generator;
+    generator.setTarget(sg);
+    generator.setRoadLength(200, 400);
+    generator.setSnapDistance(50);
+    generator.setAreaConstraints(new Polygon(Point(-3000,-3000), Point(3000,-3000),
+                                             Point(3000,3000), Point(-3000,3000)));
+    generator.generateRoads(300);
+
+    checkHalfEdgeFaces(sg, 0, -1);
+  }
+
+  TEST(HalfEdgeFacesOfLargeGraphs)
+  {
+    /* Lattice, many vertices share the x coordinate. */
+    StreetGraph *lattice = new StreetGraph();
+    for (int i = 0; i <= 40; i++)
+    {
+      lattice->addRoad(Path(LineSegment(Point(i*100,0), Point(i*100,4000))));
+      lattice->addRoad(Path(LineSegment(Point(0,i*100), Point(4000,i*100))));
+    }
+    checkHalfEdgeFaces(lattice, 0, 1600);
+
+    /* Cycles touching others in a single vertex. */
+    for (unsigned long long seed = 0; seed < 4; seed++)
+    {
+      RandomEngine engine(seed);
+      StreetGraph *sg = new StreetGraph();
+      RasterRoadPattern raster;
+      OrganicRoadPattern organic;
+      RoadLSystem* generator = &raster;
+      if (seed % 2 == 0)
+      {
+        generator = &organic;
+      }
+      generator->setTarget(sg);
+      generator->setRandomEngine(&engine);
+      generator->setRoadLength(200, 400);
+      generator->setSnapDistance(50);
+      generator->setAreaConstraints(new Polygon(Point(-20000,-20000), Point(20000,-20000),
+                                                Point(20000,20000), Point(-20000,20000)));
+      generator->generateRoads(3000);
+
+      checkHalfEdgeFaces(sg, 0, -1);
+    }
+  }
+
+  TEST(SortNearlyParallelNeighbours)
+  {
+    /* The first two directions differ less than atan2 can tell. */
+    Point center(0,0);
+    std::vector<Point> neighbours;
+    neighbours.push_back(Point(-1e6, 1e-10));
+    neighbours.push_back(Point(-1e6, 2e-10));
+    neighbours.push_back(Point(1, 1));
+    neighbours.push_back(Point(0, -1));
+
+    PlanarFaces::sortCounterclockwise(center, &neighbours, Itself());
+    CHECK_EQUAL(-1, neighbours[0].y());
+    CHECK_EQUAL(1, neighbours[1].y());
+    CHECK_EQUAL(2e-10, neighbours[2].y());
+    CHECK_EQUAL(1e-10, neighbours[3].y());
+  }
+}
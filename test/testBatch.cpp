@@ -0,0 +1,193 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testBatch.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of the batch geometric tests
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <vector>
+#include <cmath>
+
+// Tested modules
+#include "../src/geometry/batch.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/units.h"
+#include "../src/random.h"
+
+namespace
+{
+  /** Star shaped polygon with some collinear and repeated vertices. */
+  Polygon star()
+  {
+    Polygon polygon;
+    for (int i = 0; i < 12; i++)
+    {
+      double angle = i * libcity::PI / 6,
+             radius = i % 2 ? 40 : 100;
+      polygon.addVertex(Point(500 + radius * std::cos(angle), 500 + radius * std::sin(angle)));
+    }
+    polygon.addVertex(Point(600, 500));
+    polygon.addVertex(Point(600, 500));
+    return polygon;
+  }
+}
+
+SUITE(Batch)
+{
+  TEST(EnclosesLikePolygon)
+  {
+    Polygon polygon = star();
+    Polygon square(Point(0.1, 0.1), Point(0.7, 0.1), Point(0.7, 0.7), Point(0.1, 0.7));
+
+    Random generator(libcity::RANDOM_SEED);
+    Batch::PointArray points, squarePoints;
+    for (int i = 0; i < 2001; i++)
+    {
+      points.push_back(Point(generator.generateDouble(380, 620), generator.generateDouble(380, 620)));
+    }
+    /* Vertices, points on the edges and just next to them */
+    for (unsigned int i = 0; i < polygon.numberOfVertices(); i++)
+    {
+      Point vertex = polygon.vertex(i),
+            next = polygon.vertex((i + 1) % polygon.numberOfVertices());
+      points.push_back(vertex);
+      points.push_back(Point((vertex.x() + next.x()) / 2, (vertex.y() + next.y()) / 2));
+      points.push_back(Point(vertex.x() + 1e-5, vertex.y()));
+      points.push_back(Point(vertex.x(), std::nextafter(vertex.y(), 0.0)));
+    }
+    for (int i = 0; i <= 80; i++)
+    {
+      squarePoints.push_back(Point(0.1, i * 0.01));
+      squarePoints.push_back(Point(i * 0.01, 0.7));
+      squarePoints.push_back(Point(i * 0.01, i * 0.01));
+    }
+
+    Batch::Kernel kernels[] = {Batch::SCALAR, Batch::VECTOR};
+    for (int kernel = 0; kernel < 2; kernel++)
+    {
+      std::vector<bool> inside;
+      Batch::encloses2D(polygon, points, &inside, kernels[kernel]);
+      CHECK_EQUAL(points.size(), inside.size());
+      int enclosed = 0;
+      for (unsigned int i = 0; i < points.size(); i++)
+      {
+        CHECK_EQUAL(polygon.encloses2D(Point(points.x[i], points.y[i])), inside[i]);
+        enclosed += inside[i];
+      }
+      CHECK(enclosed > 100);
+
+      Batch::encloses2D(square, squarePoints, &inside, kernels[kernel]);
+      for (unsigned int i = 0; i < squarePoints.size(); i++)
+      {
+        CHECK_EQUAL(square.encloses2D(Point(squarePoints.x[i], squarePoints.y[i])), inside[i]);
+      }
+    }
+
+    std::vector<bool> inside(5, true);
+    Batch::encloses2D(polygon, Batch::PointArray(), &inside);
+    CHECK(inside.empty());
+  }
+
+  TEST(IntersectsLikeLineSegment)
+  {
+    LineSegment segment(Point(0.1, 0.1), Point(100.3, 50.7));
+
+    Random generator(libcity::RANDOM_SEED);
+    Batch::SegmentArray segments;
+    for (int i = 0; i < 1001; i++)
+    {
+      Point begining(generator.generateDouble(-20, 120), generator.generateDouble(-20, 70));
+      double angle = generator.generateDouble(0, 2 * libcity::PI),
+             length = generator.generateDouble(1, 60);
+      segments.push_back(LineSegment(begining, Point(begining.x() + length * std::cos(angle),
+                                                     begining.y() + length * std::sin(angle))));
+    }
+    /* Touching, collinear and overlapping ones */
+    segments.push_back(LineSegment(Point(100.3, 50.7), Point(120, 30)));
+    segments.push_back(LineSegment(segment.begining(), segment.end()));
+    segments.push_back(LineSegment(Point(50.2, 25.4), Point(150.4, 76.1)));
+    segments.push_back(LineSegment(Point(-100.1, -50.5), Point(0.1, 0.1)));
+    segments.push_back(LineSegment(Point(10, 10), Point(10, 10)));
+
+    Batch::Kernel kernels[] = {Batch::SCALAR, Batch::VECTOR};
+    for (int kernel = 0; kernel < 2; kernel++)
+    {
+      std::vector<bool> intersecting;
+      Batch::intersects2D(segment, segments, &intersecting, kernels[kernel]);
+      CHECK_EQUAL(segments.size(), intersecting.size());
+      int found = 0;
+      Point intersection;
+      for (unsigned int i = 0; i < segments.size(); i++)
+      {
+        LineSegment another(Point(segments.beginingX[i], segments.beginingY[i]),
+                            Point(segments.endX[i], segments.endY[i]));
+        CHECK_EQUAL(segment.intersection2D(another, &intersection) != LineSegment::NONINTERSECTING,
+                    intersecting[i]);
+        found += intersecting[i];
+      }
+      CHECK(found > 50);
+    }
+  }
+
+  TEST(IntersectsNearlyCollinearLikeLineSegment)
+  {
+    /* Segments along the tested one, offset less and more
+       than the tolerance, crossing it or parallel to it. */
+    LineSegment segment(Point(0.1, 0.1), Point(1000.1, 300.1));
+    double length = segment.length(),
+           directionX = (segment.end().x() - segment.begining().x()) / length,
+           directionY = (segment.end().y() - segment.begining().y()) / length;
+
+    Batch::SegmentArray segments;
+    for (int from = -2; from < 12; from++)
+    {
+      for (int to = from + 1; to < 14; to += 3)
+      {
+        for (int offset = -3; offset <= 3; offset++)
+        {
+          double fromOffset = offset * 0.00004, toOffsets[] = {fromOffset, -fromOffset, 2 * fromOffset};
+          for (int i = 0; i < 3; i++)
+          {
+            double fromAlong = from * length / 10, toAlong = to * length / 10;
+            segments.push_back(LineSegment(
+              Point(segment.begining().x() + fromAlong * directionX - fromOffset * directionY,
+                    segment.begining().y() + fromAlong * directionY + fromOffset * directionX),
+              Point(segment.begining().x() + toAlong * directionX - toOffsets[i] * directionY,
+                    segment.begining().y() + toAlong * directionY + toOffsets[i] * directionX)));
+          }
+        }
+      }
+    }
+
+    Batch::Kernel kernels[] = {Batch::SCALAR, Batch::VECTOR};
+    for (int kernel = 0; kernel < 2; kernel++)
+    {
+      std::vector<bool> intersecting;
+      Batch::intersects2D(segment, segments, &intersecting, kernels[kernel]);
+      int found = 0;
+      Point intersection;
+      for (unsigned int i = 0; i < segments.size(); i++)
+      {
+        LineSegment another(Point(segments.beginingX[i], segments.beginingY[i]),
+                            Point(segments.endX[i], segments.endY[i]));
+        CHECK_EQUAL(segment.intersection2D(another, &intersection) != LineSegment::NONINTERSECTING,
+                    intersecting[i]);
+        found += intersecting[i];
+      }
+      CHECK(found > 0);
+      CHECK(found < static_cast<int>(segments.size()));
+    }
+  }
+}
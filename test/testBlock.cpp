@@ -18,15 +18,43 @@
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include <algorithm>
 
 // Tested modules
 #include "../src/area/block.h"
+#include "../src/area/lot.h"
+#include "../src/random.h"
 #include "../src/geometry/vector.h"
 #include "../src/geometry/point.h"
 #include "../src/geometry/polygon.h"
 #include "../src/geometry/linesegment.h"
 #include "../src/debug.h"
 
+namespace
+{
+  /** Creates lots of a rectangular block and returns their centroids. */
+  std::vector<Point> lotCentroids(RandomEngine const& engine, int sharedSeed)
+  {
+    Block block(0, Polygon(Point(0, 0), Point(400, 0), Point(400, 300), Point(0, 300)));
+    block.setRandomEngine(engine);
+
+    Random::setSeed(sharedSeed);
+    block.createLots(50, 50, 0.5);
+    Random::setSeed(libcity::RANDOM_SEED);
+
+    std::vector<Point> centroids;
+    std::list<Lot*> lots = block.getLots();
+    for (std::list<Lot*>::iterator lot = lots.begin();
+         lot != lots.end();
+         lot++)
+    {
+      centroids.push_back((*lot)->areaConstraints().centroid());
+      delete *lot;
+    }
+    return centroids;
+  }
+}
+
 SUITE(Block)
 {
   TEST(SubdivisionAlgorithm)
@@ -42,5 +70,31 @@ SUITE(Block)
     b.createLots(50,50,0.0);
 
     std::list<Lot*> lots = b.getLots();
+    Block::LotRange lotRange = b.lotRange();
+    CHECK(!lots.empty());
+    CHECK_EQUAL(static_cast<int>(lots.size()), lotRange.size());
+    CHECK(std::equal(lots.begin(), lots.end(), lotRange.begin()));
+  }
+
+  TEST(RandomEngine)
+  {
+    /* Doesn't depend on the shared seed */
+    std::vector<Point> seeded = lotCentroids(RandomEngine(42), 1),
+                       same = lotCentroids(RandomEngine(42), 2),
+                       reseeded = lotCentroids(RandomEngine(43), 1);
+
+    CHECK(seeded.size() > 10);
+    CHECK_EQUAL(seeded.size(), same.size());
+    for (unsigned int lot = 0; lot < seeded.size() && lot < same.size(); lot++)
+    {
+      CHECK(seeded[lot] == same[lot]);
+    }
+
+    bool differs = seeded.size() != reseeded.size();
+    for (unsigned int lot = 0; !differs && lot < seeded.size(); lot++)
+    {
+      differs = !(seeded[lot] == reseeded[lot]);
+    }
+    CHECK(differs);
   }
-}
\ No newline at end of file
+}
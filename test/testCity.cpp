@@ -0,0 +1,249 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testCity.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of City class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <list>
+#include <map>
+#include <vector>
+#include <algorithm>
+
+// Tested modules
+#include "../src/city.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/road.h"
+#include "../src/streetgraph/path.h"
+#include "../src/streetgraph/organicroadpattern.h"
+#include "../src/streetgraph/rasterroadpattern.h"
+#include "../src/area/zone.h"
+#include "../src/area/block.h"
+#include "../src/area/lot.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+
+namespace
+{
+  /** Organic primary roads, raster secondary roads, blocks and lots. */
+  class SmallCity : public City
+  {
+    public:
+      SmallCity()
+      {
+        area->addVertex(Point(-1500, -1500));
+        area->addVertex(Point( 1500, -1500));
+        area->addVertex(Point( 1500,  1500));
+        area->addVertex(Point(-1500,  1500));
+      }
+
+      virtual ~SmallCity()
+      {
+        for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          delete *lot;
+        }
+        for (std::list<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+        {
+          delete *block;
+        }
+        for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+        {
+          delete *zone;
+        }
+      }
+
+      /** Both ends of every road, sorted. */
+      std::vector< std::pair<Point, Point> > roads()
+      {
+        std::vector< std::pair<Point, Point> > ends;
+        StreetGraph::RoadRange range = map->roadRange();
+        for (StreetGraph::RoadRange::iterator road = range.begin();
+             road != range.end();
+             road++)
+        {
+          ends.push_back(std::make_pair((*road)->begining()->position(), (*road)->end()->position()));
+        }
+        std::sort(ends.begin(), ends.end());
+        return ends;
+      }
+
+      /** Vertices of the lots in the order they were created. */
+      std::vector<Point> lotVertices()
+      {
+        std::vector<Point> vertices;
+        for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          Polygon constraints = (*lot)->areaConstraints();
+          for (unsigned int i = 0; i < constraints.numberOfVertices(); i++)
+          {
+            vertices.push_back(constraints.vertex(i));
+          }
+        }
+        return vertices;
+      }
+
+      std::list<Lot*> lots;
+
+    protected:
+      virtual void createPrimaryRoadNetwork()
+      {
+        OrganicRoadPattern generator;
+        generator.setTarget(map);
+        generator.setAreaConstraints(new Polygon(*area));
+        generator.setInitialPosition(area->centroid());
+        generator.setRandomEngine(randomEngine());
+        generator.setRoadType(Road::PRIMARY_ROAD);
+        generator.setRoadLength(600, 900);
+        generator.setSnapDistance(100);
+        generator.generateRoads(30);
+      }
+
+      virtual void createZones()
+      {
+        *zones = map->findZones();
+      }
+
+      virtual void createSecondaryRoadNetwork()
+      {
+        for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+        {
+          Polygon constraints = (*zone)->areaConstraints();
+
+          RasterRoadPattern generator;
+          generator.setTarget(map);
+          generator.setAreaConstraints(new Polygon(constraints));
+          generator.setInitialPosition(constraints.centroid());
+          generator.setRandomEngine((*zone)->randomEngine());
+          generator.setRoadType(Road::SECONDARY_ROAD);
+          generator.setRoadLength(120, 180);
+          generator.setSnapDistance(20);
+          generator.generateRoads(10);
+        }
+      }
+
+      virtual void createBlocks()
+      {
+        std::map<Road::Type, double> roadWidths;
+        roadWidths[Road::PRIMARY_ROAD]   = 6;
+        roadWidths[Road::SECONDARY_ROAD] = 3;
+
+        forEachZone([&](Zone* zone) { zone->createBlocks(roadWidths); });
+
+        for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+        {
+          Zone::BlockRange zoneBlocks = (*zone)->blockRange();
+          blocks.insert(blocks.end(), zoneBlocks.begin(), zoneBlocks.end());
+        }
+      }
+
+      virtual void createBuildings()
+      {
+        std::vector<Block*> allBlocks(blocks.begin(), blocks.end());
+        forEachBlock(allBlocks, [](Block* block) { block->createLots(30, 30, 0.2); });
+
+        for (std::list<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+        {
+          Block::LotRange blockLots = (*block)->lotRange();
+          lots.insert(lots.end(), blockLots.begin(), blockLots.end());
+        }
+      }
+
+    private:
+      std::list<Block*> blocks;
+  };
+
+  /** Primary road network of given roads, nothing else. */
+  class RoadsOnlyCity : public City
+  {
+    public:
+      std::vector<LineSegment> primaryRoads;
+
+    protected:
+      virtual void createPrimaryRoadNetwork()
+      {
+        for (std::vector<LineSegment>::iterator road = primaryRoads.begin();
+             road != primaryRoads.end();
+             road++)
+        {
+          map->addRoad(Path(*road));
+        }
+      }
+
+      virtual void createZones() {}
+      virtual void createSecondaryRoadNetwork() {}
+      virtual void createBlocks() {}
+      virtual void createBuildings() {}
+  };
+}
+
+SUITE(CityClass)
+{
+  TEST(ThreadsDontChangeTheCity)
+  {
+    SmallCity serial;
+    serial.setSeed(2026);
+    serial.setNumberOfThreads(1);
+    serial.generate();
+
+    SmallCity parallel;
+    parallel.setSeed(2026);
+    parallel.setNumberOfThreads(4);
+    parallel.generate();
+
+    CHECK(serial.roads().size() > 30);
+    CHECK(serial.roads() == parallel.roads());
+
+    CHECK(!serial.lots.empty());
+    CHECK_EQUAL(serial.lots.size(), parallel.lots.size());
+    CHECK(serial.lotVertices() == parallel.lotVertices());
+  }
+
+  TEST(ConnectionsJoinTheNewRoads)
+  {
+    RoadsOnlyCity city;
+    city.streetGraph()->addRoad(Path(LineSegment(Point(0,10), Point(0,20))));
+    city.primaryRoads.push_back(LineSegment(Point(100,0), Point(200,0)));
+
+    std::vector<Point> connections;
+    connections.push_back(Point(0,0));
+    connections.push_back(Point(300,0));
+    city.setConnections(connections);
+    city.generate();
+
+    /* The existing road is nearer, but only the new one is joined. */
+    StreetGraph* map = city.streetGraph();
+    CHECK_EQUAL(4, map->numberOfRoads());
+    CHECK(map->getRoadBetweenIntersections(map->getIntersectionAtPosition(Point(0,0)),
+                                           map->getIntersectionAtPosition(Point(100,0))) != 0);
+    CHECK(map->getRoadBetweenIntersections(map->getIntersectionAtPosition(Point(300,0)),
+                                           map->getIntersectionAtPosition(Point(200,0))) != 0);
+  }
+
+  TEST(ConnectionsWithoutPrimaryRoads)
+  {
+    RoadsOnlyCity city;
+    city.streetGraph()->addRoad(Path(LineSegment(Point(0,10), Point(0,20))));
+
+    std::vector<Point> connections;
+    connections.push_back(Point(0,0));
+    city.setConnections(connections);
+    city.generate();
+
+    /* No intersection to join the point to, it stays unconnected. */
+    CHECK_EQUAL(1, city.streetGraph()->numberOfRoads());
+    CHECK(city.streetGraph()->getIntersectionAtPosition(Point(0,0)) == 0);
+  }
+}
@@ -0,0 +1,256 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testCityFile.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of CityFile class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <list>
+#include <map>
+#include <vector>
+#include <cstdio>
+#include <fstream>
+
+// Tested modules
+#include "../src/io/cityfile.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/compactstreetgraph.h"
+#include "../src/streetgraph/path.h"
+#include "../src/area/zone.h"
+#include "../src/area/block.h"
+#include "../src/area/lot.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+
+namespace
+{
+  const char* FILE_NAME = "testCityFile.city";
+
+  /** Vertices have to be stored exactly. */
+  bool sameBorder(Polygon const& first, Polygon const& second)
+  {
+    if (first.numberOfVertices() != second.numberOfVertices())
+    {
+      return false;
+    }
+    for (unsigned int vertex = 0; vertex < first.numberOfVertices(); vertex++)
+    {
+      Point one = first.vertex(vertex), two = second.vertex(vertex);
+      if (one.x() != two.x() || one.y() != two.y() || one.z() != two.z())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /** Grid of streets with zones, blocks and lots. */
+  struct SmallCity
+  {
+    StreetGraph graph;
+    std::list<Zone*> zones;
+    std::list<Block*> blocks;
+    std::list<Lot*> lots;
+
+    SmallCity()
+    {
+      for (int i = 0; i <= 3; i++)
+      {
+        graph.addRoad(Path(LineSegment(Point(i * 200, 0), Point(i * 200, 600))));
+        graph.addRoad(Path(LineSegment(Point(0, i * 200), Point(600, i * 200))), Road::SECONDARY_ROAD);
+      }
+
+      std::map<Road::Type, double> roadWidths;
+      roadWidths[Road::PRIMARY_ROAD] = 6;
+      roadWidths[Road::SECONDARY_ROAD] = 3;
+
+      zones = graph.findZones();
+      for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+      {
+        (*zone)->createBlocks(roadWidths);
+        Zone::BlockRange zoneBlocks = (*zone)->blockRange();
+        for (Zone::BlockRange::iterator block = zoneBlocks.begin(); block != zoneBlocks.end(); block++)
+        {
+          (*block)->createLots(30, 30, 0);
+          blocks.push_back(*block);
+          Block::LotRange blockLots = (*block)->lotRange();
+          lots.insert(lots.end(), blockLots.begin(), blockLots.end());
+        }
+      }
+    }
+
+    ~SmallCity()
+    {
+      for (std::list<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+      {
+        delete *lot;
+      }
+      for (std::list<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+      {
+        delete *block;
+      }
+      for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+      {
+        delete *zone;
+      }
+    }
+  };
+}
+
+SUITE(CityFileClass)
+{
+  TEST(SaveAndOpen)
+  {
+    SmallCity city;
+    CHECK_EQUAL(9u, city.zones.size());
+    CHECK(city.lots.size() > 9);
+    CHECK(CityFile::save(FILE_NAME, &city.graph, city.zones));
+
+    CityFile file;
+    CHECK(file.open(FILE_NAME));
+    CHECK(file.isOpen());
+
+    /* Street graph is stored in the order of CompactStreetGraph */
+    CompactStreetGraph compact(&city.graph);
+    CHECK_EQUAL(compact.numberOfIntersections(), file.numberOfIntersections());
+    CHECK_EQUAL(compact.numberOfRoads(), file.numberOfRoads());
+    for (int intersection = 0; intersection < file.numberOfIntersections(); intersection++)
+    {
+      CHECK_EQUAL(compact.x(intersection), file.intersectionsX()[intersection]);
+      CHECK_EQUAL(compact.y(intersection), file.intersectionsY()[intersection]);
+      CHECK_EQUAL(compact.firstWay(intersection), file.wayOffsets()[intersection]);
+      CHECK_EQUAL(compact.lastWay(intersection), file.wayOffsets()[intersection + 1]);
+    }
+    for (int road = 0; road < file.numberOfRoads(); road++)
+    {
+      CHECK_EQUAL(compact.roadBegining(road), file.roadsBeginings()[road]);
+      CHECK_EQUAL(compact.roadEnd(road), file.roadsEnds()[road]);
+      CHECK_EQUAL(compact.road(road).type(), file.roadsTypes()[road]);
+    }
+
+    CHECK_EQUAL(static_cast<int>(city.zones.size()), file.numberOfZones());
+    CHECK_EQUAL(static_cast<int>(city.blocks.size()), file.numberOfBlocks());
+    CHECK_EQUAL(static_cast<int>(city.lots.size()), file.numberOfLots());
+
+    std::remove(FILE_NAME);
+  }
+
+  TEST(LazyZones)
+  {
+    SmallCity city;
+    CHECK(CityFile::save(FILE_NAME, &city.graph, city.zones));
+
+    CityFile file;
+    CHECK(file.open(FILE_NAME));
+    CHECK(file.zone(-1) == 0);
+    CHECK(file.zone(file.numberOfZones()) == 0);
+
+    int index = 0;
+    for (std::list<Zone*>::iterator zone = city.zones.begin(); zone != city.zones.end(); zone++, index++)
+    {
+      Zone* loaded = file.zone(index);
+      CHECK(loaded != 0);
+      CHECK(loaded == file.zone(index));
+      CHECK(sameBorder(loaded->areaConstraints(), (*zone)->areaConstraints()));
+
+      Zone::BlockRange blocks = (*zone)->blockRange(),
+                       loadedBlocks = loaded->blockRange();
+      CHECK_EQUAL(blocks.size(), loadedBlocks.size());
+      Zone::BlockRange::iterator loadedBlock = loadedBlocks.begin();
+      for (Zone::BlockRange::iterator block = blocks.begin(); block != blocks.end(); block++, loadedBlock++)
+      {
+        CHECK((*loadedBlock)->parent() == loaded);
+        CHECK(sameBorder((*loadedBlock)->areaConstraints(), (*block)->areaConstraints()));
+
+        Block::LotRange lots = (*block)->lotRange(),
+                        loadedLots = (*loadedBlock)->lotRange();
+        CHECK_EQUAL(lots.size(), loadedLots.size());
+        Block::LotRange::iterator loadedLot = loadedLots.begin();
+        for (Block::LotRange::iterator lot = lots.begin(); lot != lots.end(); lot++, loadedLot++)
+        {
+          CHECK(sameBorder((*loadedLot)->areaConstraints(), (*lot)->areaConstraints()));
+        }
+      }
+    }
+
+    file.close();
+    CHECK(!file.isOpen());
+    CHECK_EQUAL(0, file.numberOfZones());
+    std::remove(FILE_NAME);
+  }
+
+  TEST(LoadStreetGraph)
+  {
+    SmallCity city;
+    CHECK(CityFile::save(FILE_NAME, &city.graph, city.zones));
+
+    CityFile file;
+    CHECK(file.open(FILE_NAME));
+    StreetGraph graph;
+    CHECK(file.loadStreetGraph(&graph));
+    CHECK_EQUAL(city.graph.numberOfRoads(), graph.numberOfRoads());
+    CHECK_EQUAL(city.graph.numberOfIntersections(), graph.numberOfIntersections());
+
+    std::list<Zone*> zones = graph.findZones();
+    CHECK_EQUAL(city.zones.size(), zones.size());
+    for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+    {
+      delete *zone;
+    }
+
+    std::remove(FILE_NAME);
+  }
+
+  TEST(BrokenFiles)
+  {
+    CityFile file;
+    CHECK(!file.open("missing.city"));
+
+    SmallCity city;
+    CHECK(CityFile::save(FILE_NAME, &city.graph, city.zones));
+    std::vector<char> contents;
+    {
+      std::ifstream input(FILE_NAME, std::ios::binary);
+      contents.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    }
+
+    /* Truncated */
+    {
+      std::ofstream output(FILE_NAME, std::ios::binary | std::ios::trunc);
+      output.write(&contents[0], contents.size() / 2);
+    }
+    CHECK(!file.open(FILE_NAME));
+
+    /* Other version */
+    std::vector<char> changed = contents;
+    changed[8]++;
+    {
+      std::ofstream output(FILE_NAME, std::ios::binary | std::ios::trunc);
+      output.write(&changed[0], changed.size());
+    }
+    CHECK(!file.open(FILE_NAME));
+
+    /* Not a city file */
+    changed = contents;
+    changed[0] = 'X';
+    {
+      std::ofstream output(FILE_NAME, std::ios::binary | std::ios::trunc);
+      output.write(&changed[0], changed.size());
+    }
+    CHECK(!file.open(FILE_NAME));
+    CHECK(!file.isOpen());
+
+    std::remove(FILE_NAME);
+  }
+}
@@ -0,0 +1,99 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testCompactStreetGraph.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of CompactStreetGraph class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <list>
+#include <stdexcept>
+
+// Tested modules
+#include "../src/streetgraph/compactstreetgraph.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/road.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/debug.h"
+
+SUITE(CompactStreetGraphClass)
+{
+  TEST(Snapshot)
+  {
+    StreetGraph graph;
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(200, 0))));
+    graph.addRoad(Path(LineSegment(Point(100, -100), Point(100, 100))), Road::SECONDARY_ROAD);
+
+    CompactStreetGraph compact(&graph);
+    CHECK_EQUAL(graph.numberOfRoads(), compact.numberOfRoads());
+    CHECK_EQUAL(5, compact.numberOfIntersections());
+
+    StreetGraph::Intersections intersections = graph.getIntersections();
+    for (StreetGraph::Intersections::iterator intersection = intersections.begin();
+         intersection != intersections.end();
+         intersection++)
+    {
+      CompactStreetGraph::IntersectionView view = compact.intersection(compact.handleOf(*intersection));
+      CHECK(view.original() == *intersection);
+      CHECK(view.position() == (*intersection)->position());
+      CHECK_EQUAL((*intersection)->numberOfWays(), view.numberOfWays());
+
+      std::list<Road*> roads = (*intersection)->getRoads();
+      int way = 0;
+      for (std::list<Road*>::iterator road = roads.begin();
+           road != roads.end();
+           road++, way++)
+      {
+        CHECK(view.road(way).original() == *road);
+        Intersection* other = (*road)->begining() == *intersection ? (*road)->end() : (*road)->begining();
+        CHECK(view.adjacentIntersection(way).original() == other);
+      }
+    }
+
+    for (StreetGraph::iterator road = graph.begin(); road != graph.end(); road++)
+    {
+      CompactStreetGraph::RoadView view = compact.road(compact.handleOf(*road));
+      CHECK(view.begining().original() == (*road)->begining());
+      CHECK(view.end().original() == (*road)->end());
+      CHECK_EQUAL((*road)->type(), view.type());
+      CHECK_CLOSE(100, view.length(), 1e-9);
+    }
+
+    CompactStreetGraph::IntersectionView center = compact.intersection(compact.handleOf(
+                                                    graph.getIntersectionAtPosition(Point(100, 0))));
+    CHECK_EQUAL(4, center.numberOfWays());
+  }
+
+  TEST(Rebuild)
+  {
+    StreetGraph graph;
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(200, 0))));
+
+    CompactStreetGraph compact(&graph);
+    Road* removed = *graph.begin();
+    CHECK_EQUAL(0, compact.handleOf(removed));
+
+    graph.addRoad(Path(LineSegment(Point(0, 100), Point(200, 100))));
+    graph.removeRoad(removed);
+    compact.build(&graph);
+
+    CHECK_EQUAL(1, compact.numberOfRoads());
+    CHECK_EQUAL(2, compact.numberOfIntersections());
+    CHECK_EQUAL(CompactStreetGraph::INVALID_HANDLE, compact.handleOf(removed));
+    CHECK_EQUAL(0, compact.handleOf(*graph.begin()));
+  }
+}
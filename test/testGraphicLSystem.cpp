@@ -20,6 +20,75 @@
 
 // Tested modules
 #include "../src/lsystem/graphiclsystem.h"
+#include "../src/lsystem/roadlsystem.h"
+
+namespace
+{
+  /**
+   * m moves the cursor by 1, r moves it by 100 and removes
+   * itself, p removes the symbol before it.
+   */
+  class RemovingLSystem : public GraphicLSystem
+  {
+    public:
+      RemovingLSystem()
+      {
+        addToAlphabet("mrp");
+        cursor.setDirection(Vector(1,0));
+      }
+
+      double cursorX()
+      {
+        return cursor.getPosition().x();
+      }
+
+    protected:
+      virtual void interpretSymbol(char symbol)
+      {
+        SymbolString::iterator previous = currentlyInterpretedSymbol;
+        switch (symbol)
+        {
+          case 'm':
+            cursor.move(1);
+            break;
+          case 'r':
+            cursor.move(100);
+            removeSymbol(currentlyInterpretedSymbol);
+            break;
+          case 'p':
+            previous--;
+            removeSymbol(previous);
+            break;
+          default:
+            GraphicLSystem::interpretSymbol(symbol);
+            break;
+        }
+      }
+  };
+
+  /** x cancels the branch it's in. */
+  class CancellingLSystem : public RoadLSystem
+  {
+    public:
+      CancellingLSystem()
+      {
+        addToAlphabet("x");
+      }
+
+    protected:
+      virtual void interpretSymbol(char symbol)
+      {
+        if (symbol == 'x')
+        {
+          cancelBranch();
+        }
+        else
+        {
+          RoadLSystem::interpretSymbol(symbol);
+        }
+      }
+  };
+}
 
 SUITE(GraphicLSystemClass)
 {
@@ -80,4 +149,50 @@ SUITE(GraphicLSystemClass)
 
     delete gls;
   }
-}
\ No newline at end of file
+
+  TEST(RemoveInterpretedSymbol)
+  {
+    RemovingLSystem gls;
+    gls.setAxiom("mrm");
+
+    CHECK_EQUAL('m', gls.readNextSymbol());
+    CHECK_EQUAL('r', gls.readNextSymbol());
+    CHECK_EQUAL("mm", gls.getProducedString());
+
+    /* Reading continues after the removed symbol
+       and its move of the cursor is forgotten. */
+    CHECK_EQUAL('m', gls.readNextSymbol());
+    CHECK_EQUAL(2, gls.cursorX());
+    CHECK_EQUAL('\0', gls.readNextSymbol());
+  }
+
+  TEST(RemoveSymbolBeforeInterpretedOne)
+  {
+    RemovingLSystem gls;
+    gls.setAxiom("mpm");
+
+    CHECK_EQUAL('m', gls.readNextSymbol());
+    CHECK_EQUAL('p', gls.readNextSymbol());
+    CHECK_EQUAL("pm", gls.getProducedString());
+
+    /* The cursor continues from the symbol that removed it. */
+    CHECK_EQUAL('m', gls.readNextSymbol());
+    CHECK_EQUAL(2, gls.cursorX());
+    CHECK_EQUAL('\0', gls.readNextSymbol());
+  }
+
+  TEST(CancelBranch)
+  {
+    CancellingLSystem rls;
+    rls.setAxiom("[x-+]-");
+
+    CHECK_EQUAL('[', rls.readNextSymbol());
+    CHECK_EQUAL('x', rls.readNextSymbol());
+    CHECK_EQUAL("[]-", rls.getProducedString());
+
+    /* Reading continues at the end of the branch. */
+    CHECK_EQUAL(']', rls.readNextSymbol());
+    CHECK_EQUAL('-', rls.readNextSymbol());
+    CHECK_EQUAL('\0', rls.readNextSymbol());
+  }
+}
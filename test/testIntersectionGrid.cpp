@@ -0,0 +1,104 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testIntersectionGrid.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of IntersectionGrid class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+// Tested modules
+#include "../src/streetgraph/intersectiongrid.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/units.h"
+#include "../src/debug.h"
+
+SUITE(IntersectionGridClass)
+{
+  TEST(Find)
+  {
+    IntersectionGrid grid(100);
+    Intersection first(Point(10, 10)), second(Point(-250, 399.99)), third(Point(1e6, -1e6));
+
+    grid.insert(&first);
+    grid.insert(&second);
+    grid.insert(&third);
+    CHECK_EQUAL(3, grid.size());
+
+    CHECK(grid.find(Point(10, 10)) == &first);
+    CHECK(grid.find(Point(-250, 399.99)) == &second);
+    CHECK(grid.find(Point(1e6, -1e6)) == &third);
+    CHECK(grid.find(Point(10, 11)) == 0);
+    CHECK(grid.find(Point(0, 0)) == 0);
+
+    grid.remove(&second);
+    CHECK_EQUAL(2, grid.size());
+    CHECK(grid.find(Point(-250, 399.99)) == 0);
+
+    grid.clear();
+    CHECK_EQUAL(0, grid.size());
+    CHECK(grid.find(Point(10, 10)) == 0);
+  }
+
+  TEST(Tolerance)
+  {
+    IntersectionGrid grid(100);
+    double halfEpsilon = libcity::COORDINATES_EPSILON / 2;
+
+    /* Right at the border of four cells. */
+    Intersection corner(Point(200 - halfEpsilon, 100 + halfEpsilon));
+    grid.insert(&corner);
+
+    CHECK(grid.find(Point(200, 100)) == &corner);
+    CHECK(grid.find(Point(200 - halfEpsilon, 100 + halfEpsilon)) == &corner);
+    CHECK(grid.find(Point(200 + halfEpsilon, 100 - halfEpsilon)) == 0);
+  }
+
+  TEST(FirstInsertedWins)
+  {
+    IntersectionGrid grid(100);
+    double delta = libcity::COORDINATES_EPSILON * 0.75;
+
+    Intersection later(Point(100 + delta, 0)), earlier(Point(100 - delta, 0));
+    grid.insert(&earlier);
+    grid.insert(&later);
+
+    CHECK(grid.find(Point(100, 0)) == &earlier);
+  }
+
+  TEST(StreetGraphLookup)
+  {
+    StreetGraph sg;
+    sg.addRoad(Path(LineSegment(Point(0, 0), Point(0, 100))));
+    sg.addRoad(Path(LineSegment(Point(-50, 50), Point(50, 50))));
+
+    CHECK(sg.isIntersectionAtPosition(Point(0, 0)));
+    CHECK(sg.isIntersectionAtPosition(Point(0, 50)));
+    CHECK(sg.isIntersectionAtPosition(Point(50, 50)));
+    CHECK(!sg.isIntersectionAtPosition(Point(50, 0)));
+    CHECK_EQUAL(4, sg.getIntersectionAtPosition(Point(0, 50))->numberOfWays());
+
+    Road* road = sg.getRoadBetweenIntersections(sg.getIntersectionAtPosition(Point(0, 50)),
+                                                sg.getIntersectionAtPosition(Point(50, 50)));
+    CHECK(road != 0);
+    sg.removeRoad(road);
+    CHECK(!sg.isIntersectionAtPosition(Point(50, 50)));
+    CHECK(sg.isIntersectionAtPosition(Point(0, 50)));
+  }
+}
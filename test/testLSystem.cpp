@@ -21,6 +21,22 @@
 
 // Tested modules
 #include "../src/lsystem/lsystem.h"
+#include "../src/random.h"
+
+namespace
+{
+  /** Stochastic plant with a few terminals. */
+  void setUpPlant(LSystem* lsystem)
+  {
+    lsystem->setAlphabet("FX+-[]");
+    lsystem->setAxiom("X");
+
+    lsystem->addRule('X', "F[+X]F[-X]+X");
+    lsystem->addRule('X', "F[-X]F[+X]-X");
+    lsystem->addRule('X', "F-[[X]+X]+F[+FX]-X");
+    lsystem->addRule('F', "FF");
+  }
+}
 
 SUITE(LSystemClass)
 {
@@ -95,4 +111,101 @@ SUITE(LSystemClass)
 
     delete lsystem;
   }
-}
\ No newline at end of file
+
+  TEST(ContiguousStorage)
+  {
+    LSystem *lsystem = new LSystem();
+    lsystem->setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+    CHECK(lsystem->storageMode() == LSystem::CONTIGUOUS_SYMBOLS);
+
+    lsystem->setAlphabet("AB");
+    lsystem->setAxiom("A");
+    lsystem->addRule('A', "AB");
+    lsystem->addRule('B', "A");
+
+    CHECK_EQUAL(lsystem->getProducedString(), "A");
+    CHECK_EQUAL(lsystem->doIterations(1), 1);
+    CHECK_EQUAL(lsystem->getProducedString(), "AB");
+    CHECK_EQUAL(lsystem->doIterations(1), 2);
+    CHECK_EQUAL(lsystem->getProducedString(), "ABA");
+
+    /* Conversion keeps the string */
+    lsystem->setStorageMode(LSystem::LINKED_SYMBOLS);
+    CHECK_EQUAL(lsystem->getProducedString(), "ABA");
+    lsystem->doIterations(1);
+    lsystem->setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+    CHECK_EQUAL(lsystem->getProducedString(), "ABAAB");
+    lsystem->doIterations(4);
+    CHECK_EQUAL(lsystem->getProducedString(), "ABAABABAABAABABAABABAABAABABAABAAB");
+
+    delete lsystem;
+  }
+
+  TEST(ContiguousStochasticRules)
+  {
+    LSystem linked, contiguous, threaded;
+    setUpPlant(&linked);
+    setUpPlant(&contiguous);
+    setUpPlant(&threaded);
+    contiguous.setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+    contiguous.setRewritingThreads(1);
+    threaded.setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+    threaded.setRewritingThreads(4);
+
+    /* Long enough to be split into several chunks */
+    Random::setSeed(42);
+    int linkedRewrites = linked.doIterations(9);
+    Random::setSeed(42);
+    int contiguousRewrites = contiguous.doIterations(9);
+    Random::setSeed(42);
+    int threadedRewrites = threaded.doIterations(9);
+    Random::setSeed(libcity::RANDOM_SEED);
+
+    std::string produced = linked.getProducedString();
+    CHECK(produced.size() > 4 * 65536);
+    CHECK_EQUAL(linkedRewrites, contiguousRewrites);
+    CHECK_EQUAL(linkedRewrites, threadedRewrites);
+    CHECK(produced == contiguous.getProducedString());
+    CHECK(produced == threaded.getProducedString());
+  }
+
+  TEST(DerivationSeed)
+  {
+    LSystem linked, contiguous, threaded, reseeded;
+    setUpPlant(&linked);
+    setUpPlant(&contiguous);
+    setUpPlant(&threaded);
+    setUpPlant(&reseeded);
+    linked.setDerivationSeed(42);
+    contiguous.setDerivationSeed(42);
+    contiguous.setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+    contiguous.setRewritingThreads(1);
+    threaded.setDerivationSeed(42);
+    threaded.setStorageMode(LSystem::CONTIGUOUS_SYMBOLS);
+    threaded.setRewritingThreads(4);
+    reseeded.setDerivationSeed(43);
+
+    /* The shared generator isn't touched */
+    Random::setSeed(7);
+    int linkedRewrites = linked.doIterations(9);
+    CHECK_EQUAL(Random().generateInteger(0, 1000000), Random(7).generateInteger(0, 1000000));
+
+    Random::setSeed(1234);
+    CHECK_EQUAL(linkedRewrites, contiguous.doIterations(9));
+    CHECK_EQUAL(linkedRewrites, threaded.doIterations(9));
+    Random::setSeed(libcity::RANDOM_SEED);
+
+    std::string produced = linked.getProducedString();
+    CHECK(produced.size() > 4 * 65536);
+    CHECK(produced == contiguous.getProducedString());
+    CHECK(produced == threaded.getProducedString());
+
+    reseeded.doIterations(9);
+    CHECK(produced != reseeded.getProducedString());
+
+    /* Iterations are counted from the axiom */
+    linked.setAxiom("X");
+    linked.doIterations(9);
+    CHECK(produced == linked.getProducedString());
+  }
+}
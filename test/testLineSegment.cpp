@@ -245,4 +245,24 @@ SUITE(LineSegmentClass)
     CHECK(LineSegment::CONTAINING == result);
   }
 
-}
\ No newline at end of file
+  TEST(NearlyCollinearCrossing)
+  {
+    /* The ends of b are closer to a than the tolerance, but
+       the segments really cross, they must not be subsequent. */
+    LineSegment a(Point(0, 0), Point(1000, 0)),
+                b(Point(400, 0.00009), Point(600, -0.00009));
+    Point point;
+
+    CHECK(LineSegment::CONTAINING == a.intersection2D(b, &point));
+    CHECK(LineSegment::CONTAINED == b.intersection2D(a, &point));
+
+    /* A longer segment crossing a at the same place */
+    LineSegment c(Point(400, 0.00009), Point(1600, -0.00099));
+    CHECK(LineSegment::NONINTERSECTING != a.intersection2D(c, &point));
+    CHECK(LineSegment::NONINTERSECTING != c.intersection2D(a, &point));
+
+    /* Parallel in the tolerance, just like the crossing one */
+    LineSegment d(Point(400, 0.00009), Point(600, 0.00009));
+    CHECK(LineSegment::CONTAINING == a.intersection2D(d, &point));
+  }
+}
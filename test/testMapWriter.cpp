@@ -0,0 +1,151 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testMapWriter.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of GeoJsonWriter and OsmWriter classes
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <string>
+
+#include "temporary.h"
+
+// Tested modules
+#include "../src/io/outputstream.h"
+#include "../src/io/geojsonwriter.h"
+#include "../src/io/osmwriter.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+
+namespace
+{
+  /** Output of a writer in a temporary file. */
+  class Export
+  {
+    public:
+      Export()
+      {
+        stream = new OutputStream(file.descriptor, 64);
+      }
+
+      ~Export()
+      {
+        delete stream;
+      }
+
+      std::string contents()
+      {
+        stream->flush();
+        return file.contents();
+      }
+
+      OutputStream* stream;
+
+    private:
+      TemporaryFile file;
+  };
+
+  int occurrences(std::string const& text, std::string const& part)
+  {
+    int count = 0;
+    for (size_t position = text.find(part); position != std::string::npos; position = text.find(part, position + 1))
+    {
+      count++;
+    }
+    return count;
+  }
+
+  /** Two crossing roads, 5 intersections and 4 roads. */
+  void crossing(StreetGraph* graph)
+  {
+    graph->addRoad(Path(LineSegment(Point(0, 0), Point(200, 0))));
+    graph->addRoad(Path(LineSegment(Point(100, -100), Point(100, 100))), Road::SECONDARY_ROAD);
+  }
+}
+
+SUITE(MapWriterClasses)
+{
+  TEST(GeoJson)
+  {
+    StreetGraph graph;
+    crossing(&graph);
+    Polygon square(Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10));
+
+    Export file;
+    {
+      GeoJsonWriter writer(file.stream);
+      writer.writeStreetGraph(&graph);
+      writer.writeArea(square, MapWriter::LOT);
+      CHECK(writer.finish());
+    }
+
+    std::string text = file.contents();
+    CHECK_EQUAL(0u, text.find("{\"type\":\"FeatureCollection\",\"features\":[\n"));
+    CHECK_EQUAL(text.size() - 4, text.rfind("\n]}\n"));
+    CHECK_EQUAL(10, occurrences(text, "\"type\":\"Feature\""));
+    CHECK_EQUAL(9, occurrences(text, "},\n{"));
+    CHECK_EQUAL(5, occurrences(text, "\"kind\":\"intersection\""));
+    CHECK_EQUAL(4, occurrences(text, "\"kind\":\"road\""));
+    CHECK_EQUAL(1, occurrences(text, "\"ways\":4"));
+    CHECK_EQUAL(1, occurrences(text, "[[[0.000,0.000],[10.000,0.000],[10.000,10.000],"
+                                     "[0.000,10.000],[0.000,0.000]]]},\"properties\":{\"kind\":\"lot\"}}"));
+  }
+
+  TEST(GeoJsonOrigin)
+  {
+    Export file;
+    {
+      GeoJsonWriter writer(file.stream);
+      writer.setOrigin(50, 14);
+      writer.writeArea(Polygon(Point(0, 0), Point(1000, 0), Point(0, 1000)), MapWriter::ZONE);
+    }
+
+    /* A kilometer is about 0.009 degrees of latitude
+       and 0.014 degrees of longitude at 50 degrees north. */
+    std::string text = file.contents();
+    CHECK_EQUAL(1, occurrences(text, "[[[14.0000000,50.0000000],[14.0139"));
+    CHECK_EQUAL(1, occurrences(text, "],[14.0000000,50.0089"));
+  }
+
+  TEST(Osm)
+  {
+    StreetGraph graph;
+    crossing(&graph);
+    Polygon square(Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10));
+
+    Export file;
+    {
+      OsmWriter writer(file.stream);
+      writer.writeStreetGraph(&graph);
+      writer.writeArea(square, MapWriter::BLOCK);
+    }
+
+    std::string text = file.contents();
+    CHECK_EQUAL(0u, text.find("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<osm version=\"0.6\""));
+    CHECK_EQUAL(text.size() - 7, text.rfind("</osm>\n"));
+    CHECK_EQUAL(9, occurrences(text, "<node id=\"-"));
+    CHECK_EQUAL(5, occurrences(text, "<way id=\"-"));
+    CHECK_EQUAL(5, occurrences(text, "</way>"));
+    CHECK_EQUAL(2, occurrences(text, "v=\"primary\""));
+    CHECK_EQUAL(2, occurrences(text, "v=\"secondary\""));
+    CHECK_EQUAL(1, occurrences(text, "<tag k=\"libcity:area\" v=\"block\"/>"));
+
+    /* Roads refer to the intersection nodes, the closed
+       way of the block repeats its first node. */
+    CHECK_EQUAL(8 + 5, occurrences(text, "<nd ref=\"-"));
+    CHECK_EQUAL(2, occurrences(text, "<nd ref=\"-6\"/>"));
+    CHECK_EQUAL(1, occurrences(text, "<node id=\"-6\" lon=\"0.0000000\" lat=\"0.0000000\"/>"));
+  }
+}
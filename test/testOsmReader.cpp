@@ -0,0 +1,191 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testOsmReader.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of OsmReader class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <string>
+#include <cmath>
+
+#include "temporary.h"
+
+// Tested modules
+#include "../src/io/osmreader.h"
+#include "../src/io/osmwriter.h"
+#include "../src/io/outputstream.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+
+namespace
+{
+  /**
+    A crossroads of two ways at 50 degrees north. Node 5 is
+    a duplicate of node 2 a few centimeters away, the footway
+    and the area aren't roads and node 99 isn't in the file.
+   */
+  const char* CROSSROADS =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<osm version=\"0.6\" generator=\"test\">\n"
+    " <bounds minlat=\"49.999\" minlon=\"13.999\" maxlat=\"50.001\" maxlon=\"14.001\"/>\n"
+    " <node id=\"1\" lat=\"50.0000000\" lon=\"13.9990000\"/>\n"
+    " <node id=\"2\" lat=\"50.0000000\" lon=\"14.0000000\"/>\n"
+    " <node id=\"3\" lat=\"50.0000000\" lon=\"14.0010000\"/>\n"
+    " <node id=\"4\" lat=\"49.9990000\" lon=\"14.0000000\"/>\n"
+    " <node id=\"5\" lat=\"50.0000003\" lon=\"14.0000003\"/>\n"
+    " <node id=\"6\" lat=\"50.0010000\" lon=\"14.0000000\"/>\n"
+    " <node id=\"7\" lat=\"50.0005000\" lon=\"14.0005000\"/>\n"
+    " <way id=\"10\">\n"
+    "  <nd ref=\"1\"/><nd ref=\"2\"/><nd ref=\"3\"/><nd ref=\"99\"/>\n"
+    "  <tag k=\"highway\" v=\"primary\"/>\n"
+    " </way>\n"
+    " <way id=\"11\">\n"
+    "  <nd ref=\"4\"/><nd ref=\"5\"/><nd ref=\"6\"/>\n"
+    "  <tag k=\"highway\" v=\"residential\"/>\n"
+    " </way>\n"
+    " <way id=\"12\">\n"
+    "  <nd ref=\"3\"/><nd ref=\"7\"/>\n"
+    "  <tag k=\"highway\" v=\"footway\"/>\n"
+    " </way>\n"
+    " <way id=\"13\">\n"
+    "  <nd ref=\"2\"/><nd ref=\"7\"/><nd ref=\"6\"/><nd ref=\"2\"/>\n"
+    "  <tag k=\"highway\" v=\"pedestrian\"/><tag k=\"area\" v=\"yes\"/>\n"
+    " </way>\n"
+    "</osm>\n";
+}
+
+SUITE(OsmReaderClass)
+{
+  TEST(RoadTypes)
+  {
+    Road::Type type, linkType, otherType;
+    CHECK(OsmReader::roadType("primary", &type));
+    CHECK_EQUAL(Road::PRIMARY_ROAD, type);
+    CHECK(OsmReader::roadType("secondary_link", &type));
+    CHECK_EQUAL(Road::SECONDARY_ROAD, type);
+
+    CHECK(OsmReader::roadType("residential", &type));
+    CHECK(OsmReader::roadType("residential", &otherType));
+    CHECK_EQUAL(type, otherType);
+    CHECK(type != Road::PRIMARY_ROAD && type != Road::SECONDARY_ROAD);
+
+    CHECK(OsmReader::roadType("motorway", &type));
+    CHECK(OsmReader::roadType("motorway_link", &linkType));
+    CHECK(OsmReader::roadType("tertiary", &otherType));
+    CHECK_EQUAL(type, linkType);
+    CHECK(type != otherType);
+
+    CHECK(!OsmReader::roadType("footway", &type));
+    CHECK(!OsmReader::roadType("_link", &type));
+  }
+
+  TEST(Crossroads)
+  {
+    TemporaryFile file(CROSSROADS);
+    StreetGraph graph;
+    OsmReader reader;
+    CHECK(reader.read(file.fileName, &graph));
+
+    CHECK_EQUAL(7, reader.numberOfNodes());
+    CHECK_EQUAL(2, reader.numberOfWays());
+    CHECK_EQUAL(4, reader.numberOfSegments());
+    CHECK_EQUAL(5, reader.numberOfWeldedNodes());
+
+    CHECK_EQUAL(5, graph.numberOfIntersections());
+    CHECK_EQUAL(4, graph.numberOfRoads());
+
+    /* The origin is the center of the bounds */
+    Intersection* center = 0;
+    StreetGraph::IntersectionRange intersections = graph.intersectionRange();
+    for (StreetGraph::IntersectionRange::iterator intersection = intersections.begin();
+         intersection != intersections.end();
+         intersection++)
+    {
+      if ((*intersection)->numberOfWays() == 4)
+      {
+        center = *intersection;
+      }
+    }
+    CHECK(center != 0);
+    if (center != 0)
+    {
+      CHECK_CLOSE(0, center->position().x(), 0.01);
+      CHECK_CLOSE(0, center->position().y(), 0.01);
+    }
+  }
+
+  TEST(WeldDistance)
+  {
+    TemporaryFile file(CROSSROADS);
+    StreetGraph graph;
+    OsmReader reader;
+    reader.setWeldDistance(0.01);
+    CHECK(reader.read(file.fileName, &graph));
+
+    /* Node 5 is separate now, the residential road crosses
+       the primary one next to node 2 instead */
+    CHECK_EQUAL(6, reader.numberOfWeldedNodes());
+    CHECK_EQUAL(7, graph.numberOfIntersections());
+    CHECK_EQUAL(6, graph.numberOfRoads());
+  }
+
+  TEST(RoundTrip)
+  {
+    StreetGraph graph;
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(200, 0))));
+    graph.addRoad(Path(LineSegment(Point(100, -100), Point(100, 100))), Road::SECONDARY_ROAD);
+    graph.addRoad(Path(LineSegment(Point(200, 0), Point(300, 50))), 1234);
+
+    TemporaryFile file;
+    {
+      OutputStream stream(file.descriptor);
+      OsmWriter writer(&stream);
+      writer.writeStreetGraph(&graph);
+      writer.writeArea(Polygon(Point(0, 0), Point(10, 0), Point(10, 10)), MapWriter::LOT);
+    }
+
+    StreetGraph imported;
+    OsmReader reader;
+    reader.setOrigin(0, 0);
+    CHECK(reader.read(file.fileName, &imported));
+    CHECK_EQUAL(graph.numberOfIntersections(), imported.numberOfIntersections());
+    CHECK_EQUAL(graph.numberOfRoads(), imported.numberOfRoads());
+
+    int types[2000] = {0};
+    StreetGraph::RoadRange roads = imported.roadRange();
+    for (StreetGraph::RoadRange::iterator road = roads.begin();
+         road != roads.end();
+         road++)
+    {
+      types[(*road)->type()]++;
+    }
+    CHECK_EQUAL(2, types[Road::PRIMARY_ROAD]);
+    CHECK_EQUAL(2, types[Road::SECONDARY_ROAD]);
+    CHECK_EQUAL(1, types[1234]);
+  }
+
+  TEST(Failure)
+  {
+    StreetGraph graph;
+    OsmReader reader;
+    CHECK(!reader.read("/nonexistent/file.osm", &graph));
+
+    TemporaryFile file("<osm><node id=\"1\" lat=\"0\" lon=\"0\"/><way id=\"2\"><nd ref=\"1\"/>");
+    CHECK(!reader.read(file.fileName, &graph));
+    CHECK_EQUAL(0, graph.numberOfRoads());
+  }
+}
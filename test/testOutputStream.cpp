@@ -0,0 +1,111 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testOutputStream.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of OutputStream class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <string>
+#include <sstream>
+
+#include "temporary.h"
+
+// Tested modules
+#include "../src/io/outputstream.h"
+
+namespace
+{
+  void writeSample(OutputStream* output, int count)
+  {
+    for (int i = 0; i < count; i++)
+    {
+      output->write("item ");
+      output->writeInteger(i - count / 2);
+      output->write(' ');
+      output->writeFixed(i * 0.37 - 11, 3);
+      output->write('\n');
+    }
+  }
+}
+
+SUITE(OutputStreamClass)
+{
+  TEST(Formatting)
+  {
+    TemporaryFile file;
+    {
+      OutputStream output(file.descriptor, 7);
+      output.write("numbers:");
+      output.write(' ');
+      output.writeInteger(0);
+      output.write(' ');
+      output.writeInteger(-1234567890123LL);
+      output.write(' ');
+      output.writeFixed(12.3456, 2);
+      output.write(' ');
+      output.writeFixed(-7.25, 1);
+      output.write(' ');
+      output.writeFixed(-0.0001, 3);
+      output.write(' ');
+      output.writeFixed(0.5, 0);
+      output.write(' ');
+      output.writeFixed(1e20, 1);
+      CHECK(output.flush());
+      CHECK_EQUAL(68u, output.bytesWritten());
+    }
+    CHECK_EQUAL("numbers: 0 -1234567890123 12.35 -7.3 0.000 1 100000000000000000000.0",
+                file.contents());
+  }
+
+  TEST(Background)
+  {
+    const int ITEMS = 20000;
+    TemporaryFile direct, background;
+    {
+      OutputStream output(direct.descriptor, 1000);
+      writeSample(&output, ITEMS);
+    }
+    {
+      OutputStream output(background.descriptor, 1000, true);
+      writeSample(&output, ITEMS / 2);
+      CHECK(output.flush());
+      writeSample(&output, ITEMS / 2);
+    }
+
+    std::string first = direct.contents();
+    std::string half;
+    {
+      TemporaryFile file;
+      {
+        OutputStream output(file.descriptor);
+        writeSample(&output, ITEMS / 2);
+      }
+      half = file.contents();
+    }
+    CHECK(first.size() > 100000);
+    CHECK(half + half == background.contents());
+
+    std::stringstream expected;
+    expected << "item " << -ITEMS / 2 << " -11.000\n";
+    CHECK_EQUAL(expected.str(), first.substr(0, expected.str().size()));
+  }
+
+  TEST(Failure)
+  {
+    OutputStream output(-1, 16, true);
+    CHECK(!output.failed());
+    output.write("more than sixteen bytes of text");
+    CHECK(!output.flush());
+    CHECK(output.failed());
+  }
+}
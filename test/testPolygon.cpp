@@ -17,6 +17,7 @@
 // Includes
 #include <iostream>
 #include <string>
+#include <utility>
 #include <stdexcept>
 
 // Tested modules
@@ -255,6 +256,37 @@ SUITE(PolygonClass)
     CHECK(!p.isNonSelfIntersecting());
   }
 
+  TEST(IsSimpleDegenerate)
+  {
+    /* Collinear vertices are fine, a spike going back along
+       an edge and edges touching a vertex are not. */
+    Polygon p;
+    p.addVertex(Point(0,0));
+    p.addVertex(Point(5,0));
+    p.addVertex(Point(10,0));
+    p.addVertex(Point(10,10));
+    p.addVertex(Point(0,10));
+    CHECK(p.isNonSelfIntersecting());
+
+    Polygon spike;
+    spike.addVertex(Point(0,0));
+    spike.addVertex(Point(10,0));
+    spike.addVertex(Point(5,0));
+    spike.addVertex(Point(5,10));
+    CHECK(!spike.isNonSelfIntersecting());
+
+    Polygon touching;
+    touching.addVertex(Point(0,0));
+    touching.addVertex(Point(10,0));
+    touching.addVertex(Point(10,10));
+    touching.addVertex(Point(5,0));
+    touching.addVertex(Point(0,10));
+    CHECK(!touching.isNonSelfIntersecting());
+
+    Polygon flat(Point(0,0), Point(5,0), Point(10,0));
+    CHECK(!flat.isNonSelfIntersecting());
+  }
+
   TEST(Triangulation)
   {
     Polygon p;
@@ -351,4 +383,28 @@ SUITE(PolygonClass)
 // DEBUG: original split:Line(Point(355.508, 2049.5, 0), Point(355.508, 2048.5, 0))
     CHECK(2 == newOnes.size());
   }
-}
\ No newline at end of file
+
+  TEST(CopyAndMove)
+  {
+    Polygon p(Point(0,0), Point(10,0), Point(10,10), Point(0,10));
+
+    Polygon copy(p);
+    copy.updateVertex(0, Point(-1,-1));
+    CHECK(p.vertex(0) == Point(0,0));
+    CHECK(copy.vertex(0) == Point(-1,-1));
+
+    Polygon moved(std::move(copy));
+    CHECK_EQUAL(4u, moved.numberOfVertices());
+    CHECK(moved.vertex(0) == Point(-1,-1));
+
+    copy = std::move(moved);
+    CHECK_EQUAL(4u, copy.numberOfVertices());
+    CHECK_CLOSE(p.area() + 10, copy.area(), 1e-9);
+
+    /* Moving a polygon into itself keeps its vertices. */
+    Polygon* same = &copy;
+    copy = std::move(*same);
+    CHECK_EQUAL(4u, copy.numberOfVertices());
+    CHECK(copy.vertex(0) == Point(-1,-1));
+  }
+}
@@ -0,0 +1,157 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testPredicates.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of exact geometric predicates
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <cmath>
+
+// Tested modules
+#include "../src/geometry/predicates.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/ray.h"
+#include "../src/geometry/polygon.h"
+
+SUITE(Predicates)
+{
+  TEST(Orientation)
+  {
+    CHECK_EQUAL(1, Predicates::orientation(Point(0, 0), Point(10, 0), Point(5, 5)));
+    CHECK_EQUAL(-1, Predicates::orientation(Point(0, 0), Point(10, 0), Point(5, -5)));
+    CHECK_EQUAL(0, Predicates::orientation(Point(0, 0), Point(10, 0), Point(20, 0)));
+    CHECK_EQUAL(0, Predicates::orientation(Point(3, 3), Point(3, 3), Point(3, 3)));
+  }
+
+  TEST(NearlyCollinear)
+  {
+    /* Points on the line y = x shifted by one unit in the last
+       place. Plain doubles get some of these wrong, the exact
+       result must be consistent with the shift. */
+    double base = 0.5;
+    for (int i = 0; i < 64; i++)
+    {
+      double x = base + i * std::ldexp(1.0, -52),
+             above = std::nextafter(x, 1.0),
+             below = std::nextafter(x, 0.0);
+      CHECK_EQUAL(0, Predicates::orientation(12, 12, 24, 24, x, x));
+      CHECK_EQUAL(1, Predicates::orientation(12, 12, 24, 24, x, above));
+      CHECK_EQUAL(-1, Predicates::orientation(12, 12, 24, 24, x, below));
+    }
+  }
+
+  TEST(LargeCoordinates)
+  {
+    /* Far from the origin the differences lose their low bits. */
+    double offset = 1e9;
+    CHECK_EQUAL(0, Predicates::orientation(offset, offset, offset + 1, offset + 1, offset + 3, offset + 3));
+    CHECK_EQUAL(1, Predicates::orientation(offset, offset, offset + 1, offset + 1,
+                                           offset + 3, std::nextafter(offset + 3, 2 * offset)));
+    CHECK_EQUAL(-1, Predicates::orientation(offset, offset, offset + 1, offset + 1,
+                                            std::nextafter(offset + 3, 2 * offset), offset + 3));
+  }
+
+  TEST(OrientationIsConsistent)
+  {
+    /* Swapping two points must flip the sign exactly. */
+    Point a(0.1, 0.1), b(0.7, 0.3), c(1.3, 0.5 + 1e-17);
+    int abc = Predicates::orientation(a, b, c);
+    CHECK_EQUAL(abc, Predicates::orientation(b, c, a));
+    CHECK_EQUAL(abc, Predicates::orientation(c, a, b));
+    CHECK_EQUAL(-abc, Predicates::orientation(b, a, c));
+    CHECK_EQUAL(-abc, Predicates::orientation(a, c, b));
+  }
+
+  TEST(InCircle)
+  {
+    Point a(0, 0), b(10, 0), c(10, 10);
+    CHECK_EQUAL(1, Predicates::inCircle(a, b, c, Point(5, 5)));
+    CHECK_EQUAL(-1, Predicates::inCircle(a, b, c, Point(20, 20)));
+    /* Cocircular, a corner of the square */
+    CHECK_EQUAL(0, Predicates::inCircle(a, b, c, Point(0, 10)));
+
+    double offset = 1e6;
+    Point farA(offset, offset), farB(offset + 10, offset), farC(offset + 10, offset + 10);
+    CHECK_EQUAL(0, Predicates::inCircle(farA, farB, farC, Point(offset, offset + 10)));
+    CHECK_EQUAL(1, Predicates::inCircle(farA, farB, farC, Point(offset, std::nextafter(offset + 10, 0.0))));
+    CHECK_EQUAL(-1, Predicates::inCircle(farA, farB, farC, Point(offset, std::nextafter(offset + 10, 2 * offset))));
+  }
+
+  TEST(SegmentRelation)
+  {
+    CHECK_EQUAL(Predicates::CROSSING,
+                Predicates::segmentRelation(Point(0, 0), Point(10, 10), Point(0, 10), Point(10, 0)));
+    CHECK_EQUAL(Predicates::TOUCHING,
+                Predicates::segmentRelation(Point(0, 0), Point(10, 0), Point(5, 0), Point(5, 10)));
+    CHECK_EQUAL(Predicates::TOUCHING,
+                Predicates::segmentRelation(Point(0, 0), Point(10, 0), Point(10, 0), Point(20, 0)));
+    CHECK_EQUAL(Predicates::OVERLAPPING,
+                Predicates::segmentRelation(Point(0, 0), Point(10, 0), Point(5, 0), Point(20, 0)));
+    CHECK_EQUAL(Predicates::OVERLAPPING,
+                Predicates::segmentRelation(Point(0, 0), Point(0, 10), Point(0, 2), Point(0, 5)));
+    CHECK_EQUAL(Predicates::DISJOINT,
+                Predicates::segmentRelation(Point(0, 0), Point(10, 0), Point(11, 0), Point(20, 0)));
+    CHECK_EQUAL(Predicates::DISJOINT,
+                Predicates::segmentRelation(Point(0, 0), Point(10, 0), Point(5, 1), Point(5, 10)));
+  }
+
+  TEST(DegenerateSegments)
+  {
+    /* The crossing lies on an end of the other segment,
+       the end itself is returned. */
+    Point intersection;
+    LineSegment first(Point(0.1, 0.1), Point(0.3, 0.3)),
+                second(Point(0.2, 0.2), Point(0.2, 5));
+    CHECK_EQUAL(LineSegment::INTERSECTING, first.intersection2D(second, &intersection));
+    CHECK(intersection == Point(0.2, 0.2));
+
+    /* Nearly parallel lines far from the origin */
+    double offset = 1e7;
+    LineSegment left(Point(offset, offset), Point(offset + 1000, offset + 1)),
+                right(Point(offset, offset + 1e-3), Point(offset + 1000, offset + 1 - 1e-3));
+    CHECK_EQUAL(LineSegment::INTERSECTING, left.intersection2D(right, &intersection));
+    CHECK(intersection.x() >= offset && intersection.x() <= offset + 1000);
+
+    LineSegment above(Point(offset, offset + 1e-3), Point(offset + 1000, offset + 1 + 1e-3));
+    CHECK_EQUAL(LineSegment::NONINTERSECTING, left.intersection2D(above, &intersection));
+
+    /* Closer than the tolerance they are the same segment */
+    LineSegment close(Point(offset, offset + 1e-6), Point(offset + 1000, offset + 1 + 1e-6));
+    CHECK_EQUAL(LineSegment::IDENTICAL, left.intersection2D(close, &intersection));
+  }
+
+  TEST(VerticalRays)
+  {
+    /* Slopes of vertical lines are not defined. */
+    Point intersection;
+    Ray vertical(Point(0, 0), Vector(0, 1)),
+        parallel(Point(5, 0), Vector(0, 1));
+    CHECK_EQUAL(Ray::PARALLEL, vertical.intersection2D(parallel, &intersection));
+
+    Ray crossing(Point(-5, 5), Vector(1, 0));
+    CHECK_EQUAL(Ray::INTERSECTING, vertical.intersection2D(crossing, &intersection));
+    CHECK(intersection == Point(0, 5));
+  }
+
+  TEST(PointOnPolygonEdge)
+  {
+    Polygon triangle(Point(0.1, 0.1), Point(0.7, 0.1), Point(0.1, 0.7));
+    CHECK(triangle.encloses2D(Point(0.2, 0.2)));
+    CHECK(triangle.encloses2D(Point(0.4, 0.4)));
+    CHECK(triangle.encloses2D(Point(0.1, 0.4)));
+    CHECK(!triangle.encloses2D(Point(0.401, 0.401)));
+    CHECK(!triangle.encloses2D(Point(0.099, 0.4)));
+    CHECK(!triangle.encloses2D(Point(1, 1)));
+  }
+}
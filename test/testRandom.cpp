@@ -95,4 +95,77 @@ SUITE(RandomClass)
     CHECK_EQUAL(0, generator.generateBool(0));
     CHECK_EQUAL(0, generator.generateBool(0));
   }
-}
\ No newline at end of file
+
+  TEST(CounterRandom)
+  {
+    CounterRandom generator(libcity::RANDOM_SEED), same(libcity::RANDOM_SEED), other(42);
+
+    /* Depends only on the seed and the counter */
+    CHECK_EQUAL(generator.generate(3, 7), same.generate(3, 7));
+    CHECK(generator.generate(3, 7) != generator.generate(7, 3));
+    CHECK(generator.generate(3, 7) != generator.generate(3, 8));
+    CHECK(generator.generate(3, 7) != other.generate(3, 7));
+
+    int histogram[3] = {0, 0, 0};
+    for (int index = 0; index < 3000; index++)
+    {
+      int value = generator.generateInteger(1, index, 0, 2);
+      CHECK(value >= 0 && value <= 2);
+      histogram[value]++;
+
+      double real = generator.generateDouble(2, index, -1, 1);
+      CHECK(real >= -1 && real < 1);
+    }
+    CHECK(histogram[0] > 800 && histogram[1] > 800 && histogram[2] > 800);
+
+    CHECK(generator.generateInteger(0, 0, -3, -3) == -3);
+    int negative = generator.generateInteger(0, 1, -3, -1);
+    CHECK(negative >= -3 && negative <= -1);
+  }
+
+  TEST(RandomEngine)
+  {
+    RandomEngine engine(42), same(42), other(43);
+    for (int i = 0; i < 100; i++)
+    {
+      CHECK_EQUAL(engine.next(), same.next());
+    }
+    CHECK(engine.next() != other.next());
+
+    for (int i = 0; i < 1000; i++)
+    {
+      double value = engine.nextDouble();
+      CHECK(value >= 0 && value < 1);
+    }
+
+    /* Children don't repeat the parent */
+    RandomEngine parent(42), first = parent.split(), second = parent.split();
+    unsigned long long fromFirst = first.next(), fromSecond = second.next(), fromParent = parent.next();
+    CHECK(fromFirst != fromSecond);
+    CHECK(fromFirst != fromParent);
+    CHECK(fromSecond != fromParent);
+    CHECK_EQUAL(RandomEngine(42).next(), fromFirst);
+
+    /* Splitting is reproducible */
+    RandomEngine again(42);
+    again.split();
+    CHECK_EQUAL(again.split().next(), fromSecond);
+  }
+
+  TEST(RandomWithEngine)
+  {
+    Random::setSeed(7);
+    RandomEngine engine(42), same(42);
+    Random generator(&engine);
+    for (int i = 0; i < 100; i++)
+    {
+      int value = generator.generateInteger(0, 9);
+      CHECK(value >= 0 && value <= 9);
+      CHECK_EQUAL((int)(same.nextDouble() * 10), value);
+    }
+
+    /* The shared seed wasn't touched */
+    CHECK_EQUAL(Random().generateInteger(0, 1000000), Random(7).generateInteger(0, 1000000));
+    Random::setSeed(libcity::RANDOM_SEED);
+  }
+}
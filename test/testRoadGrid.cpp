@@ -0,0 +1,114 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testRoadGrid.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of RoadGrid class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+// Tested modules
+#include "../src/streetgraph/roadgrid.h"
+#include "../src/streetgraph/road.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/path.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/debug.h"
+
+SUITE(RoadGridClass)
+{
+  TEST(Query)
+  {
+    RoadGrid grid(100);
+    Intersection a(Point(0, 0)), b(Point(1000, 0)),
+                 c(Point(0, 500)), d(Point(50, 550)),
+                 e(Point(-300, -300)), f(Point(300, 300));
+
+    Road horizontal(&a, &b), shortOne(&c, &d), diagonal(&e, &f);
+    grid.insert(&horizontal);
+    grid.insert(&shortOne);
+    grid.insert(&diagonal);
+    CHECK_EQUAL(3, grid.size());
+
+    std::vector<Road*> found;
+    grid.query(880, -5, 890, 5, &found);
+    CHECK_EQUAL(1u, found.size());
+    CHECK(found[0] == &horizontal);
+
+    grid.query(-10, -10, 10, 10, &found);
+    CHECK_EQUAL(2u, found.size());
+    CHECK(found[0] == &horizontal);
+    CHECK(found[1] == &diagonal);
+
+    /* Far away from the diagonal, but inside its bounding box. */
+    grid.query(-290, 250, -280, 260, &found);
+    CHECK_EQUAL(0u, found.size());
+
+    grid.query(-1e4, -1e4, 1e4, 1e4, &found);
+    CHECK_EQUAL(3u, found.size());
+    CHECK(found[0] == &horizontal);
+    CHECK(found[1] == &shortOne);
+    CHECK(found[2] == &diagonal);
+
+    grid.remove(&horizontal);
+    grid.query(-10, -10, 10, 10, &found);
+    CHECK_EQUAL(1u, found.size());
+    CHECK(found[0] == &diagonal);
+    CHECK_EQUAL(2, grid.size());
+  }
+
+  TEST(Update)
+  {
+    RoadGrid grid(100);
+    Intersection a(Point(0, 0)), b(Point(1000, 0)), c(Point(500, 0)),
+                 d(Point(0, 20)), e(Point(1000, 20));
+
+    Road first(&a, &b), second(&d, &e);
+    grid.insert(&first);
+    grid.insert(&second);
+
+    first.setEnd(&c);
+    grid.update(&first);
+
+    std::vector<Road*> found;
+    grid.query(800, -50, 900, 50, &found);
+    CHECK_EQUAL(1u, found.size());
+    CHECK(found[0] == &second);
+
+    /* Updated road keeps its order. */
+    grid.query(100, -50, 200, 50, &found);
+    CHECK_EQUAL(2u, found.size());
+    CHECK(found[0] == &first);
+    CHECK(found[1] == &second);
+  }
+
+  TEST(StreetGraphCrossing)
+  {
+    StreetGraph graph;
+    for (int i = 0; i < 20; i++)
+    {
+      graph.addRoad(Path(LineSegment(Point(i * 100, -1000), Point(i * 100, 1000))));
+    }
+    graph.addRoad(Path(LineSegment(Point(-50, 0), Point(1950, 0))));
+
+    /* 20 vertical roads split in two + the horizontal split into 21 */
+    CHECK_EQUAL(61u, graph.getRoads().size());
+    CHECK(graph.isIntersectionAtPosition(Point(700, 0)));
+    CHECK_EQUAL(4, graph.getIntersectionAtPosition(Point(700, 0))->numberOfWays());
+  }
+}
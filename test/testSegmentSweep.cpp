@@ -0,0 +1,135 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testSegmentSweep.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of SegmentSweep class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <vector>
+#include <cmath>
+
+// Tested modules
+#include "../src/geometry/segmentsweep.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/point.h"
+#include "../src/random.h"
+
+SUITE(SegmentSweep)
+{
+  TEST(Crossings)
+  {
+    std::vector<LineSegment> segments;
+    segments.push_back(LineSegment(Point(0, 0), Point(100, 100)));
+    segments.push_back(LineSegment(Point(0, 100), Point(100, 0)));
+    segments.push_back(LineSegment(Point(200, 0), Point(300, 0)));
+    segments.push_back(LineSegment(Point(300, 0), Point(300, 100)));
+    segments.push_back(LineSegment(Point(200, 50), Point(250, 50)));
+    segments.push_back(LineSegment(Point(400, 0), Point(500, 0)));
+    segments.push_back(LineSegment(Point(450, 0), Point(550, 0)));
+
+    std::vector<SegmentSweep::Crossing> crossings;
+    SegmentSweep(segments).findCrossings(&crossings);
+
+    CHECK_EQUAL(3u, crossings.size());
+    CHECK_EQUAL(0, crossings[0].first);
+    CHECK_EQUAL(1, crossings[0].second);
+    CHECK(crossings[0].point == Point(50, 50));
+    CHECK_EQUAL(2, crossings[1].first);
+    CHECK_EQUAL(3, crossings[1].second);
+    CHECK(crossings[1].point == Point(300, 0));
+    CHECK_EQUAL(5, crossings[2].first);
+    CHECK_EQUAL(6, crossings[2].second);
+    CHECK_EQUAL(LineSegment::OVERLAPING, crossings[2].type);
+  }
+
+  TEST(SameAsTestingAllPairs)
+  {
+    Random generator(libcity::RANDOM_SEED);
+    std::vector<LineSegment> segments;
+    for (int i = 0; i < 400; i++)
+    {
+      double x = generator.generateDouble(0, 2000),
+             y = generator.generateDouble(0, 2000),
+             angle = generator.generateDouble(0, 6.28),
+             length = generator.generateDouble(20, 300);
+      segments.push_back(LineSegment(Point(x, y),
+                                     Point(x + length * std::cos(angle), y + length * std::sin(angle))));
+    }
+
+    std::vector<SegmentSweep::Crossing> crossings;
+    SegmentSweep(segments).findCrossings(&crossings);
+
+    unsigned int found = 0;
+    Point intersection;
+    for (unsigned int first = 0; first < segments.size(); first++)
+    {
+      for (unsigned int second = first + 1; second < segments.size(); second++)
+      {
+        LineSegment::Intersection type = segments[first].intersection2D(segments[second], &intersection);
+        if (type != LineSegment::NONINTERSECTING)
+        {
+          CHECK(found < crossings.size());
+          if (found < crossings.size())
+          {
+            CHECK_EQUAL(static_cast<int>(first), crossings[found].first);
+            CHECK_EQUAL(static_cast<int>(second), crossings[found].second);
+            CHECK_EQUAL(type, crossings[found].type);
+            if (type == LineSegment::INTERSECTING)
+            {
+              CHECK(crossings[found].point == intersection);
+            }
+          }
+          found++;
+        }
+      }
+    }
+    CHECK(found > 50);
+    CHECK_EQUAL(found, crossings.size());
+  }
+
+  TEST(GridReportedOnce)
+  {
+    /* Touching segments meet exactly on the borders of the bands */
+    std::vector<LineSegment> segments;
+    for (int i = 0; i < 20; i++)
+    {
+      for (int j = 0; j + 1 < 20; j++)
+      {
+        segments.push_back(LineSegment(Point(j * 10, i * 10), Point((j + 1) * 10, i * 10)));
+        segments.push_back(LineSegment(Point(i * 10, j * 10), Point(i * 10, (j + 1) * 10)));
+      }
+    }
+
+    std::vector<SegmentSweep::Crossing> crossings;
+    SegmentSweep(segments).findCrossings(&crossings);
+
+    unsigned int expected = 0;
+    Point intersection;
+    for (unsigned int first = 0; first < segments.size(); first++)
+    {
+      for (unsigned int second = first + 1; second < segments.size(); second++)
+      {
+        if (segments[first].intersection2D(segments[second], &intersection) != LineSegment::NONINTERSECTING)
+        {
+          expected++;
+        }
+      }
+    }
+    CHECK_EQUAL(expected, crossings.size());
+
+    for (unsigned int i = 1; i < crossings.size(); i++)
+    {
+      CHECK(crossings[i - 1].first != crossings[i].first || crossings[i - 1].second != crossings[i].second);
+    }
+  }
+}
@@ -17,6 +17,7 @@
 // Includes
 #include <iostream>
 #include <string>
+#include <utility>
 #include <stdexcept>
 
 // Tested modules
@@ -86,4 +87,19 @@ SUITE(ShapeClass)
     insider.setBase(p2);
     CHECK(!s.encloses(insider));
   }
-}
\ No newline at end of file
+
+  TEST(ConstructFromBase)
+  {
+    Polygon p(Point(0,0), Point(10,0), Point(10,10), Point(0,10));
+
+    Shape shape(p, 5);
+    CHECK_EQUAL(4u, shape.base().numberOfVertices());
+    CHECK_EQUAL(5, shape.height());
+    CHECK(shape.encloses(Point(5,5,5)));
+    CHECK(!shape.encloses(Point(5,5,6)));
+
+    Shape moved(std::move(shape));
+    CHECK_EQUAL(4u, moved.base().numberOfVertices());
+    CHECK_EQUAL(5, moved.height());
+  }
+}
@@ -0,0 +1,306 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testSpatialIndex.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of SpatialIndex class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <list>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Tested modules
+#include "../src/area/spatialindex.h"
+#include "../src/area/zone.h"
+#include "../src/area/block.h"
+#include "../src/area/lot.h"
+#include "../src/entities/building.h"
+#include "../src/city.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+
+namespace
+{
+  const double LOT_SIZE = 10;
+  const int LOTS_PER_BLOCK = 12; /**< Along each side of a block. */
+  const double BLOCK_SIZE = LOT_SIZE * LOTS_PER_BLOCK;
+
+  Polygon square(double x, double y, double size)
+  {
+    return Polygon(Point(x, y), Point(x + size, y), Point(x + size, y + size), Point(x, y + size));
+  }
+
+  /** One zone of 2x2 blocks divided into square lots, each with a building. */
+  class GridCity : public City
+  {
+    public:
+      virtual ~GridCity()
+      {
+        for (std::vector<Building*>::iterator building = buildings.begin(); building != buildings.end(); building++)
+        {
+          delete *building;
+        }
+        for (std::vector<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          delete *lot;
+        }
+        for (std::vector<Block*>::iterator block = blocks.begin(); block != blocks.end(); block++)
+        {
+          delete *block;
+        }
+        for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+        {
+          delete *zone;
+        }
+      }
+
+      std::vector<Block*> blocks;
+      std::vector<Lot*> lots;
+      std::vector<Building*> buildings;
+
+    protected:
+      virtual void createPrimaryRoadNetwork()
+      {}
+
+      virtual void createZones()
+      {
+        Zone* zone = new Zone(map);
+        zone->setAreaConstraints(square(0, 0, 2 * BLOCK_SIZE));
+        zones->push_back(zone);
+      }
+
+      virtual void createSecondaryRoadNetwork()
+      {}
+
+      virtual void createBlocks()
+      {
+        Zone* zone = zones->front();
+        for (int blockRow = 0; blockRow < 2; blockRow++)
+        {
+          for (int blockColumn = 0; blockColumn < 2; blockColumn++)
+          {
+            double left = blockColumn * BLOCK_SIZE, bottom = blockRow * BLOCK_SIZE;
+            Block* block = new Block(zone, square(left, bottom, BLOCK_SIZE));
+            zone->addBlock(block);
+            blocks.push_back(block);
+
+            for (int row = 0; row < LOTS_PER_BLOCK; row++)
+            {
+              for (int column = 0; column < LOTS_PER_BLOCK; column++)
+              {
+                Lot* lot = new Lot(block, square(left + column * LOT_SIZE, bottom + row * LOT_SIZE, LOT_SIZE));
+                block->addLot(lot);
+                lots.push_back(lot);
+              }
+            }
+          }
+        }
+      }
+
+      virtual void createBuildings()
+      {
+        for (std::vector<Lot*>::iterator lot = lots.begin(); lot != lots.end(); lot++)
+        {
+          buildings.push_back(new Building(*lot));
+        }
+      }
+  };
+
+  /** Lower left corner of a lot. */
+  Point corner(Lot* lot)
+  {
+    Polygon constraints = lot->areaConstraints();
+    return Point(std::min(constraints.vertex(0).x(), constraints.vertex(2).x()),
+                 std::min(constraints.vertex(0).y(), constraints.vertex(2).y()));
+  }
+
+  std::vector<Lot*> sorted(std::vector<Lot*> lots)
+  {
+    std::sort(lots.begin(), lots.end());
+    return lots;
+  }
+
+  /** Lots with a box overlapping the rectangle, found one by one. */
+  std::vector<Lot*> lotsInBox(std::vector<Lot*> const& lots, double minX, double minY, double maxX, double maxY)
+  {
+    std::vector<Lot*> found;
+    for (std::vector<Lot*>::const_iterator lot = lots.begin(); lot != lots.end(); lot++)
+    {
+      Point lower = corner(*lot);
+      if (lower.x() <= maxX && lower.x() + LOT_SIZE >= minX &&
+          lower.y() <= maxY && lower.y() + LOT_SIZE >= minY)
+      {
+        found.push_back(*lot);
+      }
+    }
+    return sorted(found);
+  }
+
+  /** Lots overlapping the diamond |x - cx| + |y - cy| <= radius, found one by one. */
+  std::vector<Lot*> lotsInDiamond(std::vector<Lot*> const& lots, Point const& center, double radius)
+  {
+    std::vector<Lot*> found;
+    for (std::vector<Lot*>::const_iterator lot = lots.begin(); lot != lots.end(); lot++)
+    {
+      Point lower = corner(*lot);
+      double nearestX = std::min(std::max(center.x(), lower.x()), lower.x() + LOT_SIZE),
+             nearestY = std::min(std::max(center.y(), lower.y()), lower.y() + LOT_SIZE);
+      if (std::fabs(nearestX - center.x()) + std::fabs(nearestY - center.y()) <= radius)
+      {
+        found.push_back(*lot);
+      }
+    }
+    return sorted(found);
+  }
+
+  Polygon diamond(Point const& center, double radius)
+  {
+    return Polygon(Point(center.x() + radius, center.y()), Point(center.x(), center.y() + radius),
+                   Point(center.x() - radius, center.y()), Point(center.x(), center.y() - radius));
+  }
+}
+
+SUITE(SpatialIndexClass)
+{
+  TEST(BoxMatchesBruteForce)
+  {
+    GridCity city;
+    city.generate();
+
+    SpatialIndex index;
+    city.buildSpatialIndex(&index);
+    CHECK_EQUAL(1 + 4 + 4 * LOTS_PER_BLOCK * LOTS_PER_BLOCK, index.size());
+    CHECK_EQUAL(4, index.size(SpatialIndex::BLOCKS));
+
+    SpatialIndex::Result result;
+    for (double minX = -15; minX < 2 * BLOCK_SIZE; minX += 37)
+    {
+      for (double minY = -15; minY < 2 * BLOCK_SIZE; minY += 29)
+      {
+        double maxX = minX + 43, maxY = minY + 61;
+        index.query(minX, minY, maxX, maxY, &result, SpatialIndex::LOTS);
+        CHECK(sorted(result.lots) == lotsInBox(city.lots, minX, minY, maxX, maxY));
+        CHECK(result.zones.empty());
+      }
+    }
+
+    /* Touching counts as overlapping */
+    index.query(LOT_SIZE, LOT_SIZE, LOT_SIZE, LOT_SIZE, &result, SpatialIndex::LOTS);
+    CHECK_EQUAL(4u, result.lots.size());
+  }
+
+  TEST(FootprintMatchesBruteForce)
+  {
+    GridCity city;
+    city.generate();
+
+    SpatialIndex index;
+    city.buildSpatialIndex(&index);
+
+    SpatialIndex::Result result;
+    double radii[] = {3.5, 27.5, 96.5, 400};
+    for (int i = 0; i < 4; i++)
+    {
+      for (double x = -20; x < 2 * BLOCK_SIZE + 20; x += 41)
+      {
+        Point center(x, 0.7 * x + 11);
+        index.query(diamond(center, radii[i]), &result, SpatialIndex::LOTS);
+        CHECK(sorted(result.lots) == lotsInDiamond(city.lots, center, radii[i]));
+      }
+    }
+  }
+
+  TEST(FootprintOrientation)
+  {
+    GridCity city;
+    city.generate();
+
+    SpatialIndex index;
+    city.buildSpatialIndex(&index);
+
+    Polygon counterclockwise = diamond(Point(100, 130), 55);
+    Polygon clockwise;
+    for (int i = counterclockwise.numberOfVertices() - 1; i >= 0; i--)
+    {
+      clockwise.addVertex(counterclockwise.vertex(i));
+    }
+
+    SpatialIndex::Result first, second;
+    index.query(counterclockwise, &first);
+    index.query(clockwise, &second);
+    CHECK(!first.lots.empty());
+    CHECK(first.lots == second.lots);
+    CHECK(first.blocks == second.blocks);
+  }
+
+  TEST(Kinds)
+  {
+    GridCity city;
+    city.generate();
+
+    SpatialIndex index;
+    city.buildSpatialIndex(&index);
+    CHECK_EQUAL(0, index.size(SpatialIndex::BUILDINGS));
+
+    SpatialIndex::Result result;
+    index.query(5, 5, 6, 6, &result, SpatialIndex::ZONES | SpatialIndex::BLOCKS);
+    CHECK_EQUAL(2, result.size());
+    CHECK_EQUAL(1u, result.zones.size());
+    CHECK_EQUAL(1u, result.blocks.size());
+    CHECK(result.blocks[0] == city.blocks[0]);
+    CHECK(result.lots.empty());
+
+    /* Buildings are found by their lots */
+    for (std::vector<Building*>::iterator building = city.buildings.begin();
+         building != city.buildings.end();
+         building++)
+    {
+      index.insert(*building);
+    }
+    index.build();
+    CHECK_EQUAL(static_cast<int>(city.buildings.size()), index.size(SpatialIndex::BUILDINGS));
+
+    index.query(5, 5, 6, 6, &result);
+    CHECK_EQUAL(4, result.size());
+    CHECK_EQUAL(1u, result.buildings.size());
+    CHECK_EQUAL(1u, result.lots.size());
+    CHECK(result.buildings[0]->lot() == result.lots[0]);
+  }
+
+  TEST(Empty)
+  {
+    SpatialIndex index;
+    SpatialIndex::Result result;
+    index.build();
+    index.query(-100, -100, 100, 100, &result);
+    CHECK_EQUAL(0, result.size());
+
+    GridCity city;
+    city.generate();
+    city.buildSpatialIndex(&index);
+
+    /* Inverted rectangle and degenerate footprints */
+    index.query(100, 100, -100, -100, &result);
+    CHECK_EQUAL(0, result.size());
+    index.query(Polygon(Point(0, 0), Point(100, 100), Point(200, 200)), &result);
+    CHECK_EQUAL(0, result.size());
+    index.query(Polygon(), &result);
+    CHECK_EQUAL(0, result.size());
+
+    index.clear();
+    CHECK_EQUAL(0, index.size());
+    index.query(-100, -100, 1000, 1000, &result);
+    CHECK_EQUAL(0, result.size());
+  }
+}
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include <cmath>
 
 // Tested modules
 #include "../src/streetgraph/streetgraph.h"
@@ -26,6 +27,105 @@
 #include "../src/geometry/point.h"
 #include "../src/geometry/linesegment.h"
 #include "../src/streetgraph/path.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/road.h"
+#include "../src/streetgraph/face.h"
+#include "../src/streetgraph/streetgraphlistener.h"
+#include "../src/streetgraph/areaextractor.h"
+#include "../src/area/zone.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "../src/random.h"
+
+namespace
+{
+  class FaceCounter : public StreetGraphListener
+  {
+    public:
+      FaceCounter() : added(0), removed(0) {}
+
+      virtual void faceAdded(Face const& face) { added++; }
+      virtual void faceRemoved(Face const& face) { removed++; }
+
+      int added;
+      int removed;
+  };
+
+  typedef std::vector< std::pair<double, double> > Outline;
+
+  Outline outline(Polygon const& polygon)
+  {
+    Outline result;
+    for (unsigned int i = 0; i < polygon.numberOfVertices(); i++)
+    {
+      result.push_back(std::make_pair(polygon.vertex(i).x(), polygon.vertex(i).y()));
+    }
+    std::rotate(result.begin(), std::min_element(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+  /** Are the tracked faces the same as faces found from scratch? */
+  bool facesAreCurrent(StreetGraph* graph)
+  {
+    std::vector<Outline> tracked, found;
+    std::vector<Face> faces = graph->getFaces();
+    for (unsigned int i = 0; i < faces.size(); i++)
+    {
+      tracked.push_back(outline(faces[i].polygon()));
+    }
+
+    std::list<Zone*> zones = graph->findZones(AreaExtractor::HALF_EDGE_FACES);
+    for (std::list<Zone*>::iterator zone = zones.begin(); zone != zones.end(); zone++)
+    {
+      found.push_back(outline((*zone)->areaConstraints()));
+      delete *zone;
+    }
+
+    std::sort(tracked.begin(), tracked.end());
+    std::sort(found.begin(), found.end());
+    return tracked == found;
+  }
+
+  typedef std::pair<std::pair<double, double>, std::pair<double, double> > RoadEnds;
+
+  /** Roads of the graph in a canonical order, rounded to centimetres. */
+  std::vector<RoadEnds> roadEnds(StreetGraph* graph)
+  {
+    std::vector<RoadEnds> result;
+    for (StreetGraph::iterator road = graph->begin(); road != graph->end(); road++)
+    {
+      Point begining = (*road)->begining()->position(),
+            end      = (*road)->end()->position();
+      std::pair<double, double> first(std::floor(begining.x() * 100 + 0.5), std::floor(begining.y() * 100 + 0.5)),
+                                second(std::floor(end.x() * 100 + 0.5), std::floor(end.y() * 100 + 0.5));
+      result.push_back(first < second ? std::make_pair(first, second) : std::make_pair(second, first));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  /** Is adding paths at once the same as adding them one by one? */
+  bool batchMatchesSequential(std::vector<Path> const& existing, std::vector<Path> const& paths)
+  {
+    StreetGraph sequential, batch;
+    for (unsigned int i = 0; i < existing.size(); i++)
+    {
+      sequential.addRoad(existing[i]);
+      batch.addRoad(existing[i]);
+    }
+
+    for (unsigned int i = 0; i < paths.size(); i++)
+    {
+      sequential.addRoad(paths[i]);
+    }
+    batch.addRoads(paths);
+
+    return roadEnds(&sequential) == roadEnds(&batch);
+  }
+}
 
 SUITE(StreetGraphClass)
 {
@@ -36,4 +136,289 @@ SUITE(StreetGraphClass)
     sg->addRoad(Path(LineSegment(Point(-3000, -2509.3, 0), Point(-3000, -2244.59, 0))));
     sg->addRoad(Path(LineSegment(Point(-3000, 837.305, 0), Point(-3000, -2509.3, 0))));*/
   }
-}
\ No newline at end of file
+
+  TEST(RadiusQueries)
+  {
+    StreetGraph graph;
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(1000, 0))));
+    graph.addRoad(Path(LineSegment(Point(0, 100), Point(0, 600))));
+    graph.addRoad(Path(LineSegment(Point(2000, 2000), Point(2500, 2000))));
+
+    std::vector<Road*> roads;
+    graph.getRoadsInRadius(Point(500, 50), 60, &roads);
+    CHECK_EQUAL(1u, roads.size());
+    CHECK(roads[0]->end()->position() == Point(1000, 0));
+
+    graph.getRoadsInRadius(Point(50, 50), 80, &roads);
+    CHECK_EQUAL(2u, roads.size());
+    CHECK(roads[0]->end()->position() == Point(1000, 0));
+    CHECK(roads[1]->begining()->position() == Point(0, 100));
+
+    graph.getRoadsInRadius(Point(1500, 1000), 100, &roads);
+    CHECK_EQUAL(0u, roads.size());
+
+    std::vector<Intersection*> intersections;
+    graph.getIntersectionsInRadius(Point(0, 50), 50, &intersections);
+    CHECK_EQUAL(2u, intersections.size());
+    CHECK(intersections[0]->position() == Point(0, 0));
+    CHECK(intersections[1]->position() == Point(0, 100));
+
+    graph.getIntersectionsInRadius(Point(2250, 2000), 200, &intersections);
+    CHECK_EQUAL(0u, intersections.size());
+  }
+
+  TEST(Ranges)
+  {
+    StreetGraph graph;
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(100, 0))));
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(0, 100))));
+    graph.addRoad(Path(LineSegment(Point(-100, 0), Point(0, 0))));
+
+    StreetGraph::Roads roads = graph.getRoads();
+    StreetGraph::RoadRange roadRange = graph.roadRange();
+    CHECK_EQUAL(3, roadRange.size());
+    CHECK(std::equal(roads.begin(), roads.end(), roadRange.begin()));
+
+    StreetGraph::Intersections intersections = graph.getIntersections();
+    StreetGraph::IntersectionRange intersectionRange = graph.intersectionRange();
+    CHECK_EQUAL(4, graph.numberOfIntersections());
+    CHECK_EQUAL(4, intersectionRange.size());
+    CHECK(std::equal(intersections.begin(), intersections.end(), intersectionRange.begin()));
+
+    Intersection* center = graph.getIntersectionAtPosition(Point(0, 0));
+    std::list<Road*> centerRoads = center->getRoads();
+    Intersection::RoadRange centerRoadRange = center->roadRange();
+    CHECK_EQUAL(3, centerRoadRange.size());
+    CHECK(std::equal(centerRoads.begin(), centerRoads.end(), centerRoadRange.begin()));
+
+    std::vector<Intersection*> adjacent = center->adjacentIntersections();
+    Intersection::AdjacentRange adjacentRange = center->adjacentRange();
+    CHECK_EQUAL(3, adjacentRange.size());
+    CHECK(std::equal(adjacent.begin(), adjacent.end(), adjacentRange.begin()));
+
+    int visited = 0;
+    for (Intersection* neighbour : center->adjacentRange())
+    {
+      CHECK(neighbour != center);
+      visited++;
+    }
+    CHECK_EQUAL(3, visited);
+
+    StreetGraph const& constGraph = graph;
+    CHECK_EQUAL(3, std::distance(constGraph.begin(), constGraph.end()));
+    CHECK(StreetGraph().roadRange().empty());
+  }
+
+  TEST(BatchInsertion)
+  {
+    std::vector<Path> lines, existing;
+    for (int i = 0; i <= 10; i++)
+    {
+      lines.push_back(Path(LineSegment(Point(i * 100, 0), Point(i * 100, 1000))));
+      lines.push_back(Path(LineSegment(Point(0, i * 100), Point(1000, i * 100))));
+    }
+    CHECK(batchMatchesSequential(existing, lines));
+
+    /* Crossing the roads already in the graph, meeting in
+       their intersections and ending on them. */
+    existing.push_back(Path(LineSegment(Point(-50, -50), Point(1050, 1050))));
+    existing.push_back(Path(LineSegment(Point(50, 0), Point(50, 1000))));
+    existing.push_back(Path(LineSegment(Point(0, 500), Point(-300, 700))));
+    CHECK(batchMatchesSequential(existing, lines));
+
+    /* Short pieces ending on each other. */
+    std::vector<Path> lattice;
+    for (int i = 0; i <= 8; i++)
+    {
+      for (int j = 0; j < 8; j++)
+      {
+        lattice.push_back(Path(LineSegment(Point(i * 100, j * 100), Point(i * 100, (j + 1) * 100))));
+        lattice.push_back(Path(LineSegment(Point(j * 100 + 50, i * 100 - 30), Point(j * 100 + 150, i * 100 + 30))));
+      }
+    }
+    CHECK(batchMatchesSequential(existing, lattice));
+
+    Random generator(libcity::RANDOM_SEED);
+    std::vector<Path> random;
+    for (int i = 0; i < 500; i++)
+    {
+      double x = generator.generateDouble(0, 3000),
+             y = generator.generateDouble(0, 3000),
+             angle = generator.generateDouble(0, 6.28),
+             length = generator.generateDouble(50, 300);
+      random.push_back(Path(LineSegment(Point(x, y),
+                                        Point(x + length * std::cos(angle), y + length * std::sin(angle)))));
+    }
+    CHECK(batchMatchesSequential(existing, random));
+  }
+
+  TEST(BatchInsertionFaces)
+  {
+    StreetGraph graph;
+    graph.setFaceTracking(true);
+    FaceCounter counter;
+    graph.addListener(&counter);
+
+    std::vector<Path> lines;
+    std::vector<Road::Type> types;
+    for (int i = 0; i <= 4; i++)
+    {
+      lines.push_back(Path(LineSegment(Point(i * 100, 0), Point(i * 100, 400))));
+      types.push_back(Road::PRIMARY_ROAD);
+      lines.push_back(Path(LineSegment(Point(0, i * 100), Point(400, i * 100))));
+      types.push_back(Road::SECONDARY_ROAD);
+    }
+    graph.addRoads(lines, types);
+
+    CHECK_EQUAL(40, graph.numberOfRoads());
+    CHECK_EQUAL(16, counter.added);
+    CHECK_EQUAL(0, counter.removed);
+    CHECK(facesAreCurrent(&graph));
+
+    int secondary = 0;
+    for (StreetGraph::iterator road = graph.begin(); road != graph.end(); road++)
+    {
+      if ((*road)->type() == Road::SECONDARY_ROAD)
+      {
+        secondary++;
+        CHECK((*road)->begining()->position().y() == (*road)->end()->position().y());
+      }
+    }
+    CHECK_EQUAL(20, secondary);
+
+    graph.removeListener(&counter);
+  }
+
+  TEST(CollinearRoads)
+  {
+    StreetGraph graph;
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(100, 0))));
+
+    /* Identical and contained roads only split the existing one. */
+    graph.addRoad(Path(LineSegment(Point(100, 0), Point(0, 0))));
+    CHECK_EQUAL(1, graph.numberOfRoads());
+    graph.addRoad(Path(LineSegment(Point(20, 0), Point(60, 0))));
+    CHECK_EQUAL(3, graph.numberOfRoads());
+
+    /* Containing and overlapping roads are split at the
+       existing intersections. */
+    graph.addRoad(Path(LineSegment(Point(-50, 0), Point(150, 0))));
+    CHECK_EQUAL(5, graph.numberOfRoads());
+    graph.addRoad(Path(LineSegment(Point(120, 0), Point(200, 0))));
+    CHECK_EQUAL(7, graph.numberOfRoads());
+    CHECK_EQUAL(8, graph.numberOfIntersections());
+
+    std::vector<RoadEnds> ends = roadEnds(&graph);
+    CHECK(std::adjacent_find(ends.begin(), ends.end()) == ends.end());
+
+    /* Adding them at once gives the same graph. */
+    std::vector<Path> existing, paths;
+    existing.push_back(Path(LineSegment(Point(0, 0), Point(100, 0))));
+    paths.push_back(Path(LineSegment(Point(100, 0), Point(0, 0))));
+    paths.push_back(Path(LineSegment(Point(20, 0), Point(60, 0))));
+    paths.push_back(Path(LineSegment(Point(-50, 0), Point(150, 0))));
+    paths.push_back(Path(LineSegment(Point(120, 0), Point(200, 0))));
+    paths.push_back(Path(LineSegment(Point(50, -50), Point(50, 50))));
+    CHECK(batchMatchesSequential(existing, paths));
+
+    /* Roads collinear only up to rounding are split the same way. */
+    double c = std::cos(0.3), s = std::sin(0.3);
+    StreetGraph rotated;
+    rotated.addRoad(Path(LineSegment(Point(0, 0), Point(100 * c, 100 * s))));
+    rotated.addRoad(Path(LineSegment(Point(30 * c, 30 * s), Point(150 * c, 150 * s))));
+    CHECK_EQUAL(3, rotated.numberOfRoads());
+    CHECK_EQUAL(4, rotated.numberOfIntersections());
+
+    std::vector<RoadEnds> rotatedEnds = roadEnds(&rotated);
+    CHECK(std::adjacent_find(rotatedEnds.begin(), rotatedEnds.end()) == rotatedEnds.end());
+
+    /* Contained road */
+    rotated.addRoad(Path(LineSegment(Point(50 * c, 50 * s), Point(70 * c, 70 * s))));
+    CHECK_EQUAL(5, rotated.numberOfRoads());
+
+    existing.clear();
+    paths.clear();
+    existing.push_back(Path(LineSegment(Point(0, 0), Point(100 * c, 100 * s))));
+    paths.push_back(Path(LineSegment(Point(30 * c, 30 * s), Point(150 * c, 150 * s))));
+    paths.push_back(Path(LineSegment(Point(50 * c, 50 * s), Point(70 * c, 70 * s))));
+    paths.push_back(Path(LineSegment(Point(-20 * c, -20 * s), Point(120 * c, 120 * s))));
+    CHECK(batchMatchesSequential(existing, paths));
+  }
+
+  TEST(FaceTracking)
+  {
+    StreetGraph graph;
+    FaceCounter counter;
+    graph.addListener(&counter);
+
+    graph.addRoad(Path(LineSegment(Point(0, 0), Point(100, 0))));
+    graph.addRoad(Path(LineSegment(Point(100, 0), Point(100, 100))));
+    graph.addRoad(Path(LineSegment(Point(100, 100), Point(0, 100))));
+    CHECK_EQUAL(0, counter.added);
+
+    graph.setFaceTracking(true);
+    CHECK_EQUAL(0, counter.added);
+    CHECK_EQUAL(0u, graph.getFaces().size());
+
+    /* Closing the square */
+    graph.addRoad(Path(LineSegment(Point(0, 100), Point(0, 0))));
+    CHECK_EQUAL(1, counter.added);
+    CHECK_EQUAL(0, counter.removed);
+    CHECK_EQUAL(1u, graph.getFaces().size());
+    CHECK_EQUAL(4u, graph.getFaces()[0].boundary().size());
+
+    /* A dead end or a road far away doesn't change the square */
+    graph.addRoad(Path(LineSegment(Point(100, 100), Point(50, 50))));
+    graph.addRoad(Path(LineSegment(Point(500, 0), Point(600, 0))));
+    CHECK_EQUAL(1, counter.added);
+    CHECK_EQUAL(0, counter.removed);
+
+    /* The dead end splits the square when extended */
+    graph.addRoad(Path(LineSegment(Point(50, 50), Point(0, 0))));
+    CHECK_EQUAL(3, counter.added);
+    CHECK_EQUAL(1, counter.removed);
+    CHECK_EQUAL(2u, graph.getFaces().size());
+    CHECK(facesAreCurrent(&graph));
+
+    graph.removeRoad(graph.getRoadBetweenIntersections(graph.getIntersectionAtPosition(Point(50, 50)),
+                                                       graph.getIntersectionAtPosition(Point(0, 0))));
+    CHECK_EQUAL(4, counter.added);
+    CHECK_EQUAL(3, counter.removed);
+    CHECK_EQUAL(1u, graph.getFaces().size());
+    CHECK(facesAreCurrent(&graph));
+
+    graph.removeListener(&counter);
+    graph.setFaceTracking(false);
+    CHECK_EQUAL(0u, graph.getFaces().size());
+  }
+
+  TEST(FaceTrackingOfGeneratedRoads)
+  {
+    StreetGraph graph;
+    graph.setFaceTracking(true);
+
+    RasterRoadPattern generator;
+    generator.setTarget(&graph);
+    generator.setRoadLength(200, 400);
+    generator.setSnapDistance(50);
+    generator.setAreaConstraints(new Polygon(Point(-3000,-3000), Point(3000,-3000),
+                                             Point(3000,3000), Point(-3000,3000)));
+    generator.generateRoads(300);
+    CHECK(graph.getFaces().size() > 10);
+    CHECK(facesAreCurrent(&graph));
+
+    graph.removeFilamentRoads();
+    CHECK(facesAreCurrent(&graph));
+
+    StreetGraph::Roads roads = graph.getRoads();
+    int removed = 0;
+    for (StreetGraph::Roads::iterator road = roads.begin(); road != roads.end(); road++, removed++)
+    {
+      if (removed % 7 == 0)
+      {
+        graph.removeRoad(*road);
+      }
+    }
+    CHECK(facesAreCurrent(&graph));
+  }
+}
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <string>
 #include <stdexcept>
+#include <list>
 
 // Tested modules
 #include "../src/area/subregion.h"
@@ -79,6 +80,28 @@ SUITE(SubRegionClass)
     CHECK(r.hasRoadAccess());
   }
 
+  TEST(EdgeOrder)
+  {
+    SubRegion r;
+    std::list<SubRegion::Edge*> edges;
+    SubRegion::Edge* current = 0;
+
+    /* Later edges begin at lower points than the earlier ones. */
+    for (int i = 0; i < 10; i++)
+    {
+      current = r.insert(current, Point(100 - 10*i, 5));
+      edges.push_back(current);
+    }
+
+    edges.sort(SubRegion::EdgeOrder());
+
+    std::list<SubRegion::Edge*>::iterator edge = edges.begin();
+    for (int i = 0; i < 10; i++, edge++)
+    {
+      CHECK(Point(10*i + 10, 5) == (*edge)->begining);
+    }
+  }
+
   TEST(ToPolygon)
   {
     SubRegion r;
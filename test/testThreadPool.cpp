@@ -0,0 +1,120 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testThreadPool.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of ThreadPool class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <vector>
+#include <atomic>
+
+// Tested modules
+#include "../src/threadpool.h"
+
+namespace
+{
+  struct Square
+  {
+    std::vector<int>* results;
+    void operator()(int index) const
+    {
+      (*results)[index] = index * index;
+    }
+  };
+
+  /** First tasks are much longer, the others have to steal them. */
+  struct Uneven
+  {
+    std::vector<int>* results;
+    void operator()(int index) const
+    {
+      int work = index < 8 ? 200000 : 10;
+      volatile int sum = 0;
+      for (int i = 0; i < work; i++)
+      {
+        sum += i;
+      }
+      (*results)[index]++;
+    }
+  };
+
+  struct NestedSum
+  {
+    ThreadPool* pool;
+    std::atomic<int>* sum;
+    void operator()(int) const
+    {
+      Counter counter = {sum};
+      pool->run(10, counter);
+    }
+
+    struct Counter
+    {
+      std::atomic<int>* total;
+      void operator()(int) const
+      {
+        (*total)++;
+      }
+    };
+  };
+}
+
+SUITE(ThreadPoolClass)
+{
+  TEST(RunsEveryTask)
+  {
+    int sizes[] = {1, 2, 4};
+    for (unsigned int size = 0; size < sizeof(sizes)/sizeof(sizes[0]); size++)
+    {
+      ThreadPool pool(sizes[size]);
+      CHECK_EQUAL(sizes[size], pool.size());
+
+      /* Batches repeated to catch races between them */
+      for (int batch = 0; batch < 50; batch++)
+      {
+        std::vector<int> results(1000, -1);
+        Square task = {&results};
+        pool.run(results.size(), task);
+        for (int index = 0; index < (int)results.size(); index++)
+        {
+          CHECK_EQUAL(index * index, results[index]);
+        }
+      }
+
+      pool.run(0, Square());
+    }
+  }
+
+  TEST(UnevenTasks)
+  {
+    ThreadPool pool(4);
+    std::vector<int> results(500, 0);
+    Uneven task = {&results};
+    pool.run(results.size(), task);
+    pool.run(results.size(), task);
+
+    for (unsigned int index = 0; index < results.size(); index++)
+    {
+      CHECK_EQUAL(2, results[index]);
+    }
+  }
+
+  TEST(NestedBatch)
+  {
+    ThreadPool pool(3);
+    std::atomic<int> sum(0);
+    NestedSum task = {&pool, &sum};
+    pool.run(20, task);
+    CHECK_EQUAL(200, sum.load());
+  }
+}
@@ -0,0 +1,262 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testTiledCity.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of TiledCity class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <list>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <set>
+
+#include "temporary.h"
+
+// Tested modules
+#include "../src/tiledcity.h"
+#include "../src/city.h"
+#include "../src/io/cityfile.h"
+#include "../src/streetgraph/streetgraph.h"
+#include "../src/streetgraph/intersection.h"
+#include "../src/streetgraph/organicroadpattern.h"
+#include "../src/area/zone.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/linesegment.h"
+#include "../src/geometry/units.h"
+
+namespace
+{
+  const double TILE_SIZE = 2000;
+
+  /** Organic roads and zones, nothing else. */
+  class TileCity : public City
+  {
+    public:
+      TileCity(Polygon const& cityArea)
+      {
+        *area = cityArea;
+      }
+
+      virtual ~TileCity()
+      {
+        for (std::list<Zone*>::iterator zone = zones->begin(); zone != zones->end(); zone++)
+        {
+          delete *zone;
+        }
+      }
+
+    protected:
+      virtual void createPrimaryRoadNetwork()
+      {
+        OrganicRoadPattern generator;
+        generator.setTarget(map);
+        generator.setAreaConstraints(new Polygon(*area));
+        generator.setInitialPosition(area->centroid());
+        generator.setRandomEngine(randomEngine());
+        generator.setRoadLength(150, 250);
+        generator.setSnapDistance(50);
+        generator.generateRoads(40);
+      }
+
+      virtual void createZones()
+      {
+        *zones = map->findZones();
+      }
+
+      virtual void createSecondaryRoadNetwork() {}
+      virtual void createBlocks() {}
+      virtual void createBuildings() {}
+  };
+
+  City* createTileCity(Polygon const& area)
+  {
+    return new TileCity(area);
+  }
+
+  std::string contents(std::string const& fileName)
+  {
+    std::ifstream file(fileName.c_str(), std::ios::binary);
+    std::stringstream text;
+    text << file.rdbuf();
+    return text.str();
+  }
+
+  int numberOfIntersectionsOnLine(StreetGraph* graph, double x, int ways)
+  {
+    int count = 0;
+    StreetGraph::IntersectionRange intersections = graph->intersectionRange();
+    for (StreetGraph::IntersectionRange::iterator intersection = intersections.begin();
+         intersection != intersections.end();
+         intersection++)
+    {
+      if ((*intersection)->position().x() == x && (*intersection)->numberOfWays() == ways)
+      {
+        count++;
+      }
+    }
+    return count;
+  }
+
+  Intersection* nearestIntersection(StreetGraph* graph, Point const& point)
+  {
+    Intersection* nearest = 0;
+    StreetGraph::IntersectionRange intersections = graph->intersectionRange();
+    for (StreetGraph::IntersectionRange::iterator intersection = intersections.begin();
+         intersection != intersections.end();
+         intersection++)
+    {
+      if (nearest == 0 || LineSegment(point, (*intersection)->position()).length() <
+                          LineSegment(point, nearest->position()).length())
+      {
+        nearest = *intersection;
+      }
+    }
+    return nearest;
+  }
+
+  /** Is there a path of roads between the intersections? */
+  bool connected(Intersection* from, Intersection* to)
+  {
+    std::set<Intersection*> visited;
+    std::vector<Intersection*> stack(1, from);
+    visited.insert(from);
+    while (!stack.empty())
+    {
+      Intersection* current = stack.back();
+      stack.pop_back();
+      if (current == to)
+      {
+        return true;
+      }
+
+      Intersection::AdjacentRange adjacent = current->adjacentRange();
+      for (Intersection::AdjacentRange::iterator next = adjacent.begin(); next != adjacent.end(); next++)
+      {
+        if (visited.insert(*next).second)
+        {
+          stack.push_back(*next);
+        }
+      }
+    }
+    return false;
+  }
+}
+
+SUITE(TiledCityClass)
+{
+  TEST(SharedPorts)
+  {
+    TiledCity city(3, 2, TILE_SIZE, createTileCity);
+
+    std::vector<Point> first, second;
+    city.ports(0, 0, &first);
+    city.ports(1, 0, &second);
+    CHECK_EQUAL(10u, first.size());
+    CHECK_EQUAL(15u, second.size());
+
+    /* The east ports of the first tile are the west ports of the second */
+    int shared = 0;
+    for (unsigned int i = 0; i < first.size(); i++)
+    {
+      for (unsigned int j = 0; j < second.size(); j++)
+      {
+        if (first[i].x() == second[j].x() && first[i].y() == second[j].y())
+        {
+          CHECK_EQUAL(TILE_SIZE, first[i].x());
+          shared++;
+        }
+      }
+    }
+    CHECK_EQUAL(5, shared);
+
+    city.setSeed(42);
+    city.ports(1, 0, &first);
+    CHECK(first[0].y() != second[0].y());
+  }
+
+  TEST(PortSpacingIsPositive)
+  {
+    TiledCity city(3, 2, TILE_SIZE, createTileCity);
+
+    /* Three shared edges with a port per snap distance */
+    std::vector<Point> points;
+    city.setPortSpacing(0);
+    city.ports(1, 0, &points);
+    CHECK_EQUAL(3 * static_cast<unsigned int>(TILE_SIZE / libcity::SNAP_DISTANCE), points.size());
+
+    city.setPortSpacing(-100);
+    city.ports(1, 0, &points);
+    CHECK_EQUAL(3 * static_cast<unsigned int>(TILE_SIZE / libcity::SNAP_DISTANCE), points.size());
+  }
+
+  TEST(Seams)
+  {
+    TiledCity city(3, 2, TILE_SIZE, createTileCity);
+    city.setHalo(100);
+
+    StreetGraph graph;
+    city.createSeams(1, 0, &graph);
+
+    /* Corners, 15 ports with their connectors and the border
+       split at the ports of three edges. */
+    CHECK_EQUAL(4 + 15 + 15, graph.numberOfIntersections());
+    CHECK_EQUAL(6 + 6 + 1 + 6 + 15, graph.numberOfRoads());
+    CHECK_EQUAL(5, numberOfIntersectionsOnLine(&graph, TILE_SIZE, 3));
+    CHECK_EQUAL(5, numberOfIntersectionsOnLine(&graph, TILE_SIZE + 100, 1));
+  }
+
+  TEST(GenerateAndStitch)
+  {
+    TemporaryDirectory directory;
+    TiledCity city(2, 1, TILE_SIZE, createTileCity);
+    city.setHalo(100);
+    city.setNumberOfThreads(2);
+    CHECK(city.generate(directory.path));
+
+    /* A tile generated alone is the same */
+    std::string single = directory.path + "/single.city";
+    CHECK(city.generateTile(1, 0, single));
+    CHECK(contents(single) == contents(TiledCity::tileFileName(directory.path, 1, 0)));
+
+    int intersections = 0, roads = 0;
+    for (int column = 0; column < 2; column++)
+    {
+      CityFile file;
+      CHECK(file.open(TiledCity::tileFileName(directory.path, column, 0)));
+      CHECK(file.numberOfZones() > 0);
+      CHECK(file.numberOfRoads() > 40);
+      intersections += file.numberOfIntersections();
+      roads += file.numberOfRoads();
+    }
+
+    /* The shared edge has 5 ports, 2 corners and 6 seam roads */
+    StreetGraph graph;
+    CHECK(city.loadStreetGraph(directory.path, &graph));
+    CHECK_EQUAL(intersections - 7, graph.numberOfIntersections());
+    CHECK_EQUAL(roads - 6, graph.numberOfRoads());
+    CHECK_EQUAL(5, numberOfIntersectionsOnLine(&graph, TILE_SIZE, 4));
+    CHECK_EQUAL(2, numberOfIntersectionsOnLine(&graph, TILE_SIZE, 3));
+
+    /* Connectors aren't dead ends, the roads of the tiles are joined */
+    CHECK_EQUAL(0, numberOfIntersectionsOnLine(&graph, TILE_SIZE - 100, 1));
+    CHECK_EQUAL(0, numberOfIntersectionsOnLine(&graph, TILE_SIZE + 100, 1));
+    Intersection* west = nearestIntersection(&graph, Point(TILE_SIZE / 2, TILE_SIZE / 2));
+    Intersection* east = nearestIntersection(&graph, Point(3 * TILE_SIZE / 2, TILE_SIZE / 2));
+    CHECK(connected(west, east));
+
+    CHECK(!city.loadStreetGraph(directory.path + "/missing", &graph));
+  }
+}
@@ -0,0 +1,124 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testTriangulator.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of Triangulator class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <vector>
+#include <cmath>
+
+// Tested modules
+#include "../src/geometry/triangulator.h"
+#include "../src/geometry/polygon.h"
+#include "../src/geometry/point.h"
+#include "../src/geometry/units.h"
+
+namespace
+{
+  /** Sum of the areas of counterclockwise triangles, clockwise ones are negative. */
+  double trianglesArea(Polygon const& polygon, std::vector<int> const& indexes)
+  {
+    double area = 0;
+    for (unsigned int i = 0; i + 2 < indexes.size(); i += 3)
+    {
+      Point a = polygon.vertex(indexes[i]),
+            b = polygon.vertex(indexes[i + 1]),
+            c = polygon.vertex(indexes[i + 2]);
+      area += ((b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x())) / 2;
+    }
+    return area;
+  }
+
+  /** Comb with teeth pointing up, lots of reflex vertices. */
+  Polygon comb(int teeth)
+  {
+    Polygon polygon;
+    polygon.addVertex(Point(0, 0));
+    polygon.addVertex(Point(teeth * 20, 0));
+    for (int tooth = teeth - 1; tooth >= 0; tooth--)
+    {
+      polygon.addVertex(Point(tooth * 20 + 20, 100));
+      polygon.addVertex(Point(tooth * 20 + 10, 100));
+      polygon.addVertex(Point(tooth * 20 + 10, 10));
+      polygon.addVertex(Point(tooth * 20, 10));
+    }
+    return polygon;
+  }
+}
+
+SUITE(TriangulatorClass)
+{
+  TEST(Convex)
+  {
+    Polygon square(Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10));
+    Triangulator triangulator;
+    std::vector<int> indexes;
+    CHECK(triangulator.triangulate(square, &indexes));
+    CHECK_EQUAL(6u, indexes.size());
+    CHECK_CLOSE(100, trianglesArea(square, indexes), 1e-9);
+
+    /* Clockwise polygons give counterclockwise triangles too. */
+    Polygon clockwise(Point(0, 10), Point(10, 10), Point(10, 0), Point(0, 0));
+    CHECK(triangulator.triangulate(clockwise, &indexes));
+    CHECK_EQUAL(6u, indexes.size());
+    CHECK_CLOSE(100, trianglesArea(clockwise, indexes), 1e-9);
+
+    std::vector<Point> points;
+    CHECK(triangulator.triangulate(square, &points));
+    CHECK_EQUAL(6u, points.size());
+  }
+
+  TEST(Concave)
+  {
+    Triangulator triangulator;
+    std::vector<int> indexes;
+    for (int teeth = 1; teeth <= 20; teeth++)
+    {
+      Polygon polygon = comb(teeth);
+      CHECK(triangulator.triangulate(polygon, &indexes));
+      CHECK_EQUAL(3 * (polygon.numberOfVertices() - 2), indexes.size());
+      CHECK_CLOSE(polygon.area(), trianglesArea(polygon, indexes), 1e-6);
+    }
+  }
+
+  TEST(CollinearVertices)
+  {
+    Polygon polygon;
+    polygon.addVertex(Point(0, 0));
+    polygon.addVertex(Point(5, 0));
+    polygon.addVertex(Point(10, 0));
+    polygon.addVertex(Point(10, 10));
+    polygon.addVertex(Point(5, 10));
+    polygon.addVertex(Point(0, 10));
+
+    std::vector<int> indexes;
+    CHECK(Triangulator().triangulate(polygon, &indexes));
+    CHECK_EQUAL(12u, indexes.size());
+    CHECK_CLOSE(100, trianglesArea(polygon, indexes), 1e-9);
+  }
+
+  TEST(NotSimple)
+  {
+    Polygon bowTie(Point(0, 0), Point(10, 10), Point(10, 0), Point(0, 10));
+    Triangulator triangulator;
+    std::vector<int> indexes;
+    CHECK(!triangulator.triangulate(bowTie, &indexes));
+
+    Polygon line(Point(0, 0), Point(5, 0), Point(10, 0));
+    CHECK(!triangulator.triangulate(line, &indexes));
+
+    CHECK(!triangulator.triangulate(Polygon(), &indexes));
+    CHECK(indexes.empty());
+  }
+}
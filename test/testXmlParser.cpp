@@ -0,0 +1,139 @@
+/**
+ * This code is part of libcity library.
+ *
+ * @file test/testXmlParser.cpp
+ * @date 18.10.2026
+ * @author Radek Pazdera (xpazde00@stud.fit.vutbr.cz)
+ *
+ * @brief Unit test of XmlParser class
+ *
+ * Unit tests require UnitTest++ framework! See README
+ * for more informations.
+ */
+
+/* Include UnitTest++ headers */
+#include <UnitTest++.h>
+
+// Includes
+#include <string>
+#include <unistd.h>
+
+#include "temporary.h"
+
+// Tested modules
+#include "../src/io/xmlparser.h"
+
+namespace
+{
+  /** Writes down the events of the parser. */
+  class Recorder : public XmlParser
+  {
+    public:
+      Recorder(std::size_t bufferSize)
+        : XmlParser(bufferSize)
+      {}
+
+      std::string events;
+
+      bool parseText(std::string const& text)
+      {
+        TemporaryFile file(text);
+        lseek(file.descriptor, 0, SEEK_SET);
+
+        events.clear();
+        return !file.fileName.empty() && parse(file.descriptor);
+      }
+
+    protected:
+      virtual void startElement(char const* name, Attributes const& attributes)
+      {
+        events += std::string("<") + name;
+        for (Attributes::const_iterator attribute = attributes.begin();
+             attribute != attributes.end();
+             attribute++)
+        {
+          events += std::string(" ") + attribute->name + "=" + attribute->value;
+        }
+        events += ">";
+      }
+
+      virtual void endElement(char const* name)
+      {
+        events += std::string("</") + name + ">";
+      }
+  };
+
+  const char* DOCUMENT =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<!DOCTYPE osm>\n"
+    "<osm version=\"0.6\">\n"
+    "  <!-- <node id=\"1\"/> is commented out -->\n"
+    "  <node id=\"2\" lat='50.1' lon = \"14.4\" />\n"
+    "  <way id=\"3\">\n"
+    "    <nd ref=\"2\"/>\n"
+    "    <tag k=\"name\" v=\"A &amp; B &lt;&gt; &quot;C&apos; &#65;&#x42; &#x10D; &unknown;\"/>\n"
+    "    <tag k=\"note\" v=\"a > b\"/><![CDATA[ <way> ]]>text\n"
+    "  </way >\n"
+    "</osm>\n";
+
+  const char* EVENTS =
+    "<osm version=0.6>"
+    "<node id=2 lat=50.1 lon=14.4></node>"
+    "<way id=3>"
+    "<nd ref=2></nd>"
+    "<tag k=name v=A & B <> \"C' AB \xC4\x8D &unknown;></tag>"
+    "<tag k=note v=a > b></tag>"
+    "</way>"
+    "</osm>";
+}
+
+SUITE(XmlParserClass)
+{
+  TEST(Parse)
+  {
+    Recorder parser(XmlParser::DEFAULT_BUFFER_SIZE);
+    CHECK(parser.parseText(DOCUMENT));
+    CHECK_EQUAL(EVENTS, parser.events);
+  }
+
+  TEST(SmallBuffer)
+  {
+    /* Tags are split between reads and the buffer has to grow */
+    for (std::size_t size = 1; size < 16; size++)
+    {
+      Recorder parser(size);
+      CHECK(parser.parseText(DOCUMENT));
+      CHECK_EQUAL(EVENTS, parser.events);
+    }
+  }
+
+  TEST(CharacterReferences)
+  {
+    /* Only plain digits of characters other than surrogates are decoded */
+    Recorder parser(XmlParser::DEFAULT_BUFFER_SIZE);
+    CHECK(parser.parseText("<a v=\"&#x4A;&#106;|&# 65;|&#+65;|&#-65;|&#x0x41;|&#x;|&#xD800;|&#57343;|&#0;\"/>"));
+    CHECK_EQUAL("<a v=Jj|&# 65;|&#+65;|&#-65;|&#x0x41;|&#x;|&#xD800;|&#57343;|&#0;></a>", parser.events);
+  }
+
+  TEST(Malformed)
+  {
+    Recorder parser(8);
+    CHECK(!parser.parseText("<osm><node id=\"1\""));
+    CHECK(!parser.parseText("<osm><node/>"));
+    CHECK(!parser.parseText("<osm></osm></osm>"));
+    CHECK(!parser.parseText("<osm><node id=1/></osm>"));
+    CHECK(!parser.parseText("<osm><!-- comment </osm>"));
+    CHECK(parser.parseText(""));
+  }
+
+  TEST(Find)
+  {
+    XmlParser::Attributes attributes;
+    XmlParser::Attribute first = {"k", "highway"}, second = {"v", "primary"};
+    attributes.push_back(first);
+    attributes.push_back(second);
+
+    CHECK_EQUAL("primary", XmlParser::find(attributes, "v"));
+    CHECK(XmlParser::find(attributes, "id") == 0);
+  }
+}
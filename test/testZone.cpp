@@ -22,6 +22,7 @@
 // Tested modules
 #include "../src/area/zone.h"
 #include "../src/geometry/polygon.h"
+#include "../src/random.h"
 #include "../src/debug.h"
 
 SUITE(ZoneClass)
@@ -29,4 +30,21 @@ SUITE(ZoneClass)
   TEST(Empty)
   {
   }
+
+  TEST(AssignRandomEngine)
+  {
+    Zone seeded(0), unseeded(0);
+    seeded.setRandomEngine(RandomEngine(42));
+
+    /* The engine is copied, not shared */
+    Zone copy(0);
+    copy = seeded;
+    CHECK(copy.randomEngine() != 0);
+    CHECK(copy.randomEngine() != seeded.randomEngine());
+    CHECK_EQUAL(seeded.randomEngine()->next(), copy.randomEngine()->next());
+
+    /* Without an engine in the source, the zone uses the shared seed again */
+    copy = unseeded;
+    CHECK(copy.randomEngine() == 0);
+  }
 }
\ No newline at end of file